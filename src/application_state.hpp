@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <QObject>
+#include <QUuid>
 
 #include "common/types/ssl_config/ssl_config.hpp"
 
@@ -19,6 +20,8 @@ class ApplicatiionState : public QObject {
   void onHostSSlConfigChanged(const std::optional<common::types::SslConfig>& sslConfig);
   void onIsServerChanged(bool isServer);
   void shouldUseBluetoothChanged(bool useBluetooth);
+  void historyDepthChanged(int depth);
+  void clipboardDebounceChanged(int msec);
 
  public:
   explicit ApplicatiionState(QObject* parent = nullptr);
@@ -32,5 +35,13 @@ class ApplicatiionState : public QObject {
 
   virtual bool shouldUseBluetooth() const = 0;
   virtual void setUseBluetooth(bool useBluetooth) = 0;
+
+  virtual QUuid getDeviceId() const = 0;
+
+  virtual int getHistoryDepth() const = 0;
+  virtual void setHistoryDepth(int depth) = 0;
+
+  virtual int getClipboardDebounce() const = 0;
+  virtual void setClipboardDebounce(int msec) = 0;
 };
 }
@@ -1,5 +1,7 @@
 #include "application_state_qsettings.hpp"
 
+#include <algorithm>
+
 namespace srilakshmikanthanp::clipbirdesk {
 ApplicatiionStateQSettings::ApplicatiionStateQSettings(QObject* parent): ApplicatiionState(parent) {}
 ApplicatiionStateQSettings::~ApplicatiionStateQSettings() {}
@@ -55,4 +57,46 @@ void ApplicatiionStateQSettings::setUseBluetooth(bool useBluetooth) {
   settings->endGroup();
   emit shouldUseBluetoothChanged(useBluetooth);
 }
+
+QUuid ApplicatiionStateQSettings::getDeviceId() const {
+  settings->beginGroup(applicatiionStateGroup);
+  QUuid deviceId = QUuid::fromString(settings->value(deviceIdKey).toString());
+  // generated on first use and kept for the life of the install
+  if (deviceId.isNull()) {
+    deviceId = QUuid::createUuid();
+    settings->setValue(deviceIdKey, deviceId.toString(QUuid::WithoutBraces));
+  }
+  settings->endGroup();
+  return deviceId;
+}
+
+int ApplicatiionStateQSettings::getHistoryDepth() const {
+  settings->beginGroup(applicatiionStateGroup);
+  int depth = settings->value(historyDepthKey, constants::getAppMaxHistorySize()).toInt();
+  settings->endGroup();
+  return std::clamp(depth, 1, int(constants::getAppMaxHistoryDepth()));
+}
+
+void ApplicatiionStateQSettings::setHistoryDepth(int depth) {
+  depth = std::clamp(depth, 1, int(constants::getAppMaxHistoryDepth()));
+  settings->beginGroup(applicatiionStateGroup);
+  settings->setValue(historyDepthKey, depth);
+  settings->endGroup();
+  emit historyDepthChanged(depth);
+}
+
+int ApplicatiionStateQSettings::getClipboardDebounce() const {
+  settings->beginGroup(applicatiionStateGroup);
+  int msec = settings->value(clipboardDebounceKey, constants::getAppClipboardDebounce()).toInt();
+  settings->endGroup();
+  return std::clamp(msec, 0, int(constants::getAppMaxClipboardDebounce()));
+}
+
+void ApplicatiionStateQSettings::setClipboardDebounce(int msec) {
+  msec = std::clamp(msec, 0, int(constants::getAppMaxClipboardDebounce()));
+  settings->beginGroup(applicatiionStateGroup);
+  settings->setValue(clipboardDebounceKey, msec);
+  settings->endGroup();
+  emit clipboardDebounceChanged(msec);
+}
 }
@@ -2,6 +2,7 @@
 
 #include <QSettings>
 #include "application_state.hpp"
+#include "constants/constants.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk {
 class ApplicatiionStateQSettings : public ApplicatiionState {
@@ -19,6 +20,9 @@ class ApplicatiionStateQSettings : public ApplicatiionState {
   static constexpr const char* keyKey = "key";
   static constexpr const char* isServerKey = "isServer";
   static constexpr const char* useBluetoothKey = "useBluetooth";
+  static constexpr const char* deviceIdKey = "deviceId";
+  static constexpr const char* historyDepthKey = "historyDepth";
+  static constexpr const char* clipboardDebounceKey = "clipboardDebounce";
 
  private:  // constructor
 
@@ -40,5 +44,13 @@ class ApplicatiionStateQSettings : public ApplicatiionState {
 
   bool shouldUseBluetooth() const override;
   void setUseBluetooth(bool useBluetooth) override;
+
+  QUuid getDeviceId() const override;
+
+  int getHistoryDepth() const override;
+  void setHistoryDepth(int depth) override;
+
+  int getClipboardDebounce() const override;
+  void setClipboardDebounce(int msec) override;
 };
 }
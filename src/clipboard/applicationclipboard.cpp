@@ -1,39 +1,74 @@
 #include "applicationclipboard.hpp"
 
+namespace srilakshmikanthanp::clipbirdesk::clipboard::internal {
+/**
+ * @brief Buffer that fails its writes once cancelled, the image writer
+ * stops at the first failed write so the encode ends early
+ */
+class CancellableBuffer : public QBuffer {
+ private:
+
+  std::shared_ptr<std::atomic_bool> cancelled;
+
+ protected:
+
+  qint64 writeData(const char* data, qint64 length) override {
+    if (cancelled->load()) return -1;
+    return QBuffer::writeData(data, length);
+  }
+
+ public:
+
+  CancellableBuffer(QByteArray* array, std::shared_ptr<std::atomic_bool> cancelled)
+      : QBuffer(array), cancelled(std::move(cancelled)) {}
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::clipboard::internal
+
 namespace srilakshmikanthanp::clipbirdesk::clipboard {
 /**
  * @brief Slot to notify the clipboard change
  */
 void ApplicationClipboard::onClipboardChangeImpl(QClipboard::Mode mode) {
-  if (!QApplication::clipboard()->ownsClipboard() && mode == QClipboard::Mode::Clipboard) {
-    this->get().then([this](QVector<QPair<QString, QByteArray>> result){ if (!result.isEmpty()) emit OnClipboardChange(result); });
+  if (QApplication::clipboard()->ownsClipboard() || mode != QClipboard::Mode::Clipboard) {
+    return;
   }
+
+  m_sequence.changed(m_debounce->isActive());
+  m_debounce->start();
 }
 
 /**
- * @brief Construct a new Clipboard object and manage
- * the clipboard that is passed via the constructor
- *
- * @param clipboard Clipboard that is managed
- * @param parent parent object
+ * @brief Read the clipboard once the changes settled
  */
-ApplicationClipboard::ApplicationClipboard(QObject* parent) : QObject(parent) {
-  // connect the clipboard change signal to the slot
-  QObject::connect(
-    this->m_clipboard, &PlatformClipboard::changed,
-    this, &ApplicationClipboard::onClipboardChangeImpl
-  );
+void ApplicationClipboard::onDebounceTimeout() {
+  const auto ticket = m_sequence.begin();
+
+  this->read(ticket.cancelled, m_fingerprint).then(this, [this, ticket](Capture capture) {
+    if (!m_sequence.finish(ticket)) {
+      return;
+    }
+
+    // apps re-asserting the same content
+    if (capture.fingerprint == m_fingerprint) {
+      m_sequence.unchanged();
+      return;
+    }
+
+    m_fingerprint = capture.fingerprint;
+
+    if (!capture.items.isEmpty()) emit OnClipboardChange(capture.items, capture.fingerprint);
+  });
 }
 
 /**
- * @brief Get the clipboard data from the clipboard
- *
- * @return mime type and data
+ * @brief Read the clipboard, an image encode in flight stops once
+ * the cancelled flag is set
  */
-QFuture<QVector<QPair<QString, QByteArray>>> ApplicationClipboard::get() const {
+QFuture<ApplicationClipboard::Capture> ApplicationClipboard::read(std::shared_ptr<std::atomic_bool> cancelled, std::optional<quint64> previous) const {
   const auto mimeData = m_clipboard->mimeData(QClipboard::Mode::Clipboard);
   QVector<QPair<QString, QByteArray>> items;
   std::optional<QImage> image;
+  bool encoded = false;
 
   if (mimeData->hasHtml()) {
     items.append({MIME_TYPE_HTML, mimeData->html().toUtf8()});
@@ -43,19 +78,78 @@ QFuture<QVector<QPair<QString, QByteArray>>> ApplicationClipboard::get() const {
     items.append({MIME_TYPE_TEXT, mimeData->text().toUtf8()});
   }
 
-  if (mimeData->hasImage()) {
+  // encoded images are taken as they are
+  for (const auto& [format, mime] : ENCODED_IMAGE_FORMATS) {
+    if (const auto data = mimeData->hasFormat(format) ? mimeData->data(format) : QByteArray(); !data.isEmpty()) {
+      items.append({mime, data});
+      encoded = true;
+      break;
+    }
+  }
+
+  // only raw bitmaps are encoded to png
+  if (!encoded && mimeData->hasImage()) {
     image = qvariant_cast<QImage>(mimeData->imageData());
   }
 
-  return QtConcurrent::run([items, image, this]() mutable {
-    if (image.has_value() && !image->isNull()) {
+  return QtConcurrent::run([items, image, cancelled, previous, this]() mutable {
+    const auto hasImage = image.has_value() && !image->isNull();
+    Capture capture{utility::functions::contentFingerprint(items), {}};
+
+    // the bitmap stands in for its png so unchanged content is not encoded
+    if (hasImage) {
+      const auto seed     = capture.fingerprint ^ (quint64(image->width()) << 32 | quint64(image->height()));
+      capture.fingerprint = utility::functions::contentFingerprint(QByteArrayView(image->constBits(), image->sizeInBytes()), seed);
+    }
+
+    if (capture.fingerprint == previous) {
+      return capture;
+    }
+
+    if (hasImage && !cancelled->load()) {
       QByteArray byteArray;
-      QBuffer buffer(&byteArray);
+      internal::CancellableBuffer buffer(&byteArray, cancelled);
       buffer.open(QIODevice::WriteOnly);
-      image->save(&buffer, IMAGE_TYPE_PNG);
-      items.append({MIME_TYPE_PNG, byteArray});
+      if (image->save(&buffer, IMAGE_TYPE_PNG)) items.append({MIME_TYPE_PNG, byteArray});
     }
-    return items;
+
+    capture.items = items;
+    return capture;
+  });
+}
+
+/**
+ * @brief Construct a new Clipboard object and manage
+ * the clipboard that is passed via the constructor
+ *
+ * @param clipboard Clipboard that is managed
+ * @param parent parent object
+ */
+ApplicationClipboard::ApplicationClipboard(QObject* parent) : QObject(parent) {
+  // changes in a burst are read once
+  m_debounce->setSingleShot(true);
+  m_debounce->setInterval(int(constants::getAppClipboardDebounce()));
+
+  // connect the clipboard change signal to the slot
+  QObject::connect(
+    this->m_clipboard, &PlatformClipboard::changed,
+    this, &ApplicationClipboard::onClipboardChangeImpl
+  );
+
+  QObject::connect(
+    m_debounce, &QTimer::timeout,
+    this, &ApplicationClipboard::onDebounceTimeout
+  );
+}
+
+/**
+ * @brief Get the clipboard data from the clipboard
+ *
+ * @return mime type and data
+ */
+QFuture<QVector<QPair<QString, QByteArray>>> ApplicationClipboard::get() const {
+  return this->read(std::make_shared<std::atomic_bool>(false), std::nullopt).then([](Capture capture) {
+    return capture.items;
   });
 }
 
@@ -66,35 +160,54 @@ void ApplicationClipboard::clear() {
   m_clipboard->clear(QClipboard::Mode::Clipboard);
 }
 
+/**
+ * @brief Set the window in ms that clipboard changes are coalesced in
+ */
+void ApplicationClipboard::setDebounceInterval(int msec) {
+  m_debounce->setInterval(msec);
+}
+
+/**
+ * @brief Get the window in ms that clipboard changes are coalesced in
+ */
+int ApplicationClipboard::getDebounceInterval() const {
+  return m_debounce->interval();
+}
+
+/**
+ * @brief Get the counts of the capture pipeline
+ */
+ApplicationClipboard::CaptureStats ApplicationClipboard::getCaptureStats() const {
+  return m_sequence.getStats();
+}
+
 /**
  * @brief Set the clipboard data to the clipboard
  *
  * @param mime mime type of the data
  * @param data data to be set
  */
-void ApplicationClipboard::set(const QVector<QPair<QString, QByteArray>> data) {
-  // create the mime data object
-  QMimeData *mimeData = new QMimeData();
-
-  // set the data
-  for (const auto& [mime, data] : data) {
-    // has Image png
-    if (mime == MIME_TYPE_PNG) {
-      mimeData->setImageData(QImage::fromData(data, IMAGE_TYPE_PNG));
-    }
+void ApplicationClipboard::set(const QVector<QPair<QString, QByteArray>> data, quint64 fingerprint) {
+  QVector<QPair<QString, QByteArray>> items;
+  bool hasImage = false;
 
-    // has HTML
-    if (mime == MIME_TYPE_HTML) {
-      mimeData->setHtml(QString::fromUtf8(data));
+  // keep the known types and a single image as they came
+  for (const auto& [mime, payload] : data) {
+    if (mime == MIME_TYPE_HTML || mime == MIME_TYPE_TEXT) {
+      items.append({mime, payload});
     }
 
-    // has Text
-    if (mime == MIME_TYPE_TEXT) {
-      mimeData->setText(QString::fromUtf8(data));
+    if ((mime == MIME_TYPE_PNG || mime == MIME_TYPE_JPEG || mime == MIME_TYPE_WEBP) && !hasImage) {
+      items.append({mime, payload});
+      hasImage = true;
     }
   }
 
-  // set the mime data
-  m_clipboard->setMimeData(mimeData, QClipboard::Mode::Clipboard);
+  // what is synced here is not captured and synced back, the given
+  // fingerprint holds unless some items were dropped
+  m_fingerprint = items.size() == data.size() ? fingerprint : utility::functions::contentFingerprint(items);
+
+  // the payloads are decoded only when pasted
+  m_clipboard->setMimeData(new LazyMimeData(items), QClipboard::Mode::Clipboard);
 }
 }  // namespace srilakshmikanthanp::clipbirdesk::clipboard
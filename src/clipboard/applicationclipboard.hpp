@@ -1,5 +1,10 @@
 #pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
 
+// Standard header
+#include <atomic>
+#include <memory>
+#include <optional>
+
 // Qt header
 #include <QApplication>
 #include <QBuffer>
@@ -13,13 +18,18 @@
 #include <QObject>
 #include <QPair>
 #include <QString>
+#include <QTimer>
 #include <QUrl>
 #include <QVector>
 #include <QtConcurrent>
 
 // project header
+#include "clipboard/capturesequence.hpp"
+#include "clipboard/lazymimedata.hpp"
 #include "clipboard/platformclipboard.hpp"
 #include "common/types/exceptions/exceptions.hpp"
+#include "constants/constants.hpp"
+#include "utility/functions/fingerprint/fingerprint.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::clipboard {
 
@@ -28,18 +38,41 @@ namespace srilakshmikanthanp::clipbirdesk::clipboard {
  * set and notify the clipboard change
  */
 class ApplicationClipboard : public QObject {
+ public:  // types
+
+  /// @brief Counts of the capture pipeline
+  using CaptureStats = CaptureSequence::Stats;
+
+ private:  // types
+
+  /**
+   * @brief Items read from the clipboard with their fingerprint, the
+   * fingerprint of a bitmap is taken before it is encoded
+   */
+  struct Capture {
+    quint64 fingerprint = 0;
+    QVector<QPair<QString, QByteArray>> items;
+  };
+
  signals:  // signals
   /**
    * @brief Signal to notify the clipboard change occurrence use
    * the parameter or get method to get the clipboard data
    * @param items clipboard data
+   * @param fingerprint fingerprint of the items taken when read
    */
-  void OnClipboardChange(QVector<QPair<QString, QByteArray>>);
+  void OnClipboardChange(QVector<QPair<QString, QByteArray>>, quint64 fingerprint);
 
  private:  // members
 
   PlatformClipboard *m_clipboard = PlatformClipboard::instance();
 
+  QTimer *m_debounce = new QTimer(this);
+
+  CaptureSequence m_sequence;
+
+  std::optional<quint64> m_fingerprint;
+
  private:  // just for Qt
 
   /// @brief Qt meta object
@@ -54,12 +87,41 @@ class ApplicationClipboard : public QObject {
   /// @brief Slot to notify the clipboard change
   void onClipboardChangeImpl(QClipboard::Mode mode);
 
+  /// @brief Read the clipboard once the changes settled
+  void onDebounceTimeout();
+
+ private:  // private functions
+
+  /**
+   * @brief Read the clipboard, an image encode in flight stops once
+   * the cancelled flag is set and content with the previous fingerprint
+   * is not encoded and gives no items
+   */
+  QFuture<Capture> read(std::shared_ptr<std::atomic_bool> cancelled, std::optional<quint64> previous) const;
+
  private:  // mime types
 
   const QString MIME_TYPE_TEXT  = "text/plain";
   const QString MIME_TYPE_PNG   = "image/png";
+  const QString MIME_TYPE_JPEG  = "image/jpeg";
+  const QString MIME_TYPE_WEBP  = "image/webp";
   const QString MIME_TYPE_HTML  = "text/html";
 
+ private: // encoded image formats
+
+  /**
+   * @brief Clipboard formats holding encoded images and the mime type
+   * they are synced as, lossless first, the bytes are taken as they are
+   * so no image is decoded and encoded again, Windows exposes the PNG
+   * registered format under its own name
+   */
+  const QVector<QPair<QString, QString>> ENCODED_IMAGE_FORMATS = {
+    {"image/png", MIME_TYPE_PNG},
+    {"application/x-qt-windows-mime;value=\"PNG\"", MIME_TYPE_PNG},
+    {"image/webp", MIME_TYPE_WEBP},
+    {"image/jpeg", MIME_TYPE_JPEG},
+  };
+
  private: // image type
 
   const char* IMAGE_TYPE_PNG = "PNG";
@@ -87,12 +149,28 @@ class ApplicationClipboard : public QObject {
    */
   void clear();
 
+  /**
+   * @brief Set the window in ms that clipboard changes are coalesced in
+   */
+  void setDebounceInterval(int msec);
+
+  /**
+   * @brief Get the window in ms that clipboard changes are coalesced in
+   */
+  int getDebounceInterval() const;
+
+  /**
+   * @brief Get the counts of the capture pipeline
+   */
+  CaptureStats getCaptureStats() const;
+
   /**
    * @brief Set the clipboard data to the clipboard
    *
    * @param mime mime type of the data
    * @param data data to be set
+   * @param fingerprint fingerprint of the data
    */
-  void set(const QVector<QPair<QString, QByteArray>> data);
+  void set(const QVector<QPair<QString, QByteArray>> data, quint64 fingerprint);
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::clipboard
@@ -0,0 +1,65 @@
+#include "capturesequence.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::clipboard {
+/**
+ * @brief Record a change of the clipboard, the running captures are
+ * cancelled
+ */
+void CaptureSequence::changed(bool pending) {
+  m_stats.changes++;
+
+  // every change supersedes the captures before it
+  m_generation++;
+
+  // older captures were cancelled by the changes after them
+  if (m_cancelled) {
+    m_cancelled->store(true);
+    m_cancelled.reset();
+    m_stats.superseded++;
+  }
+
+  if (pending) {
+    m_stats.coalesced++;
+  }
+}
+
+/**
+ * @brief Start a capture of the current generation
+ */
+CaptureSequence::Ticket CaptureSequence::begin() {
+  m_cancelled = std::make_shared<std::atomic_bool>(false);
+  m_stats.captures++;
+
+  return Ticket{m_generation, m_cancelled};
+}
+
+/**
+ * @brief End the capture of the ticket
+ */
+bool CaptureSequence::finish(const Ticket& ticket) {
+  if (ticket.cancelled == m_cancelled) {
+    m_cancelled.reset();
+  }
+
+  if (ticket.generation != m_generation) {
+    m_stats.discarded++;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Record a capture whose content was already synced
+ */
+void CaptureSequence::unchanged() {
+  m_stats.unchanged++;
+}
+
+/**
+ * @brief Get the counts of the capture pipeline
+ */
+CaptureSequence::Stats CaptureSequence::getStats() const {
+  return m_stats;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::clipboard
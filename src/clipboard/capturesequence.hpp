@@ -0,0 +1,81 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QtGlobal>
+
+// Standard header
+#include <atomic>
+#include <memory>
+
+namespace srilakshmikanthanp::clipbirdesk::clipboard {
+/**
+ * @brief Orders the captures of the clipboard, every change supersedes
+ * the captures before it, a running capture is asked to stop and the
+ * result of a superseded capture is discarded even if it finishes last
+ */
+class CaptureSequence {
+ public:  // types
+
+  /**
+   * @brief Counts of the capture pipeline, a change coalesced by the
+   * debounce is a read, encode and sync avoided, a capture superseded
+   * while running has its encode stopped, a discarded capture is a sync
+   * avoided and an unchanged capture is an encode and sync avoided
+   */
+  struct Stats {
+    quint64 changes    = 0;
+    quint64 captures   = 0;
+    quint64 coalesced  = 0;
+    quint64 superseded = 0;
+    quint64 discarded  = 0;
+    quint64 unchanged  = 0;
+  };
+
+  /**
+   * @brief Generation a capture was started in and its cancel flag
+   */
+  struct Ticket {
+    quint64 generation = 0;
+    std::shared_ptr<std::atomic_bool> cancelled;
+  };
+
+ private:  // members
+
+  quint64 m_generation = 0;
+
+  // flag of the capture running in the current generation
+  std::shared_ptr<std::atomic_bool> m_cancelled;
+
+  Stats m_stats;
+
+ public:  // functions
+
+  /**
+   * @brief Record a change of the clipboard, the running captures are
+   * cancelled
+   * @param pending a change is already waiting for its capture
+   */
+  void changed(bool pending);
+
+  /**
+   * @brief Start a capture of the current generation
+   */
+  Ticket begin();
+
+  /**
+   * @brief End the capture of the ticket
+   * @return true if no change came after it was started
+   */
+  bool finish(const Ticket& ticket);
+
+  /**
+   * @brief Record a capture whose content was already synced
+   */
+  void unchanged();
+
+  /**
+   * @brief Get the counts of the capture pipeline
+   */
+  Stats getStats() const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::clipboard
@@ -0,0 +1,87 @@
+#include "lazymimedata.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::clipboard {
+/**
+ * @brief Encoded image of the items if any
+ */
+const QByteArray* LazyMimeData::encodedImage() const {
+  for (const auto& [mime, data] : items) {
+    if (mime.startsWith("image/")) return &data;
+  }
+
+  return nullptr;
+}
+
+/**
+ * @brief Convert the payload of the mime type on request, images are
+ * decoded once on the first request and text is decoded as utf-8
+ */
+QVariant LazyMimeData::retrieveData(const QString& mimeType, QMetaType type) const {
+  if (mimeType == MIME_TYPE_QT_IMAGE) {
+    const auto* data = this->encodedImage();
+
+    if (data == nullptr) {
+      return QVariant();
+    }
+
+    if (!image.has_value()) {
+      image = QImage::fromData(*data);
+    }
+
+    return QVariant(image.value());
+  }
+
+  for (const auto& [mime, data] : items) {
+    if (mime != mimeType) continue;
+
+    if (type.id() == QMetaType::QString) {
+      return QVariant(QString::fromUtf8(data));
+    }
+
+    return QVariant(data);
+  }
+
+  return QVariant();
+}
+
+/**
+ * @brief Construct a new Lazy Mime Data object
+ *
+ * @param items mime type and payload as received
+ */
+LazyMimeData::LazyMimeData(const QVector<QPair<QString, QByteArray>>& items) : items(items) {}
+
+/**
+ * @brief Mime types of the items, images are also offered as image
+ * data where the platform builds its bitmap formats from it
+ */
+QStringList LazyMimeData::formats() const {
+  QStringList formats;
+
+  for (const auto& [mime, data] : items) {
+    formats.append(mime);
+  }
+
+#ifndef __linux__  // X11 and Wayland offer mime types as they are, others read only the image data
+  if (this->encodedImage() != nullptr) {
+    formats.append(MIME_TYPE_QT_IMAGE);
+  }
+#endif
+
+  return formats;
+}
+
+/**
+ * @brief Check whether the mime type is offered
+ */
+bool LazyMimeData::hasFormat(const QString& mimeType) const {
+  return this->formats().contains(mimeType);
+}
+
+/**
+ * @brief Check whether the image has been decoded
+ */
+bool LazyMimeData::isImageDecoded() const noexcept {
+  return image.has_value();
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::clipboard
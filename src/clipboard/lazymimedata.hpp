@@ -0,0 +1,77 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header
+#include <QByteArray>
+#include <QImage>
+#include <QMetaType>
+#include <QMimeData>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+
+// Standard header
+#include <optional>
+
+namespace srilakshmikanthanp::clipbirdesk::clipboard {
+/**
+ * @brief Mime data that keeps the received payloads as they came and
+ * converts one only when a paste target asks for it, most synced items
+ * are never pasted so nothing is decoded on the gui thread up front
+ */
+class LazyMimeData : public QMimeData {
+ private:  // members
+
+  QVector<QPair<QString, QByteArray>> items;
+  mutable std::optional<QImage> image;
+
+ private:  // mime types
+
+  const QString MIME_TYPE_QT_IMAGE = "application/x-qt-image";
+
+ private:  // disable copy and move
+
+  Q_DISABLE_COPY_MOVE(LazyMimeData)
+
+ private:  // private functions
+
+  /**
+   * @brief Encoded image of the items if any
+   */
+  const QByteArray* encodedImage() const;
+
+ protected:  // QMimeData
+
+  /**
+   * @brief Convert the payload of the mime type on request, images are
+   * decoded once on the first request and text is decoded as utf-8
+   */
+  QVariant retrieveData(const QString& mimeType, QMetaType type) const override;
+
+ public:  // constructor
+
+  /**
+   * @brief Construct a new Lazy Mime Data object
+   *
+   * @param items mime type and payload as received
+   */
+  explicit LazyMimeData(const QVector<QPair<QString, QByteArray>>& items);
+
+  /**
+   * @brief Mime types of the items, images are also offered as image
+   * data where the platform builds its bitmap formats from it
+   */
+  QStringList formats() const override;
+
+  /**
+   * @brief Check whether the mime type is offered
+   */
+  bool hasFormat(const QString& mimeType) const override;
+
+  /**
+   * @brief Check whether the image has been decoded
+   */
+  bool isImageDecoded() const noexcept;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::clipboard
@@ -24,6 +24,7 @@ class TrustedClients : public QObject {
 
   virtual QList<TrustedClient> getTrustedClients()            = 0;
   virtual bool isTrustedClient(const TrustedClient& client)   = 0;
+  virtual bool isTrustedClientFingerprint(const QString& name, const QByteArray& fingerprint) = 0;
   virtual bool hasTrustedClient(const QString& name)          = 0;
   virtual void addTrustedClient(const TrustedClient& client)  = 0;
   virtual void removeTrustedClient(const QString& name)       = 0;
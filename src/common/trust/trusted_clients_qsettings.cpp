@@ -1,45 +1,86 @@
 #include "trusted_clients_qsettings.hpp"
 
+#include "utility/functions/crypto/crypto.hpp"
+
 namespace srilakshmikanthanp::clipbirdesk::common::trust {
-TrustedClientsQSettings::TrustedClientsQSettings(QObject* parent): TrustedClients(parent) {}
-TrustedClientsQSettings::~TrustedClientsQSettings() {}
+void TrustedClientsQSettings::flush() {
+  QWriteLocker locker(&lock);
+  settings->beginGroup(trustedClientsGroup);
+  for (const QString& name : std::as_const(dirty)) {
+    if (certificates.contains(name)) {
+      settings->setValue(name, certificates.value(name));
+    } else {
+      settings->remove(name);
+    }
+  }
+  settings->endGroup();
+  settings->sync();
+  dirty.clear();
+}
 
-QList<TrustedClient> TrustedClientsQSettings::getTrustedClients() {
-  QList<TrustedClient> clients;
+TrustedClientsQSettings::TrustedClientsQSettings(QObject* parent): TrustedClients(parent) {
+  // load once, lookups and updates are served from the cache
   settings->beginGroup(trustedClientsGroup);
-  QStringList keys = settings->allKeys();
-  for (const QString& key : keys) {
-    clients.append(TrustedClient{key, settings->value(key).toByteArray()});
+  for (const QString& key : settings->allKeys()) {
+    const auto certificate = settings->value(key).toByteArray();
+    certificates.insert(key, certificate);
+    fingerprints.insert(key, utility::functions::fingerprint(certificate));
   }
   settings->endGroup();
+
+  flushTimer->setSingleShot(true);
+  flushTimer->setInterval(flushDelay);
+  connect(flushTimer, &QTimer::timeout, this, &TrustedClientsQSettings::flush);
+}
+
+TrustedClientsQSettings::~TrustedClientsQSettings() {
+  if (!dirty.isEmpty()) flush();
+}
+
+QList<TrustedClient> TrustedClientsQSettings::getTrustedClients() {
+  QReadLocker locker(&lock);
+  QList<TrustedClient> clients;
+  for (auto itr = certificates.cbegin(); itr != certificates.cend(); ++itr) {
+    clients.append(TrustedClient{itr.key(), itr.value()});
+  }
   return clients;
 }
 
 bool TrustedClientsQSettings::hasTrustedClient(const QString& name) {
-  settings->beginGroup(trustedClientsGroup);
-  bool exists = settings->contains(name);
-  settings->endGroup();
-  return exists;
+  QReadLocker locker(&lock);
+  return certificates.contains(name);
 }
 
 bool TrustedClientsQSettings::isTrustedClient(const TrustedClient& client) {
-  settings->beginGroup(trustedClientsGroup);
-  QByteArray storedCert = settings->value(client.name).toByteArray();
-  settings->endGroup();
-  return storedCert == client.certificate;
+  QReadLocker locker(&lock);
+  const auto itr = certificates.constFind(client.name);
+  return itr != certificates.cend() && itr.value() == client.certificate;
+}
+
+bool TrustedClientsQSettings::isTrustedClientFingerprint(const QString& name, const QByteArray& fingerprint) {
+  QReadLocker locker(&lock);
+  // keyed by name, names may share a certificate
+  const auto itr = fingerprints.constFind(name);
+  return itr != fingerprints.cend() && itr.value() == fingerprint;
 }
 
 void TrustedClientsQSettings::addTrustedClient(const TrustedClient& client) {
-  settings->beginGroup(trustedClientsGroup);
-  settings->setValue(client.name, client.certificate);
-  settings->endGroup();
+  QWriteLocker locker(&lock);
+  certificates.insert(client.name, client.certificate);
+  fingerprints.insert(client.name, utility::functions::fingerprint(client.certificate));
+  dirty.insert(client.name);
+  locker.unlock();
+  QMetaObject::invokeMethod(flushTimer, qOverload<>(&QTimer::start));
   emit trustedClientsChanged(getTrustedClients());
 }
 
 void TrustedClientsQSettings::removeTrustedClient(const QString& name) {
-  settings->beginGroup(trustedClientsGroup);
-  settings->remove(name);
-  settings->endGroup();
+  QWriteLocker locker(&lock);
+  certificates.remove(name);
+  fingerprints.remove(name);
+  dirty.insert(name);
+  locker.unlock();
+  QMetaObject::invokeMethod(flushTimer, qOverload<>(&QTimer::start));
   emit trustedClientsChanged(getTrustedClients());
 }
 }
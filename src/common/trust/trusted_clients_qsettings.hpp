@@ -1,6 +1,10 @@
 #pragma once
 
+#include <QHash>
+#include <QReadWriteLock>
+#include <QSet>
 #include <QSettings>
+#include <QTimer>
 
 #include "common/trust/trusted_clients.hpp"
 
@@ -10,6 +14,18 @@ class TrustedClientsQSettings : public TrustedClients {
 
   QSettings *settings = new QSettings("srilakshmikanthanp", "clipbird", this);
 
+ private:  // cache, sessions read it from the syncing thread
+
+  mutable QReadWriteLock lock;
+  QHash<QString, QByteArray> certificates;
+  QHash<QString, QByteArray> fingerprints;
+  QSet<QString> dirty;
+  QTimer *flushTimer = new QTimer(this);
+
+ private:  // write behind delay
+
+  static constexpr int flushDelay = 1000;
+
  private: // groups
 
   static constexpr const char* trustedClientsGroup = "trustedClients";
@@ -22,12 +38,17 @@ class TrustedClientsQSettings : public TrustedClients {
 
   Q_OBJECT
 
+ private:  // methods
+
+  void flush();
+
  public:
   explicit TrustedClientsQSettings(QObject* parent = nullptr);
   virtual ~TrustedClientsQSettings();
 
   virtual QList<TrustedClient> getTrustedClients()            override;
   virtual bool isTrustedClient(const TrustedClient& client)   override;
+  virtual bool isTrustedClientFingerprint(const QString& name, const QByteArray& fingerprint) override;
   virtual bool hasTrustedClient(const QString& name)          override;
   virtual void addTrustedClient(const TrustedClient& client)  override;
   virtual void removeTrustedClient(const QString& name)       override;
@@ -23,6 +23,7 @@ class TrustedServers : public QObject {
 
   virtual QList<TrustedServer> getTrustedServers()            = 0;
   virtual bool isTrustedServer(const TrustedServer& server)   = 0;
+  virtual bool isTrustedServerFingerprint(const QString& name, const QByteArray& fingerprint) = 0;
   virtual bool hasTrustedServer(const QString& name)          = 0;
   virtual void addTrustedServer(const TrustedServer& server)  = 0;
   virtual void removeTrustedServer(const QString& name)       = 0;
@@ -1,45 +1,86 @@
 #include "trusted_servers_qsettings.hpp"
 
+#include "utility/functions/crypto/crypto.hpp"
+
 namespace srilakshmikanthanp::clipbirdesk::common::trust {
-TrustedServersQSettings::TrustedServersQSettings(QObject* parent): TrustedServers(parent) {}
-TrustedServersQSettings::~TrustedServersQSettings() {}
+void TrustedServersQSettings::flush() {
+  QWriteLocker locker(&lock);
+  settings->beginGroup(trustedServersGroup);
+  for (const QString& name : std::as_const(dirty)) {
+    if (certificates.contains(name)) {
+      settings->setValue(name, certificates.value(name));
+    } else {
+      settings->remove(name);
+    }
+  }
+  settings->endGroup();
+  settings->sync();
+  dirty.clear();
+}
 
-QList<TrustedServer> TrustedServersQSettings::getTrustedServers() {
-  QList<TrustedServer> servers;
+TrustedServersQSettings::TrustedServersQSettings(QObject* parent): TrustedServers(parent) {
+  // load once, lookups and updates are served from the cache
   settings->beginGroup(trustedServersGroup);
-  QStringList keys = settings->allKeys();
-  for (const QString& key : keys) {
-    servers.append(TrustedServer{key, settings->value(key).toByteArray()});
+  for (const QString& key : settings->allKeys()) {
+    const auto certificate = settings->value(key).toByteArray();
+    certificates.insert(key, certificate);
+    fingerprints.insert(key, utility::functions::fingerprint(certificate));
   }
   settings->endGroup();
+
+  flushTimer->setSingleShot(true);
+  flushTimer->setInterval(flushDelay);
+  connect(flushTimer, &QTimer::timeout, this, &TrustedServersQSettings::flush);
+}
+
+TrustedServersQSettings::~TrustedServersQSettings() {
+  if (!dirty.isEmpty()) flush();
+}
+
+QList<TrustedServer> TrustedServersQSettings::getTrustedServers() {
+  QReadLocker locker(&lock);
+  QList<TrustedServer> servers;
+  for (auto itr = certificates.cbegin(); itr != certificates.cend(); ++itr) {
+    servers.append(TrustedServer{itr.key(), itr.value()});
+  }
   return servers;
 }
 
 bool TrustedServersQSettings::hasTrustedServer(const QString& name) {
-  settings->beginGroup(trustedServersGroup);
-  bool exists = settings->contains(name);
-  settings->endGroup();
-  return exists;
+  QReadLocker locker(&lock);
+  return certificates.contains(name);
 }
 
 bool TrustedServersQSettings::isTrustedServer(const TrustedServer& server) {
-  settings->beginGroup(trustedServersGroup);
-  QByteArray storedCert = settings->value(server.name).toByteArray();
-  settings->endGroup();
-  return storedCert == server.certificate;
+  QReadLocker locker(&lock);
+  const auto itr = certificates.constFind(server.name);
+  return itr != certificates.cend() && itr.value() == server.certificate;
+}
+
+bool TrustedServersQSettings::isTrustedServerFingerprint(const QString& name, const QByteArray& fingerprint) {
+  QReadLocker locker(&lock);
+  // keyed by name, names may share a certificate
+  const auto itr = fingerprints.constFind(name);
+  return itr != fingerprints.cend() && itr.value() == fingerprint;
 }
 
 void TrustedServersQSettings::addTrustedServer(const TrustedServer& server) {
-  settings->beginGroup(trustedServersGroup);
-  settings->setValue(server.name, server.certificate);
-  settings->endGroup();
+  QWriteLocker locker(&lock);
+  certificates.insert(server.name, server.certificate);
+  fingerprints.insert(server.name, utility::functions::fingerprint(server.certificate));
+  dirty.insert(server.name);
+  locker.unlock();
+  QMetaObject::invokeMethod(flushTimer, qOverload<>(&QTimer::start));
   emit trustedServersChanged(getTrustedServers());
 }
 
 void TrustedServersQSettings::removeTrustedServer(const QString& name) {
-  settings->beginGroup(trustedServersGroup);
-  settings->remove(name);
-  settings->endGroup();
+  QWriteLocker locker(&lock);
+  certificates.remove(name);
+  fingerprints.remove(name);
+  dirty.insert(name);
+  locker.unlock();
+  QMetaObject::invokeMethod(flushTimer, qOverload<>(&QTimer::start));
   emit trustedServersChanged(getTrustedServers());
 }
 }
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <QHash>
+#include <QReadWriteLock>
+#include <QSet>
 #include <QSettings>
+#include <QTimer>
 
 #include "common/trust/trusted_servers.hpp"
 
@@ -10,6 +14,18 @@ class TrustedServersQSettings : public TrustedServers {
 
   QSettings *settings = new QSettings("srilakshmikanthanp", "clipbird", this);
 
+ private:  // cache, sessions read it from the syncing thread
+
+  mutable QReadWriteLock lock;
+  QHash<QString, QByteArray> certificates;
+  QHash<QString, QByteArray> fingerprints;
+  QSet<QString> dirty;
+  QTimer *flushTimer = new QTimer(this);
+
+ private:  // write behind delay
+
+  static constexpr int flushDelay = 1000;
+
  private: // groups
 
   static constexpr const char* trustedServersGroup = "trustedServers";
@@ -22,12 +38,17 @@ class TrustedServersQSettings : public TrustedServers {
 
   Q_OBJECT
 
+ private:  // methods
+
+  void flush();
+
  public:
   explicit TrustedServersQSettings(QObject* parent = nullptr);
   virtual ~TrustedServersQSettings();
 
   virtual QList<TrustedServer> getTrustedServers()            override;
   virtual bool isTrustedServer(const TrustedServer& server)   override;
+  virtual bool isTrustedServerFingerprint(const QString& name, const QByteArray& fingerprint) override;
   virtual bool hasTrustedServer(const QString& name)          override;
   virtual void addTrustedServer(const TrustedServer& server)  override;
   virtual void removeTrustedServer(const QString& name)       override;
@@ -33,4 +33,16 @@ enum HostType: quint32 {
   CLIENT = 0x01,
   NONE   = 0x03
 };
+
+/// @brief Transport of a connection
+enum Transport : quint32 {
+  Network   = 0x00,
+  Bluetooth = 0x01
+};
+
+/// @brief Encoding of a clipboard item payload on the wire
+enum Encoding : quint32 {
+  Identity = 0x00,
+  Deflate  = 0x01
+};
 }  // namespace srilakshmikanthanp::clipbirdesk::types::enums
@@ -72,6 +72,13 @@ std::string getAppLogFile() {
   return (std::filesystem::path(getAppHome()) / "clipbird.log").string();
 }
 
+/**
+ * @brief Get App History Directory
+ */
+std::string getAppHistoryDirectory() {
+  return (std::filesystem::path(getAppHome()) / "history").string();
+}
+
 /**
  * @brief Get the App Window Size
  * @return QSize
@@ -154,6 +161,145 @@ long long getAppMaxWriteIdleTime() {
   return 10 * 1000;
 }
 
+/**
+ * @brief Tick of the timer wheel driving session heartbeats in ms
+ */
+long long getAppHeartbeatTick() {
+  return 250;
+}
+
+/**
+ * @brief Clipboard items larger than this are streamed in chunks
+ */
+long long getAppStreamThreshold() {
+  return 1024LL * 1024LL;
+}
+
+/**
+ * @brief Size of the payload in each stream chunk
+ */
+long long getAppStreamChunkSize() {
+  return 64LL * 1024LL;
+}
+
+/**
+ * @brief Max bytes a stream keeps queued on the socket
+ */
+long long getAppStreamWindowSize() {
+  return 1024LL * 1024LL;
+}
+
+/**
+ * @brief Max bytes a received stream keeps in memory before
+ * spooling the items to a temporary file
+ */
+long long getAppStreamSpoolThreshold() {
+  return 4LL * 1024LL * 1024LL;
+}
+
+/**
+ * @brief Max bytes a session hands to its socket, frames above this
+ * wait in the session queue
+ */
+long long getAppSessionHighWaterMark() {
+  return 1024LL * 1024LL;
+}
+
+/**
+ * @brief Max seconds a TLS session ticket is offered for resumption
+ */
+long long getAppTlsTicketLifetime() {
+  return 24LL * 60LL * 60LL;
+}
+
+/**
+ * @brief ALPN protocol offered in the TLS handshake, a peer that
+ * negotiates it understands the CapabilityPacket
+ */
+const char* getAppProtocolName() {
+  return "clipbird/2";
+}
+
+/**
+ * @brief Max milliseconds a direct connect to the last known server
+ * endpoint may take before discovery is relied on
+ */
+long long getAppDirectConnectTimeout() {
+  return 3000;
+}
+
+/**
+ * @brief Clipboard items larger than this are offered by hash before
+ * their payloads are sent
+ */
+long long getAppSyncOfferThreshold() {
+  return 16LL * 1024LL;
+}
+
+/**
+ * @brief Max bytes of payloads kept by hash to answer offers
+ */
+long long getAppContentStoreSize() {
+  return 64LL * 1024LL * 1024LL;
+}
+
+/**
+ * @brief Clipboard items smaller than this are sent uncompressed
+ */
+long long getAppCompressionThreshold() {
+  return 1024LL;
+}
+
+/**
+ * @brief Max bytes a compressed payload may decode to
+ */
+long long getAppMaxDecodedLength() {
+  return 256LL * 1024LL * 1024LL;
+}
+
+/**
+ * @brief Default window in ms that clipboard changes are coalesced in
+ * before the clipboard is read
+ */
+long long getAppClipboardDebounce() {
+  return 150;
+}
+
+/**
+ * @brief Max window in ms the clipboard debounce can be set to
+ */
+long long getAppMaxClipboardDebounce() {
+  return 2000;
+}
+
+/**
+ * @brief Bytes a history segment grows to before a new one is started
+ */
+long long getAppHistorySegmentSize() {
+  return 64LL * 1024LL * 1024LL;
+}
+
+/**
+ * @brief Max entries the history depth can be set to
+ */
+long long getAppMaxHistoryDepth() {
+  return 50000;
+}
+
+/**
+ * @brief Bytes of decoded thumbnails kept for the QML image provider
+ */
+long long getAppThumbnailCacheSize() {
+  return 32LL * 1024LL * 1024LL;
+}
+
+/**
+ * @brief Bytes of an entry's text the history search indexes
+ */
+long long getAppSearchTextLength() {
+  return 1024;
+}
+
 /**
  * @brief Used to get Keyboard shortcut for Clipbird history
  */
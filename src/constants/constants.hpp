@@ -65,6 +65,11 @@ std::string getAppHome();
  */
 std::string getAppLogFile();
 
+/**
+ * @brief Get App History Directory
+ */
+std::string getAppHistoryDirectory();
+
 /**
  * @brief Get the App Home Page
  *
@@ -127,6 +132,108 @@ long long getAppMaxReadIdleTime();
  */
 long long getAppMaxWriteIdleTime();
 
+/**
+ * @brief Tick of the timer wheel driving session heartbeats in ms
+ */
+long long getAppHeartbeatTick();
+
+/**
+ * @brief Clipboard items larger than this are streamed in chunks
+ */
+long long getAppStreamThreshold();
+
+/**
+ * @brief Size of the payload in each stream chunk
+ */
+long long getAppStreamChunkSize();
+
+/**
+ * @brief Max bytes a stream keeps queued on the socket
+ */
+long long getAppStreamWindowSize();
+
+/**
+ * @brief Max bytes a received stream keeps in memory before
+ * spooling the items to a temporary file, the items are still
+ * read back whole once the stream completes
+ */
+long long getAppStreamSpoolThreshold();
+
+/**
+ * @brief Max bytes a session hands to its socket, frames above this
+ * wait in the session queue
+ */
+long long getAppSessionHighWaterMark();
+
+/**
+ * @brief Max seconds a TLS session ticket is offered for resumption
+ */
+long long getAppTlsTicketLifetime();
+
+/**
+ * @brief ALPN protocol offered in the TLS handshake, a peer that
+ * negotiates it understands the CapabilityPacket
+ */
+const char* getAppProtocolName();
+
+/**
+ * @brief Max milliseconds a direct connect to the last known server
+ * endpoint may take before discovery is relied on
+ */
+long long getAppDirectConnectTimeout();
+
+/**
+ * @brief Clipboard items larger than this are offered by hash before
+ * their payloads are sent
+ */
+long long getAppSyncOfferThreshold();
+
+/**
+ * @brief Max bytes of payloads kept by hash to answer offers
+ */
+long long getAppContentStoreSize();
+
+/**
+ * @brief Clipboard items smaller than this are sent uncompressed
+ */
+long long getAppCompressionThreshold();
+
+/**
+ * @brief Max bytes a compressed payload may decode to
+ */
+long long getAppMaxDecodedLength();
+
+/**
+ * @brief Default window in ms that clipboard changes are coalesced in
+ * before the clipboard is read
+ */
+long long getAppClipboardDebounce();
+
+/**
+ * @brief Max window in ms the clipboard debounce can be set to
+ */
+long long getAppMaxClipboardDebounce();
+
+/**
+ * @brief Bytes a history segment grows to before a new one is started
+ */
+long long getAppHistorySegmentSize();
+
+/**
+ * @brief Max entries the history depth can be set to
+ */
+long long getAppMaxHistoryDepth();
+
+/**
+ * @brief Bytes of decoded thumbnails kept for the QML image provider
+ */
+long long getAppThumbnailCacheSize();
+
+/**
+ * @brief Bytes of an entry's text the history search indexes
+ */
+long long getAppSearchTextLength();
+
 /**
  * @brief Used to get Keyboard shortcut for Clipbird history
  */
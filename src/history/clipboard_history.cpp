@@ -1,42 +1,136 @@
 #include "clipboard_history.hpp"
 
+#include <QDateTime>
+#include <QDebug>
+
 namespace srilakshmikanthanp::clipbirdesk::history {
-ClipboardHistory::ClipboardHistory(QObject *parent) : QObject(parent) {}
-ClipboardHistory::~ClipboardHistory() = default;
+void ClipboardHistory::emitTrimmed(int previousSize) {
+  if (const auto oldest = m_store->entryAt(m_store->size() - 1); oldest.has_value()) {
+    m_index.removeOlderThan(oldest->id);
+  }
 
-bool ClipboardHistory::isEqual(const QVector<QPair<QString, QByteArray>> &a, const QVector<QPair<QString, QByteArray>> &b) const {
-  if (a.size() != b.size()) {
-    return false;
+  // the oldest entries beyond the depth are dropped from the end
+  for (int index = previousSize - 1; index >= int(m_store->size()); index--) {
+    emit OnHistoryRemoved(index);
   }
-  for (int i = 0; i < a.size(); i++) {
-    if (a[i].first != b[i].first || a[i].second != b[i].second) {
-      return false;
-    }
+}
+
+ClipboardHistory::ClipboardHistory(QObject *parent) : QObject(parent) {
+  const auto directory = QString::fromStdString(constants::getAppHistoryDirectory());
+  const auto depth     = constants::getAppMaxHistorySize();
+
+  // an unwritable directory must not keep the application from starting
+  try {
+    m_store = std::make_unique<HistoryStore>(directory, depth);
+  } catch (const std::exception &e) {
+    qWarning() << e.what() << "- the history is kept in memory only";
+    m_store = std::make_unique<HistoryStore>(depth);
   }
-  return true;
 }
 
-void ClipboardHistory::addHistory(QVector<QPair<QString, QByteArray>> data) {
-  if (!m_history.isEmpty() && isEqual(m_history.first(), data)) {
+ClipboardHistory::~ClipboardHistory() = default;
+
+void ClipboardHistory::addHistory(const QVector<QPair<QString, QByteArray>> &data, quint64 fingerprint) {
+  if (const auto newest = m_store->entryAt(0); newest.has_value() && newest->fingerprint == fingerprint) {
     return;
   }
-  if (this->m_history.size() + 1 > constants::getAppMaxHistorySize()) {
-    this->m_history.pop_back();
+
+  // an older copy of the same content moves to the top
+  if (const auto older = m_store->findFingerprint(fingerprint); older.has_value()) {
+    const auto index = m_store->indexOf(older->id);
+    m_store->remove(older->id);
+    m_index.remove(older->id);
+    emit OnHistoryRemoved(int(index));
   }
-  emit onClipboard(data);
-  this->m_history.push_front(data);
-  emit OnHistoryChanged(m_history);
+
+  emit onClipboard(data, fingerprint);
+
+  const auto previousSize = int(m_store->size()) + 1;
+
+  try {
+    const auto entry = m_store->append(data, fingerprint, QDateTime::currentMSecsSinceEpoch());
+    if (m_indexed) m_index.add(entry.id, data);
+    emit OnHistoryInserted(0, entry);
+  } catch (const std::exception &e) {
+    qWarning() << e.what();
+    return;
+  }
+
+  this->emitTrimmed(previousSize);
 }
 
 void ClipboardHistory::deleteHistoryAt(int index) {
-  if (index < 0 || index >= m_history.size()) {
+  const auto entry = m_store->entryAt(index);
+
+  if (!entry.has_value()) {
     throw std::runtime_error("Index out of range");
   }
-  m_history.remove(index);
-  emit OnHistoryChanged(m_history);
+
+  m_store->remove(entry->id);
+  m_index.remove(entry->id);
+  emit OnHistoryRemoved(index);
+}
+
+QVector<HistoryEntry> ClipboardHistory::getEntries() const {
+  QVector<HistoryEntry> entries;
+
+  for (qsizetype i = 0; i < m_store->size(); i++) {
+    if (const auto entry = m_store->entryAt(i); entry.has_value()) {
+      entries.append(entry.value());
+    }
+  }
+
+  return entries;
 }
 
-QVector<QVector<QPair<QString, QByteArray>>> ClipboardHistory::getHistory() const {
-  return m_history;
+QVector<QPair<QString, QByteArray>> ClipboardHistory::getItems(quint64 id) const {
+  return m_store->items(id);
+}
+
+QVector<HistoryItemSummary> ClipboardHistory::getSummary(quint64 id, qsizetype headLength) const {
+  return m_store->summary(id, headLength);
+}
+
+void ClipboardHistory::setDepth(int depth) {
+  if (depth == m_store->getDepth()) {
+    return;
+  }
+
+  const auto previousSize = int(m_store->size());
+  m_store->setDepth(depth);
+  this->emitTrimmed(previousSize);
+}
+
+int ClipboardHistory::getDepth() const {
+  return int(m_store->getDepth());
+}
+
+QVector<quint64> ClipboardHistory::search(const QString &query, SearchIndex::Match match) const {
+  // built on the first search from the start of the text items only,
+  // images and other payloads are never read for it
+  if (!m_indexed) {
+    const auto entries = getEntries();
+    const auto length  = qsizetype(constants::getAppSearchTextLength());
+
+    for (auto it = entries.crbegin(); it != entries.crend(); ++it) {
+      QVector<QPair<QString, QByteArray>> text;
+      bool partial = false;
+
+      for (const auto &item : m_store->summary(it->id, length)) {
+        if (item.head.isEmpty()) continue;
+        text.append(qMakePair(item.mimeType, item.head));
+        partial = partial || item.head.size() < item.length;
+      }
+
+      m_index.add(it->id, text, partial);
+    }
+
+    m_indexed = true;
+  }
+
+  // the rest of a long entry is read from the store when checked
+  return m_index.search(query, match, [this](quint64 id) {
+    return m_store->items(id);
+  });
 }
 }
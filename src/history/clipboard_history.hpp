@@ -2,7 +2,12 @@
 
 #include <QObject>
 
+#include <memory>
+
 #include "constants/constants.hpp"
+#include "history/history_store.hpp"
+#include "history/search_index.hpp"
+#include "utility/functions/fingerprint/fingerprint.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::history {
 class ClipboardHistory : public QObject {
@@ -16,7 +21,13 @@ class ClipboardHistory : public QObject {
 
  private:
 
-  QVector<QVector<QPair<QString, QByteArray>>> m_history;
+  std::unique_ptr<HistoryStore> m_store;
+  mutable SearchIndex m_index;
+  mutable bool m_indexed = false;
+
+ private:
+
+  void emitTrimmed(int previousSize);
 
  public:  // Constructors and Destructors
 
@@ -25,16 +36,19 @@ class ClipboardHistory : public QObject {
 
  signals:
 
-  void OnHistoryChanged(QVector<QVector<QPair<QString, QByteArray>>>);
-  void onClipboard(QVector<QPair<QString, QByteArray>>);
-
- private:
-  bool isEqual(const QVector<QPair<QString, QByteArray>> &a, const QVector<QPair<QString, QByteArray>> &b) const;
+  void OnHistoryInserted(int index, history::HistoryEntry entry);
+  void OnHistoryRemoved(int index);
+  void onClipboard(QVector<QPair<QString, QByteArray>>, quint64 fingerprint);
 
  public:  // Member functions
 
-  void addHistory(QVector<QPair<QString, QByteArray>> data);
-  QVector<QVector<QPair<QString, QByteArray>>> getHistory() const;
+  void addHistory(const QVector<QPair<QString, QByteArray>> &data, quint64 fingerprint);
+  QVector<HistoryEntry> getEntries() const;
+  QVector<QPair<QString, QByteArray>> getItems(quint64 id) const;
+  QVector<HistoryItemSummary> getSummary(quint64 id, qsizetype headLength) const;
   void deleteHistoryAt(int index);
+  void setDepth(int depth);
+  int getDepth() const;
+  QVector<quint64> search(const QString &query, SearchIndex::Match match = SearchIndex::Match::Substring) const;
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::controller
@@ -0,0 +1,773 @@
+#include "history_store.hpp"
+
+#include <QDataStream>
+#include <QDebug>
+#include <QMutexLocker>
+#include <QSaveFile>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace srilakshmikanthanp::clipbirdesk::history::internal {
+/**
+ * @brief Start of every record so a torn or foreign tail is detected
+ */
+constexpr quint32 recordMagic = 0x43424852;
+
+/**
+ * @brief Start of a record whose entry was removed and overwritten, the
+ * length is kept so a scan can step over it
+ */
+constexpr quint32 scrubbedMagic = 0x43424858;
+
+/**
+ * @brief Bytes of zeros written at a time over a removed record
+ */
+constexpr qint64 scrubChunkLength = 64 * 1024;
+
+/**
+ * @brief magic, length, id, timestamp, fingerprint and item count
+ */
+constexpr qint64 recordHeaderLength = 4 + 8 + 8 + 8 + 8 + 4;
+
+/**
+ * @brief kind, segment, id, offset, length, timestamp and fingerprint
+ */
+constexpr qint64 indexRecordLength = 4 + 4 + 8 + 8 + 8 + 8 + 8;
+
+/**
+ * @brief Kinds of the index records
+ */
+constexpr quint32 indexAdd    = 1;
+constexpr quint32 indexRemove = 2;
+
+/**
+ * @brief File names of the store
+ */
+const QString indexFileName     = QStringLiteral("index.dat");
+const QString segmentFilePrefix = QStringLiteral("segment-");
+const QString segmentFileSuffix = QStringLiteral(".dat");
+
+/**
+ * @brief Header of a record read from a segment
+ */
+struct RecordHeader {
+  quint32 magic       = 0;
+  quint64 length      = 0;
+  quint64 id          = 0;
+  qint64 timestamp    = 0;
+  quint64 fingerprint = 0;
+  quint32 itemCount   = 0;
+};
+
+RecordHeader readHeader(QDataStream& stream) {
+  RecordHeader header;
+
+  stream >> header.magic;
+  stream >> header.length;
+  stream >> header.id;
+  stream >> header.timestamp;
+  stream >> header.fingerprint;
+  stream >> header.itemCount;
+
+  return header;
+}
+
+/**
+ * @brief Read the items of the record, at most headLength bytes of each
+ * text payload are copied and the rest is skipped, a negative headLength
+ * copies every payload whole, false if the record is not the entry or
+ * is damaged
+ */
+bool readItems(const QByteArray& bytes, quint64 id, qint64 headLength, QVector<HistoryItemSummary>& items) {
+  QDataStream stream(bytes);
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  const auto header = readHeader(stream);
+
+  if (header.magic != recordMagic || header.id != id || header.length != quint64(bytes.size())) {
+    return false;
+  }
+
+  for (quint32 i = 0; i < header.itemCount; i++) {
+    quint32 mimeLength;
+    quint64 payloadLength;
+
+    stream >> mimeLength;
+
+    if (stream.status() != QDataStream::Ok || mimeLength > quint64(stream.device()->bytesAvailable())) {
+      return false;
+    }
+
+    QByteArray mime(mimeLength, Qt::Uninitialized);
+    stream.readRawData(mime.data(), mimeLength);
+    stream >> payloadLength;
+
+    if (stream.status() != QDataStream::Ok || payloadLength > quint64(stream.device()->bytesAvailable())) {
+      return false;
+    }
+
+    const auto isText = mime.startsWith("text/");
+    const auto copied = headLength < 0 ? qint64(payloadLength) : isText ? std::min<qint64>(headLength, qint64(payloadLength)) : 0;
+
+    QByteArray head(qsizetype(copied), Qt::Uninitialized);
+    stream.readRawData(head.data(), qsizetype(copied));
+    stream.skipRawData(qint64(payloadLength) - copied);
+    items.append(HistoryItemSummary{QString::fromUtf8(mime), qint64(payloadLength), head});
+  }
+
+  return true;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::history::internal
+
+namespace srilakshmikanthanp::clipbirdesk::history {
+QString HistoryStore::segmentPath(quint32 number) const {
+  const auto name = QStringLiteral("%1%2%3").arg(internal::segmentFilePrefix).arg(number, 8, 10, QChar('0')).arg(internal::segmentFileSuffix);
+  return directory.filePath(name);
+}
+
+HistoryStore::Segment& HistoryStore::activeSegment() {
+  if (!segments.empty() && segments.rbegin()->second.size < segmentSize) {
+    return segments.rbegin()->second;
+  }
+
+  const quint32 number = segments.empty() ? 1 : segments.rbegin()->first + 1;
+
+  Segment segment;
+  segment.number = number;
+  segment.file   = std::make_unique<QFile>(segmentPath(number));
+
+  if (!segment.file->open(QIODevice::ReadWrite)) {
+    throw std::runtime_error("Unable to open the history segment " + segment.file->fileName().toStdString());
+  }
+
+  return segments.emplace(number, std::move(segment)).first->second;
+}
+
+bool HistoryStore::ensureMapped(Segment& segment, qint64 end) const {
+  if (end <= 0 || end > segment.size) {
+    return false;
+  }
+
+  if (segment.map != nullptr && segment.mapped >= end) {
+    return true;
+  }
+
+  // the segment grew since it was mapped, the new view covers all of it
+  if (segment.map != nullptr) {
+    segment.file->unmap(segment.map);
+    segment.map = nullptr;
+  }
+
+  segment.map    = segment.file->map(0, segment.size);
+  segment.mapped = segment.map != nullptr ? segment.size : 0;
+
+  return segment.map != nullptr;
+}
+
+qsizetype HistoryStore::find(quint64 id) const {
+  const auto it = std::lower_bound(entries.cbegin(), entries.cend(), id, [](const Location& l, quint64 v) {
+    return l.entry.id < v;
+  });
+
+  return it != entries.cend() && it->entry.id == id ? qsizetype(it - entries.cbegin()) : -1;
+}
+
+void HistoryStore::insert(const Location& location) {
+  auto it = std::lower_bound(entries.begin(), entries.end(), location.entry.id, [](const Location& l, quint64 v) {
+    return l.entry.id < v;
+  });
+
+  // the same id again is a record moved by compaction
+  if (it != entries.end() && it->entry.id == location.entry.id) {
+    if (auto old = segments.find(it->segment); old != segments.end()) {
+      old->second.live -= it->length;
+    }
+    *it = location;
+  } else {
+    entries.insert(it, location);
+  }
+
+  if (auto segment = segments.find(location.segment); segment != segments.end()) {
+    segment->second.live += location.length;
+  }
+}
+
+void HistoryStore::removeAt(qsizetype index) {
+  if (auto segment = segments.find(entries[index].segment); segment != segments.end()) {
+    segment->second.live -= entries[index].length;
+  }
+
+  entries.removeAt(index);
+}
+
+void HistoryStore::trim() {
+  while (entries.size() > depth) {
+    writeIndex(internal::indexRemove, entries.first());
+    scrub(entries.first());
+    removeAt(0);
+  }
+}
+
+void HistoryStore::scrub(const Location& location) {
+  if (!persistent) {
+    memoryRecords.remove(location.entry.id);
+    return;
+  }
+
+  const auto it = segments.find(location.segment);
+
+  if (it == segments.end()) {
+    return;
+  }
+
+  auto& file = *it->second.file;
+
+  // the length after the magic stays so the record can still be skipped
+  QByteArray magic;
+  QDataStream stream(&magic, QIODevice::WriteOnly);
+  stream.setByteOrder(QDataStream::BigEndian);
+  stream << internal::scrubbedMagic;
+
+  const auto body  = location.offset + qint64(sizeof(internal::recordMagic) + sizeof(quint64));
+  const auto zeros = QByteArray(qsizetype(std::min<qint64>(location.length, internal::scrubChunkLength)), '\0');
+  bool written     = file.seek(location.offset) && file.write(magic) == magic.size() && file.seek(body);
+
+  for (qint64 at = body; written && at < location.offset + location.length; at += zeros.size()) {
+    const auto length = std::min<qint64>(zeros.size(), location.offset + location.length - at);
+    written = file.write(zeros.constData(), length) == length;
+  }
+
+  if (!written || !file.flush()) {
+    qWarning() << "Unable to overwrite the removed history record" << location.entry.id << file.errorString();
+  }
+}
+
+QByteArray HistoryStore::recordOf(const Location& location) const {
+  if (!persistent) {
+    return memoryRecords.value(location.entry.id);
+  }
+
+  const auto it = segments.find(location.segment);
+
+  if (it == segments.end() || !ensureMapped(it->second, location.offset + location.length)) {
+    return QByteArray();
+  }
+
+  // reading the view pages in only this record
+  return QByteArray::fromRawData(reinterpret_cast<const char*>(it->second.map) + location.offset, location.length);
+}
+
+QVector<HistoryStore::Location> HistoryStore::recover(Segment& segment, quint64 minId) {
+  QVector<Location> found;
+  qint64 offset = 0;
+
+  if (segment.size > 0 && !ensureMapped(segment, segment.size)) {
+    return found;
+  }
+
+  while (segment.size - offset >= internal::recordHeaderLength) {
+    const auto bytes = QByteArray::fromRawData(reinterpret_cast<const char*>(segment.map) + offset, internal::recordHeaderLength);
+    QDataStream stream(bytes);
+    stream.setByteOrder(QDataStream::BigEndian);
+
+    const auto header = internal::readHeader(stream);
+    const auto isLive = header.magic == internal::recordMagic;
+
+    if ((!isLive && header.magic != internal::scrubbedMagic) || header.length < quint64(internal::recordHeaderLength) || header.length > quint64(segment.size - offset)) {
+      break;
+    }
+
+    if (isLive && header.id >= minId) {
+      found.append(Location{{header.id, header.timestamp, header.fingerprint}, segment.number, offset, qint64(header.length)});
+    }
+
+    offset += qint64(header.length);
+  }
+
+  // drop the tail a crash left half written
+  if (offset < segment.size) {
+    qWarning() << "Truncating history segment" << segment.file->fileName() << "at" << offset;
+
+    if (segment.map != nullptr) {
+      segment.file->unmap(segment.map);
+      segment.map    = nullptr;
+      segment.mapped = 0;
+    }
+
+    segment.file->resize(offset);
+    segment.size = offset;
+  }
+
+  return found;
+}
+
+void HistoryStore::writeIndex(quint32 kind, const Location& location) {
+  if (!persistent) {
+    return;
+  }
+
+  QByteArray record;
+  QDataStream stream(&record, QIODevice::WriteOnly);
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  stream << kind;
+  stream << location.segment;
+  stream << location.entry.id;
+  stream << quint64(location.offset);
+  stream << quint64(location.length);
+  stream << location.entry.timestamp;
+  stream << location.entry.fingerprint;
+
+  if (index.write(record) != record.size() || !index.flush()) {
+    qWarning() << "Unable to write the history index" << index.errorString();
+  }
+}
+
+void HistoryStore::rewriteIndex() {
+  QSaveFile file(index.fileName());
+
+  if (!file.open(QIODevice::WriteOnly)) {
+    qWarning() << "Unable to rewrite the history index" << file.errorString();
+    return;
+  }
+
+  QByteArray records;
+  QDataStream stream(&records, QIODevice::WriteOnly);
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  for (const auto& location : entries) {
+    stream << internal::indexAdd;
+    stream << location.segment;
+    stream << location.entry.id;
+    stream << quint64(location.offset);
+    stream << quint64(location.length);
+    stream << location.entry.timestamp;
+    stream << location.entry.fingerprint;
+  }
+
+  file.write(records);
+
+  // the open index would keep the rename from replacing it on windows
+  index.close();
+
+  if (!file.commit()) {
+    qWarning() << "Unable to rewrite the history index" << file.errorString();
+  }
+
+  if (!index.open(QIODevice::ReadWrite | QIODevice::Append)) {
+    qWarning() << "Unable to open the history index" << index.errorString();
+  }
+}
+
+std::optional<quint32> HistoryStore::compactionVictim() const {
+  if (segments.size() < 2) {
+    return std::nullopt;
+  }
+
+  // the newest segment is still appended to so it is never compacted
+  const auto active = segments.rbegin()->first;
+
+  for (const auto& [number, segment] : segments) {
+    if (number != active && segment.live * 2 <= segment.size) {
+      return number;
+    }
+  }
+
+  return std::nullopt;
+}
+
+void HistoryStore::scheduleCompaction() {
+  if (compactionQueued || !compactionVictim().has_value()) {
+    return;
+  }
+
+  compactionQueued = true;
+
+  pool.start([this] {
+    this->compact();
+    QMutexLocker locker(&lock);
+    compactionQueued = false;
+  });
+}
+
+HistoryStore::HistoryStore(const QString& path, qsizetype depth, qint64 segmentSize)
+    : directory(path), segmentSize(segmentSize), depth(std::max<qsizetype>(depth, 1)) {
+  pool.setMaxThreadCount(1);
+
+  if (!directory.mkpath(QStringLiteral("."))) {
+    throw std::runtime_error("Unable to create the history directory " + path.toStdString());
+  }
+
+  const auto names = directory.entryList({internal::segmentFilePrefix + "*" + internal::segmentFileSuffix}, QDir::Files, QDir::Name);
+
+  for (const auto& name : names) {
+    bool ok = false;
+    const auto number = name.mid(internal::segmentFilePrefix.size(), name.size() - internal::segmentFilePrefix.size() - internal::segmentFileSuffix.size()).toUInt(&ok);
+
+    if (!ok) continue;
+
+    Segment segment;
+    segment.number = number;
+    segment.file   = std::make_unique<QFile>(directory.filePath(name));
+
+    if (!segment.file->open(QIODevice::ReadWrite)) {
+      qWarning() << "Unable to open the history segment" << name << segment.file->errorString();
+      continue;
+    }
+
+    segment.size = segment.file->size();
+    segments.emplace(number, std::move(segment));
+  }
+
+  index.setFileName(directory.filePath(internal::indexFileName));
+
+  if (!index.open(QIODevice::ReadWrite)) {
+    throw std::runtime_error("Unable to open the history index " + index.fileName().toStdString());
+  }
+
+  // only the index is read here, the payloads stay on disk
+  const auto records = index.readAll();
+  const auto count   = records.size() / internal::indexRecordLength;
+
+  if (records.size() % internal::indexRecordLength != 0) {
+    index.resize(count * internal::indexRecordLength);
+  }
+
+  QDataStream stream(records);
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  for (qsizetype i = 0; i < count; i++) {
+    quint32 kind, segment;
+    quint64 offset, length;
+    Location location;
+
+    stream >> kind;
+    stream >> segment;
+    stream >> location.entry.id;
+    stream >> offset;
+    stream >> length;
+    stream >> location.entry.timestamp;
+    stream >> location.entry.fingerprint;
+
+    location.segment = segment;
+    location.offset  = qint64(offset);
+    location.length  = qint64(length);
+    nextId           = std::max(nextId, location.entry.id + 1);
+
+    if (kind == internal::indexRemove) {
+      if (const auto at = find(location.entry.id); at != -1) removeAt(at);
+      continue;
+    }
+
+    const auto it = segments.find(segment);
+
+    if (kind == internal::indexAdd && it != segments.end() && offset + length <= quint64(it->second.size)) {
+      insert(location);
+    }
+  }
+
+  index.seek(index.size());
+
+  if (count == 0 && !segments.empty()) {
+    // the index is lost so every segment is scanned, removed records
+    // were overwritten and are skipped
+    for (auto& [number, segment] : segments) {
+      for (const auto& location : recover(segment, 0)) {
+        nextId = std::max(nextId, location.entry.id + 1);
+        insert(location);
+      }
+    }
+
+    rewriteIndex();
+  } else if (!segments.empty()) {
+    // appends the index missed are at the end of the newest segment
+    for (const auto& location : recover(segments.rbegin()->second, nextId)) {
+      nextId = std::max(nextId, location.entry.id + 1);
+      insert(location);
+      writeIndex(internal::indexAdd, location);
+    }
+  }
+
+  this->trim();
+  this->scheduleCompaction();
+}
+
+HistoryStore::HistoryStore(qsizetype depth) : segmentSize(0), depth(std::max<qsizetype>(depth, 1)), persistent(false) {
+  pool.setMaxThreadCount(1);
+}
+
+HistoryStore::~HistoryStore() {
+  pool.waitForDone();
+
+  for (auto& [number, segment] : segments) {
+    if (segment.map != nullptr) segment.file->unmap(segment.map);
+  }
+}
+
+void HistoryStore::setDepth(qsizetype depth) {
+  QMutexLocker locker(&lock);
+  this->depth = std::max<qsizetype>(depth, 1);
+  this->trim();
+  this->scheduleCompaction();
+}
+
+qsizetype HistoryStore::getDepth() const {
+  QMutexLocker locker(&lock);
+  return depth;
+}
+
+qsizetype HistoryStore::size() const {
+  QMutexLocker locker(&lock);
+  return entries.size();
+}
+
+std::optional<HistoryEntry> HistoryStore::entryAt(qsizetype index) const {
+  QMutexLocker locker(&lock);
+
+  if (index < 0 || index >= entries.size()) {
+    return std::nullopt;
+  }
+
+  return entries[entries.size() - 1 - index].entry;
+}
+
+qsizetype HistoryStore::indexOf(quint64 id) const {
+  QMutexLocker locker(&lock);
+  const auto at = find(id);
+  return at == -1 ? -1 : entries.size() - 1 - at;
+}
+
+std::optional<HistoryEntry> HistoryStore::findFingerprint(quint64 fingerprint) const {
+  QMutexLocker locker(&lock);
+
+  for (auto it = entries.crbegin(); it != entries.crend(); ++it) {
+    if (it->entry.fingerprint == fingerprint) return it->entry;
+  }
+
+  return std::nullopt;
+}
+
+HistoryEntry HistoryStore::append(const QVector<QPair<QString, QByteArray>>& items, quint64 fingerprint, qint64 timestamp) {
+  QMutexLocker locker(&lock);
+
+  const auto id = nextId;
+  QByteArray record;
+  QDataStream stream(&record, QIODevice::WriteOnly);
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  // length is patched in once the items are written
+  stream << internal::recordMagic;
+  stream << quint64(0);
+  stream << id;
+  stream << timestamp;
+  stream << fingerprint;
+  stream << quint32(items.size());
+
+  for (const auto& [mimeType, payload] : items) {
+    const auto mime = mimeType.toUtf8();
+    stream << quint32(mime.size());
+    stream.writeRawData(mime.constData(), mime.size());
+    stream << quint64(payload.size());
+    stream.writeRawData(payload.constData(), payload.size());
+  }
+
+  stream.device()->seek(sizeof(internal::recordMagic));
+  stream << quint64(record.size());
+
+  if (!persistent) {
+    const Location location{{id, timestamp, fingerprint}, 0, 0, record.size()};
+    memoryRecords.insert(id, record);
+    nextId = id + 1;
+    this->insert(location);
+    this->trim();
+    return location.entry;
+  }
+
+  auto& segment = this->activeSegment();
+
+  if (!segment.file->seek(segment.size) || segment.file->write(record) != record.size() || !segment.file->flush()) {
+    segment.file->resize(segment.size);
+    throw std::runtime_error("Unable to write the history segment " + segment.file->fileName().toStdString());
+  }
+
+  const Location location{{id, timestamp, fingerprint}, segment.number, segment.size, record.size()};
+
+  segment.size += record.size();
+  nextId = id + 1;
+
+  this->insert(location);
+  this->writeIndex(internal::indexAdd, location);
+  this->trim();
+  this->scheduleCompaction();
+
+  return location.entry;
+}
+
+void HistoryStore::remove(quint64 id) {
+  QMutexLocker locker(&lock);
+
+  if (const auto at = find(id); at != -1) {
+    this->writeIndex(internal::indexRemove, entries[at]);
+    this->scrub(entries[at]);
+    this->removeAt(at);
+    this->scheduleCompaction();
+  }
+}
+
+QVector<QPair<QString, QByteArray>> HistoryStore::items(quint64 id) const {
+  QMutexLocker locker(&lock);
+
+  const auto at = find(id);
+
+  if (at == -1) {
+    return {};
+  }
+
+  // the items are copied out so they outlive a remap
+  QVector<HistoryItemSummary> read;
+
+  if (!internal::readItems(this->recordOf(entries[at]), id, -1, read)) {
+    qWarning() << "History record" << id << "is damaged";
+    return {};
+  }
+
+  QVector<QPair<QString, QByteArray>> items;
+  items.reserve(read.size());
+
+  for (const auto& item : read) {
+    items.append(qMakePair(item.mimeType, item.head));
+  }
+
+  return items;
+}
+
+QVector<HistoryItemSummary> HistoryStore::summary(quint64 id, qsizetype headLength) const {
+  QMutexLocker locker(&lock);
+
+  const auto at = find(id);
+
+  if (at == -1) {
+    return {};
+  }
+
+  QVector<HistoryItemSummary> items;
+
+  if (!internal::readItems(this->recordOf(entries[at]), id, std::max<qsizetype>(headLength, 0), items)) {
+    qWarning() << "History record" << id << "is damaged";
+    return {};
+  }
+
+  return items;
+}
+
+qint64 HistoryStore::deadBytes() const {
+  QMutexLocker locker(&lock);
+  qint64 dead = 0;
+
+  for (const auto& [number, segment] : segments) {
+    dead += segment.size - segment.live;
+  }
+
+  return dead;
+}
+
+qsizetype HistoryStore::segmentCount() const {
+  QMutexLocker locker(&lock);
+  return qsizetype(segments.size());
+}
+
+void HistoryStore::compact() {
+  QMutexLocker compacting(&compactLock);
+
+  while (true) {
+    QVector<Location> moving;
+    QString path;
+    quint32 victim = 0;
+
+    {
+      QMutexLocker locker(&lock);
+      const auto found = this->compactionVictim();
+
+      if (!found.has_value()) {
+        return;
+      }
+
+      victim = found.value();
+      path   = segments.at(victim).file->fileName();
+
+      for (const auto& location : entries) {
+        if (location.segment == victim) moving.append(location);
+      }
+    }
+
+    // a sealed segment is not written to any more so it is read unlocked
+    QVector<QByteArray> records;
+    QFile reader(path);
+
+    if (!moving.isEmpty() && !reader.open(QIODevice::ReadOnly)) {
+      qWarning() << "Unable to compact the history segment" << path << reader.errorString();
+      return;
+    }
+
+    for (const auto& location : moving) {
+      reader.seek(location.offset);
+      records.append(reader.read(location.length));
+    }
+
+    reader.close();
+
+    QMutexLocker locker(&lock);
+
+    for (qsizetype i = 0; i < moving.size(); i++) {
+      const auto at = find(moving[i].entry.id);
+
+      // removed or trimmed while it was read
+      if (at == -1 || entries[at].segment != victim || entries[at].offset != moving[i].offset) {
+        continue;
+      }
+
+      if (records[i].size() != moving[i].length) {
+        qWarning() << "Unable to read the history record" << moving[i].entry.id;
+        return;
+      }
+
+      Segment* segment = nullptr;
+
+      try {
+        segment = &this->activeSegment();
+      } catch (const std::exception& e) {
+        qWarning() << e.what();
+        return;
+      }
+
+      if (!segment->file->seek(segment->size) || segment->file->write(records[i]) != records[i].size() || !segment->file->flush()) {
+        segment->file->resize(segment->size);
+        qWarning() << "Unable to write the history segment" << segment->file->errorString();
+        return;
+      }
+
+      const Location location{moving[i].entry, segment->number, segment->size, moving[i].length};
+      segment->size += moving[i].length;
+      this->insert(location);
+    }
+
+    // the index must not point into the victim once it is gone
+    this->rewriteIndex();
+
+    auto& segment = segments.at(victim);
+
+    if (segment.map != nullptr) {
+      segment.file->unmap(segment.map);
+    }
+
+    segment.file->close();
+    segment.file->remove();
+    segments.erase(victim);
+  }
+}
+
+void HistoryStore::waitForCompaction() {
+  pool.waitForDone();
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::history
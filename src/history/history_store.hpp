@@ -0,0 +1,212 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header files
+#include <QByteArray>
+#include <QDir>
+#include <QFile>
+#include <QHash>
+#include <QMutex>
+#include <QPair>
+#include <QString>
+#include <QThreadPool>
+#include <QVector>
+#include <QtTypes>
+
+// Standard header files
+#include <map>
+#include <memory>
+#include <optional>
+
+// Local header files
+#include "constants/constants.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::history {
+/**
+ * @brief Metadata of a history entry, the items are read on demand
+ */
+struct HistoryEntry {
+  quint64 id          = 0;
+  qint64 timestamp    = 0;
+  quint64 fingerprint = 0;
+};
+
+/**
+ * @brief An item of a history entry without its payload, the length of
+ * the payload and for text at most the requested bytes from its start
+ */
+struct HistoryItemSummary {
+  QString mimeType;
+  qint64 length = 0;
+  QByteArray head;
+};
+
+/**
+ * @brief Clipboard history kept on disk, entries are appended to segment
+ * files that are memory mapped for reads and a compact index of fixed
+ * size records locates them, only the index is read on open so the
+ * payloads are paged in when an entry is read, segments that are mostly
+ * removed entries are compacted in the background, the bytes of removed
+ * entries are overwritten at once so nothing deleted stays readable, a
+ * store opened without a directory keeps its records in memory only
+ */
+class HistoryStore {
+ private:
+
+  Q_DISABLE_COPY_MOVE(HistoryStore)
+
+ private:
+
+  struct Segment {
+    quint32 number = 0;
+    std::unique_ptr<QFile> file;
+    uchar* map    = nullptr;
+    qint64 mapped = 0;
+    qint64 size   = 0;
+    qint64 live   = 0;
+  };
+
+  struct Location {
+    HistoryEntry entry;
+    quint32 segment = 0;
+    qint64 offset   = 0;
+    qint64 length   = 0;
+  };
+
+ private:
+
+  mutable QMutex lock;
+  QMutex compactLock;
+  QDir directory;
+  qint64 segmentSize;
+  qsizetype depth;
+  QFile index;
+  mutable std::map<quint32, Segment> segments;
+  QVector<Location> entries;
+  quint64 nextId = 1;
+  bool compactionQueued = false;
+  QThreadPool pool;
+  bool persistent = true;
+  QHash<quint64, QByteArray> memoryRecords;
+
+ private:
+
+  QString segmentPath(quint32 number) const;
+  Segment& activeSegment();
+  bool ensureMapped(Segment& segment, qint64 end) const;
+  qsizetype find(quint64 id) const;
+  void insert(const Location& location);
+  void removeAt(qsizetype index);
+  void trim();
+  void scrub(const Location& location);
+  QByteArray recordOf(const Location& location) const;
+  QVector<Location> recover(Segment& segment, quint64 minId);
+  void writeIndex(quint32 kind, const Location& location);
+  void rewriteIndex();
+  std::optional<quint32> compactionVictim() const;
+  void scheduleCompaction();
+
+ public:
+
+  /**
+   * @brief Open the store in the directory, creating it if needed, and
+   * load the index, entries written after the index was last saved are
+   * recovered from the newest segment
+   *
+   * @param directory directory of the segments and index
+   * @param depth max entries kept, the oldest are removed first
+   * @param segmentSize bytes a segment grows to before a new one is started
+   */
+  HistoryStore(const QString& directory, qsizetype depth, qint64 segmentSize = constants::getAppHistorySegmentSize());
+
+  /**
+   * @brief Open a store that keeps its records in memory, used when the
+   * history directory can not be written, nothing survives a restart
+   *
+   * @param depth max entries kept, the oldest are removed first
+   */
+  explicit HistoryStore(qsizetype depth);
+
+  /**
+   * @brief Wait for a running compaction and close the files
+   */
+  ~HistoryStore();
+
+  /**
+   * @brief Set the max entries kept, the oldest beyond it are removed
+   */
+  void setDepth(qsizetype depth);
+
+  /**
+   * @brief Get the max entries kept
+   */
+  qsizetype getDepth() const;
+
+  /**
+   * @brief Number of entries
+   */
+  qsizetype size() const;
+
+  /**
+   * @brief Entry at the index, newest first
+   */
+  std::optional<HistoryEntry> entryAt(qsizetype index) const;
+
+  /**
+   * @brief Index of the entry, newest first, -1 if it is gone
+   */
+  qsizetype indexOf(quint64 id) const;
+
+  /**
+   * @brief Newest entry with the fingerprint
+   */
+  std::optional<HistoryEntry> findFingerprint(quint64 fingerprint) const;
+
+  /**
+   * @brief Append the items as the newest entry, throws std::runtime_error
+   * if the segment can not be written
+   */
+  HistoryEntry append(const QVector<QPair<QString, QByteArray>>& items, quint64 fingerprint, qint64 timestamp);
+
+  /**
+   * @brief Remove the entry, its record is overwritten in place and the
+   * space is reclaimed by compaction
+   */
+  void remove(quint64 id);
+
+  /**
+   * @brief Items of the entry read from the mapped segment, empty if the
+   * entry is gone or its record is damaged
+   */
+  QVector<QPair<QString, QByteArray>> items(quint64 id) const;
+
+  /**
+   * @brief Mime type and length of every item of the entry and the first
+   * headLength bytes of the text items, other payloads are skipped so
+   * only the pages holding the item headers and text heads are read,
+   * empty if the entry is gone or its record is damaged
+   */
+  QVector<HistoryItemSummary> summary(quint64 id, qsizetype headLength) const;
+
+  /**
+   * @brief Bytes of the segments held by removed entries
+   */
+  qint64 deadBytes() const;
+
+  /**
+   * @brief Number of segment files
+   */
+  qsizetype segmentCount() const;
+
+  /**
+   * @brief Copy the live entries out of the segments that are at least
+   * half removed and delete them, runs in the background on its own but
+   * can be called to compact at once
+   */
+  void compact();
+
+  /**
+   * @brief Wait for the background compaction to finish
+   */
+  void waitForCompaction();
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::history
@@ -0,0 +1,311 @@
+#include "search_index.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace srilakshmikanthanp::clipbirdesk::history::internal {
+/**
+ * @brief Bytes in a trigram
+ */
+constexpr qsizetype trigramLength = 3;
+
+/**
+ * @brief Html entities decoded when the tags are stripped
+ */
+const QVector<QPair<QString, QString>> htmlEntities = {
+  {"&amp;", "&"},
+  {"&lt;", "<"},
+  {"&gt;", ">"},
+  {"&quot;", "\""},
+  {"&#39;", "'"},
+  {"&nbsp;", " "},
+};
+
+QString stripHtml(const QString& html) {
+  QString text;
+  text.reserve(html.size());
+  bool inTag = false;
+
+  for (const auto c : html) {
+    if (c == '<') {
+      inTag = true;
+      text.append(' ');
+    } else if (c == '>') {
+      inTag = false;
+    } else if (!inTag) {
+      text.append(c);
+    }
+  }
+
+  for (const auto& [entity, value] : htmlEntities) {
+    text.replace(entity, value);
+  }
+
+  return text.simplified();
+}
+
+/**
+ * @brief Append the value in seven bit groups, low group first, the high
+ * bit of a byte is set while more groups follow
+ */
+void appendVarint(QByteArray& bytes, quint64 value) {
+  while (value >= 0x80) {
+    bytes.append(char((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+
+  bytes.append(char(value));
+}
+
+/**
+ * @brief Letters and digits make up words, bytes of multibyte characters
+ * are taken as letters
+ */
+bool isWordByte(char c) {
+  const auto u = uchar(c);
+  return u >= 0x80 || (u >= '0' && u <= '9') || (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z');
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::history::internal
+
+namespace srilakshmikanthanp::clipbirdesk::history {
+QVector<quint32> SearchIndex::trigrams(const QByteArray& text) {
+  QVector<quint32> keys;
+
+  for (qsizetype i = 0; i + internal::trigramLength <= text.size(); i++) {
+    keys.append(quint32(uchar(text[i])) << 16 | quint32(uchar(text[i + 1])) << 8 | quint32(uchar(text[i + 2])));
+  }
+
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+  return keys;
+}
+
+bool SearchIndex::matches(const QByteArray& text, const QByteArray& query, Match match) {
+  for (auto at = text.indexOf(query); at != -1; at = text.indexOf(query, at + 1)) {
+    if (match == Match::Substring || at == 0 || !internal::isWordByte(text[at - 1])) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+QVector<quint64> SearchIndex::decode(const Posting& posting) {
+  QVector<quint64> ids;
+  ids.reserve(posting.count);
+
+  quint64 id  = 0;
+  quint64 gap = 0;
+  int shift   = 0;
+
+  for (const auto byte : posting.gaps) {
+    gap |= quint64(uchar(byte) & 0x7F) << shift;
+    shift += 7;
+
+    if ((uchar(byte) & 0x80) == 0) {
+      id += gap;
+      ids.append(id);
+      gap   = 0;
+      shift = 0;
+    }
+  }
+
+  return ids;
+}
+
+void SearchIndex::append(Posting& posting, quint64 id) {
+  internal::appendVarint(posting.gaps, id - posting.last);
+  posting.last  = id;
+  posting.count = posting.count + 1;
+}
+
+bool SearchIndex::check(quint64 id, const QByteArray& text, const QByteArray& query, Match match, const Loader& loader) const {
+  if (matches(text, query, match)) {
+    return true;
+  }
+
+  // the query can be in the part of a long entry that is not indexed
+  if (!loader || truncated.count(id) == 0) {
+    return false;
+  }
+
+  return matches(normalize(plainText(loader(id))), query, match);
+}
+
+void SearchIndex::rebuild() {
+  postings.clear();
+  livePostings = 0;
+  deadPostings = 0;
+
+  // documents are in id order so every id goes to the end of its lists
+  for (const auto& [id, text] : documents) {
+    const auto keys = trigrams(text);
+    for (const auto key : keys) append(postings[key], id);
+    livePostings += keys.size();
+  }
+}
+
+QString SearchIndex::plainText(const QVector<QPair<QString, QByteArray>>& items) {
+  for (const auto& [mimeType, data] : items) {
+    if (mimeType == "text/plain") return QString::fromUtf8(data);
+  }
+
+  for (const auto& [mimeType, data] : items) {
+    if (mimeType == "text/html") return internal::stripHtml(QString::fromUtf8(data));
+  }
+
+  return QString();
+}
+
+QByteArray SearchIndex::normalize(const QString& text) {
+  return text.toCaseFolded().toUtf8();
+}
+
+void SearchIndex::add(quint64 id, const QVector<QPair<QString, QByteArray>>& items, bool partial) {
+  this->remove(id);
+
+  const auto length = qsizetype(constants::getAppSearchTextLength());
+  const auto full   = normalize(plainText(items));
+  const auto text   = full.left(length);
+
+  if (text.isEmpty()) {
+    return;
+  }
+
+  if (partial || full.size() > length) {
+    truncated.insert(id);
+  }
+
+  const auto keys = trigrams(text);
+
+  for (const auto key : keys) {
+    auto& posting = postings[key];
+
+    livePostings = livePostings + 1;
+
+    // ids grow so a new entry goes to the end of the lists
+    if (id > posting.last) {
+      append(posting, id);
+      continue;
+    }
+
+    auto ids = decode(posting);
+    const auto at = std::lower_bound(ids.begin(), ids.end(), id);
+
+    // the id was removed and is back, its old posting is live again
+    if (at != ids.end() && *at == id) {
+      deadPostings = deadPostings - 1;
+      continue;
+    }
+
+    ids.insert(at, id);
+    posting = Posting();
+    for (const auto each : ids) append(posting, each);
+  }
+
+  documents.emplace(id, text);
+}
+
+void SearchIndex::remove(quint64 id) {
+  const auto document = documents.find(id);
+
+  if (document == documents.end()) {
+    return;
+  }
+
+  // the postings stay until they outnumber the live ones
+  const auto count = trigrams(document->second).size();
+  livePostings = livePostings - count;
+  deadPostings = deadPostings + count;
+
+  documents.erase(document);
+  truncated.erase(id);
+
+  if (deadPostings > livePostings) {
+    this->rebuild();
+  }
+}
+
+void SearchIndex::removeOlderThan(quint64 id) {
+  while (!documents.empty() && documents.begin()->first < id) {
+    this->remove(documents.begin()->first);
+  }
+}
+
+qsizetype SearchIndex::size() const {
+  return qsizetype(documents.size());
+}
+
+qsizetype SearchIndex::memoryUsage() const {
+  qsizetype bytes = 0;
+
+  for (const auto& [id, text] : documents) {
+    bytes += text.capacity();
+  }
+
+  for (const auto& posting : postings) {
+    bytes += posting.gaps.capacity() + qsizetype(sizeof(Posting));
+  }
+
+  return bytes;
+}
+
+QVector<quint64> SearchIndex::search(const QString& query, Match match, const Loader& loader) const {
+  const auto needle = normalize(query);
+  QVector<quint64> results;
+
+  // too short for a trigram, the indexed text is scanned
+  if (needle.size() < internal::trigramLength) {
+    for (auto it = documents.crbegin(); it != documents.crend(); ++it) {
+      if (needle.isEmpty() || check(it->first, it->second, needle, match, loader)) results.append(it->first);
+    }
+
+    return results;
+  }
+
+  QVector<const Posting*> lists;
+  bool missing = false;
+
+  for (const auto key : trigrams(needle)) {
+    const auto posting = postings.constFind(key);
+
+    if (posting == postings.cend()) {
+      missing = true;
+      break;
+    }
+
+    lists.append(&posting.value());
+  }
+
+  // the shortest list bounds the candidates, the rest only narrow it
+  std::sort(lists.begin(), lists.end(), [](const auto* a, const auto* b) {
+    return a->count < b->count;
+  });
+
+  QVector<quint64> candidates = missing ? QVector<quint64>() : decode(*lists.first());
+
+  for (qsizetype i = 1; i < lists.size() && !candidates.isEmpty(); i++) {
+    const auto ids = decode(*lists[i]);
+    QVector<quint64> narrowed;
+    std::set_intersection(candidates.cbegin(), candidates.cend(), ids.cbegin(), ids.cend(), std::back_inserter(narrowed));
+    candidates = std::move(narrowed);
+  }
+
+  // the trigrams of a long entry are only known for its start
+  if (loader && !truncated.empty()) {
+    QVector<quint64> widened;
+    std::set_union(candidates.cbegin(), candidates.cend(), truncated.cbegin(), truncated.cend(), std::back_inserter(widened));
+    candidates = std::move(widened);
+  }
+
+  // trigrams can be in the text apart so each candidate is checked, ids
+  // removed since the lists were rebuilt are skipped here
+  for (auto it = candidates.crbegin(); it != candidates.crend(); ++it) {
+    const auto document = documents.find(*it);
+    if (document != documents.end() && check(*it, document->second, needle, match, loader)) results.append(*it);
+  }
+
+  return results;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::history
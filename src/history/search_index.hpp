@@ -0,0 +1,120 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header files
+#include <QByteArray>
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include <QtTypes>
+
+// Standard header files
+#include <functional>
+#include <map>
+#include <set>
+
+// Local header files
+#include "constants/constants.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::history {
+/**
+ * @brief Trigram index over the text of the history entries, a query is
+ * answered by intersecting the entries holding each of its trigrams and
+ * checking those few against the text, queries shorter than a trigram
+ * scan the indexed text, the posting lists hold varint gaps between the
+ * ids so a posting takes one or two bytes, removed ids are dropped from
+ * the lists in bulk once they outnumber the live ones, only the start
+ * of a long entry is indexed so such entries are always checked and the
+ * rest of their text is read through the loader given to the search
+ */
+class SearchIndex {
+ public:
+
+  /**
+   * @brief Where the query has to be found in the text
+   */
+  enum class Match {
+    Substring,
+    Prefix,
+  };
+
+  /**
+   * @brief Reads the items of an entry whose text was cut when indexed
+   */
+  using Loader = std::function<QVector<QPair<QString, QByteArray>>(quint64)>;
+
+ private:
+
+  /**
+   * @brief Ids of the entries holding a trigram in increasing order
+   */
+  struct Posting {
+    QByteArray gaps;
+    quint64 last    = 0;
+    qsizetype count = 0;
+  };
+
+ private:
+
+  std::map<quint64, QByteArray> documents;
+  std::set<quint64> truncated;
+  QHash<quint32, Posting> postings;
+  qsizetype livePostings = 0;
+  qsizetype deadPostings = 0;
+
+ private:
+
+  static QVector<quint32> trigrams(const QByteArray& text);
+  static bool matches(const QByteArray& text, const QByteArray& query, Match match);
+  static QVector<quint64> decode(const Posting& posting);
+  static void append(Posting& posting, quint64 id);
+  bool check(quint64 id, const QByteArray& text, const QByteArray& query, Match match, const Loader& loader) const;
+  void rebuild();
+
+ public:
+
+  /**
+   * @brief Text of the items that is searched, plain text if there is any
+   * and otherwise the html with its tags stripped
+   */
+  static QString plainText(const QVector<QPair<QString, QByteArray>>& items);
+
+  /**
+   * @brief Case folded utf-8 of the text the index and queries work on
+   */
+  static QByteArray normalize(const QString& text);
+
+  /**
+   * @brief Index the entry, only the first getAppSearchTextLength() bytes
+   * of its text are kept, partial if the items hold only its start
+   */
+  void add(quint64 id, const QVector<QPair<QString, QByteArray>>& items, bool partial = false);
+
+  /**
+   * @brief Drop the entry
+   */
+  void remove(quint64 id);
+
+  /**
+   * @brief Drop the entries older than the id
+   */
+  void removeOlderThan(quint64 id);
+
+  /**
+   * @brief Number of entries indexed
+   */
+  qsizetype size() const;
+
+  /**
+   * @brief Bytes held by the indexed text and the posting lists
+   */
+  qsizetype memoryUsage() const;
+
+  /**
+   * @brief Ids of the entries the query is found in, newest first, every
+   * entry if the query is empty, without a loader only the indexed start
+   * of long entries is searched
+   */
+  QVector<quint64> search(const QString& query, Match match = Match::Substring, const Loader& loader = {}) const;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::history
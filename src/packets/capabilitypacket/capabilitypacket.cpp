@@ -0,0 +1,91 @@
+#include "capabilitypacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return qint32
+ */
+quint32 CapabilityPacket::getPacketLength() const noexcept {
+  return (sizeof(decltype(std::declval<CapabilityPacket>().getPacketLength()))) + sizeof(packetType) + sizeof(encodings);
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 CapabilityPacket::getPacketType() const noexcept {
+  return packetType;
+}
+
+/**
+ * @brief Set the Encodings object
+ *
+ * @param encodings bit set of the supported encodings
+ */
+void CapabilityPacket::setEncodings(quint32 encodings) {
+  this->encodings = encodings;
+}
+
+/**
+ * @brief Get the Encodings object
+ *
+ * @return quint32
+ */
+quint32 CapabilityPacket::getEncodings() const noexcept {
+  return encodings;
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray CapabilityPacket::toBytes() const {
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  stream << this->getPacketLength();
+  stream << this->packetType;
+  stream << this->encodings;
+
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+CapabilityPacket CapabilityPacket::fromBytes(const QByteArray &array) {
+  auto stream = QDataStream(array);
+
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+
+  CapabilityPacket packet;
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  quint32 packetLength;
+  quint32 packetType;
+  quint32 encodings;
+
+  stream >> packetLength;
+  stream >> packetType;
+
+  if (packetType != PacketType::CAPABILITY_PACKET) {
+    throw common::types::exceptions::NotThisPacket("Not CapabilityPacket");
+  }
+
+  stream >> encodings;
+
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "CapabilityPacket");
+  }
+
+  // unknown encodings are kept, the sender only picks the known ones
+  packet.setEncodings(encodings);
+
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
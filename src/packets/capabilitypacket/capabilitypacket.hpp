@@ -0,0 +1,70 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <iostream>
+#include <stdexcept>
+
+// Qt header files
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QtTypes>
+
+// Local header files
+#include "packets/network_packet.hpp"
+#include "packets/packet_type.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Capabilities of the host sent once the connection is made,
+ * each bit of the encodings is an Encoding the host can decode
+ */
+class CapabilityPacket: public NetworkPacket {
+ private:  // private members
+
+  quint32 packetType = PacketType::CAPABILITY_PACKET;
+  quint32 encodings  = 0;
+
+ public:
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return qint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Encodings object
+   *
+   * @param encodings bit set of the supported encodings
+   */
+  void setEncodings(quint32 encodings);
+
+  /**
+   * @brief Get the Encodings object
+   *
+   * @return quint32
+   */
+  quint32 getEncodings() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const override;
+
+  /**
+   * @brief From Bytes
+   */
+  static CapabilityPacket fromBytes(const QByteArray &array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
@@ -0,0 +1,356 @@
+#include "deltapacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+//-------------------------------- DeltaItem --------------------------------//
+
+/**
+ * @brief Get the Mime Length object
+ *
+ * @return quint32
+ */
+quint32 DeltaItem::getMimeLength() const noexcept {
+  return quint32(this->mimeType.size());
+}
+
+/**
+ * @brief Set the Mime Type object
+ *
+ * @param type
+ */
+void DeltaItem::setMimeType(const QByteArray& type) {
+  this->mimeType = type;
+}
+
+/**
+ * @brief Get the Mime Type object
+ *
+ * @return QByteArray
+ */
+QByteArray DeltaItem::getMimeType() const noexcept {
+  return this->mimeType;
+}
+
+/**
+ * @brief Set the Base Hash object
+ *
+ * @param hash SHA-256 of the base payload
+ */
+void DeltaItem::setBaseHash(const QByteArray& hash) {
+  this->baseHash = hash;
+}
+
+/**
+ * @brief Get the Base Hash object
+ *
+ * @return QByteArray
+ */
+QByteArray DeltaItem::getBaseHash() const noexcept {
+  return this->baseHash;
+}
+
+/**
+ * @brief Set the Target Length object
+ *
+ * @param length length of the rebuilt payload
+ */
+void DeltaItem::setTargetLength(quint64 length) {
+  this->targetLength = length;
+}
+
+/**
+ * @brief Get the Target Length object
+ *
+ * @return quint64
+ */
+quint64 DeltaItem::getTargetLength() const noexcept {
+  return this->targetLength;
+}
+
+/**
+ * @brief Set the Ops object
+ *
+ * @param ops
+ */
+void DeltaItem::setOps(const QVector<DeltaOp>& ops) {
+  this->ops = ops;
+}
+
+/**
+ * @brief Get the Ops object
+ *
+ * @return QVector<DeltaOp>
+ */
+QVector<DeltaOp> DeltaItem::getOps() const noexcept {
+  return this->ops;
+}
+
+/**
+ * @brief Get the size of the item
+ *
+ * @return quint32
+ */
+quint32 DeltaItem::size() const noexcept {
+  auto size = quint32(
+    sizeof(decltype(std::declval<DeltaItem>().getMimeLength())) +
+    this->mimeType.size() +
+    contentHashLength +
+    sizeof(this->targetLength) +
+    sizeof(quint32)
+  );
+
+  for (const auto& op : this->ops) {
+    size += sizeof(op.copyOffset) + sizeof(op.copyLength) + sizeof(quint32) + op.literal.size();
+  }
+
+  return size;
+}
+
+/**
+ * @brief To Stream
+ */
+void DeltaItem::toStream(QDataStream& stream) const {
+  stream << this->getMimeLength();
+  stream.writeRawData(this->mimeType.data(), this->mimeType.size());
+  stream.writeRawData(this->baseHash.data(), contentHashLength);
+  stream << this->targetLength;
+  stream << quint32(this->ops.size());
+
+  for (const auto& op : this->ops) {
+    stream << op.copyOffset;
+    stream << op.copyLength;
+    stream << quint32(op.literal.size());
+    stream.writeRawData(op.literal.data(), op.literal.size());
+  }
+}
+
+/**
+ * @brief From Stream
+ */
+DeltaItem DeltaItem::fromStream(QDataStream& stream) {
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+
+  DeltaItem item;
+
+  quint32 mimeLength;
+  QByteArray baseHash(contentHashLength, Qt::Uninitialized);
+  quint64 targetLength;
+  quint32 opCount;
+
+  stream >> mimeLength;
+
+  if (stream.status() != QDataStream::Ok || mimeLength > quint64(stream.device()->bytesAvailable())) {
+    throw MalformedPacket(ErrorCode::CodingError, "DeltaItem");
+  }
+
+  QByteArray mimeType(mimeLength, Qt::Uninitialized);
+
+  stream.readRawData(mimeType.data(), mimeLength);
+
+  if (stream.readRawData(baseHash.data(), contentHashLength) != contentHashLength) {
+    throw MalformedPacket(ErrorCode::CodingError, "DeltaItem");
+  }
+
+  stream >> targetLength;
+  stream >> opCount;
+
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "DeltaItem");
+  }
+
+  QVector<DeltaOp> ops;
+
+  for (quint32 i = 0; i < opCount; i++) {
+    DeltaOp op;
+    quint32 literalLength;
+
+    stream >> op.copyOffset;
+    stream >> op.copyLength;
+    stream >> literalLength;
+
+    if (stream.status() != QDataStream::Ok || literalLength > quint64(stream.device()->bytesAvailable())) {
+      throw MalformedPacket(ErrorCode::CodingError, "DeltaItem");
+    }
+
+    op.literal.resize(literalLength);
+    stream.readRawData(op.literal.data(), literalLength);
+    ops.append(op);
+  }
+
+  item.setMimeType(mimeType);
+  item.setBaseHash(baseHash);
+  item.setTargetLength(targetLength);
+  item.setOps(ops);
+
+  return item;
+}
+
+//------------------------------- DeltaPacket -------------------------------//
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 DeltaPacket::getPacketLength() const noexcept {
+  auto size = quint32(
+    sizeof(decltype(std::declval<DeltaPacket>().getPacketLength())) +
+    sizeof(this->packetType) +
+    originIdLength +
+    sizeof(this->sequence) +
+    sizeof(decltype(std::declval<DeltaPacket>().getItemCount()))
+  );
+
+  for (const auto& item : this->items) {
+    size += item.size();
+  }
+
+  return size;
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 DeltaPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Origin Id object
+ *
+ * @param id device the items were copied on
+ */
+void DeltaPacket::setOriginId(const QUuid& id) {
+  this->originId = id;
+}
+
+/**
+ * @brief Get the Origin Id object
+ *
+ * @return QUuid
+ */
+QUuid DeltaPacket::getOriginId() const noexcept {
+  return this->originId;
+}
+
+/**
+ * @brief Set the Sequence object
+ *
+ * @param sequence clock of the origin when the items were copied
+ */
+void DeltaPacket::setSequence(quint64 sequence) {
+  this->sequence = sequence;
+}
+
+/**
+ * @brief Get the Sequence object
+ *
+ * @return quint64
+ */
+quint64 DeltaPacket::getSequence() const noexcept {
+  return this->sequence;
+}
+
+/**
+ * @brief Get the Item Count object
+ *
+ * @return quint32
+ */
+quint32 DeltaPacket::getItemCount() const noexcept {
+  return quint32(this->items.size());
+}
+
+/**
+ * @brief Set the Items object
+ *
+ * @param items
+ */
+void DeltaPacket::setItems(const QVector<DeltaItem>& items) {
+  this->items = items;
+}
+
+/**
+ * @brief Get the Items object
+ *
+ * @return QVector<DeltaItem>
+ */
+QVector<DeltaItem> DeltaPacket::getItems() const noexcept {
+  return this->items;
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray DeltaPacket::toBytes() const {
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  stream << this->getPacketLength();
+  stream << this->packetType;
+  stream.writeRawData(this->originId.toRfc4122().constData(), originIdLength);
+  stream << this->sequence;
+  stream << this->getItemCount();
+
+  for (const auto& item : this->items) {
+    item.toStream(stream);
+  }
+
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+DeltaPacket DeltaPacket::fromBytes(const QByteArray& array) {
+  auto stream = QDataStream(array);
+
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+
+  DeltaPacket packet;
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  quint32 packetLength;
+  quint32 packetType;
+  QByteArray originId(originIdLength, Qt::Uninitialized);
+  quint64 sequence;
+  quint32 itemCount;
+
+  stream >> packetLength;
+  stream >> packetType;
+
+  if (packetType != PacketType::DELTA_PACKET) {
+    throw common::types::exceptions::NotThisPacket("Not DeltaPacket");
+  }
+
+  stream.readRawData(originId.data(), originIdLength);
+  stream >> sequence;
+  stream >> itemCount;
+
+  if (stream.status() != QDataStream::Ok || packetLength != quint32(array.size())) {
+    throw MalformedPacket(ErrorCode::CodingError, "DeltaPacket");
+  }
+
+  QVector<DeltaItem> items;
+
+  for (quint32 i = 0; i < itemCount; i++) {
+    items.append(DeltaItem::fromStream(stream));
+  }
+
+  // no trailing bytes after the items
+  if (!stream.atEnd()) {
+    throw MalformedPacket(ErrorCode::CodingError, "DeltaPacket");
+  }
+
+  packet.setOriginId(QUuid::fromRfc4122(originId));
+  packet.setSequence(sequence);
+  packet.setItems(items);
+
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
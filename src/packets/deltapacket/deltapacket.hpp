@@ -0,0 +1,214 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <stdexcept>
+
+// Qt header files
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QUuid>
+#include <QVector>
+#include <QtTypes>
+
+// Local header files
+#include "packets/network_packet.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
+#include "packets/packet_type.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Step of a delta, copy the range of the base and then append
+ * the literal bytes
+ */
+struct DeltaOp {
+  quint64 copyOffset = 0;
+  quint64 copyLength = 0;
+  QByteArray literal;
+};
+
+/**
+ * @brief Item rebuilt from a base payload the receiver already has
+ */
+class DeltaItem {
+ private:
+
+  QByteArray mimeType;
+  QByteArray baseHash;
+  quint64 targetLength = 0;
+  QVector<DeltaOp> ops;
+
+ public:
+
+  /**
+   * @brief Get the Mime Length object
+   *
+   * @return quint32
+   */
+  quint32 getMimeLength() const noexcept;
+
+  /**
+   * @brief Set the Mime Type object
+   *
+   * @param type
+   */
+  void setMimeType(const QByteArray& type);
+
+  /**
+   * @brief Get the Mime Type object
+   *
+   * @return QByteArray
+   */
+  QByteArray getMimeType() const noexcept;
+
+  /**
+   * @brief Set the Base Hash object
+   *
+   * @param hash SHA-256 of the base payload
+   */
+  void setBaseHash(const QByteArray& hash);
+
+  /**
+   * @brief Get the Base Hash object
+   *
+   * @return QByteArray
+   */
+  QByteArray getBaseHash() const noexcept;
+
+  /**
+   * @brief Set the Target Length object
+   *
+   * @param length length of the rebuilt payload
+   */
+  void setTargetLength(quint64 length);
+
+  /**
+   * @brief Get the Target Length object
+   *
+   * @return quint64
+   */
+  quint64 getTargetLength() const noexcept;
+
+  /**
+   * @brief Set the Ops object
+   *
+   * @param ops
+   */
+  void setOps(const QVector<DeltaOp>& ops);
+
+  /**
+   * @brief Get the Ops object
+   *
+   * @return QVector<DeltaOp>
+   */
+  QVector<DeltaOp> getOps() const noexcept;
+
+  /**
+   * @brief Get the size of the item
+   *
+   * @return quint32
+   */
+  quint32 size() const noexcept;
+
+  /**
+   * @brief To Stream
+   */
+  void toStream(QDataStream& stream) const;
+
+  /**
+   * @brief From Stream
+   */
+  static DeltaItem fromStream(QDataStream& stream);
+};
+
+/**
+ * @brief Answers a NeedPacket with the needed items as deltas against
+ * the versions the peer was last sent, the items are in the order they
+ * were offered, the peer asks again with a NeedPacket if it lacks a base
+ */
+class DeltaPacket : public NetworkPacket {
+ private:  // private members
+
+  quint32 packetType = PacketType::DELTA_PACKET;
+  QUuid originId;
+  quint64 sequence = 0;
+  QVector<DeltaItem> items;
+
+ public:
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Origin Id object
+   *
+   * @param id device the items were copied on
+   */
+  void setOriginId(const QUuid& id);
+
+  /**
+   * @brief Get the Origin Id object
+   *
+   * @return QUuid
+   */
+  QUuid getOriginId() const noexcept;
+
+  /**
+   * @brief Set the Sequence object
+   *
+   * @param sequence clock of the origin when the items were copied
+   */
+  void setSequence(quint64 sequence);
+
+  /**
+   * @brief Get the Sequence object
+   *
+   * @return quint64
+   */
+  quint64 getSequence() const noexcept;
+
+  /**
+   * @brief Get the Item Count object
+   *
+   * @return quint32
+   */
+  quint32 getItemCount() const noexcept;
+
+  /**
+   * @brief Set the Items object
+   *
+   * @param items
+   */
+  void setItems(const QVector<DeltaItem>& items);
+
+  /**
+   * @brief Get the Items object
+   *
+   * @return QVector<DeltaItem>
+   */
+  QVector<DeltaItem> getItems() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const override;
+
+  /**
+   * @brief From Bytes
+   */
+  static DeltaPacket fromBytes(const QByteArray& array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
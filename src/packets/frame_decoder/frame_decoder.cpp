@@ -0,0 +1,76 @@
+#include "frame_decoder.hpp"
+
+#include <QtEndian>
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Append the bytes received from the device
+ *
+ * @param bytes
+ */
+void FrameDecoder::append(const QByteArray& bytes) {
+  // drop the frames already returned before growing the buffer
+  if (offset > 0) {
+    buffer.remove(0, offset);
+    offset = 0;
+  }
+
+  buffer.append(bytes);
+}
+
+/**
+ * @brief Take the next complete frame from the buffer
+ *
+ * @throws MalformedPacket if the length prefix is smaller than the header
+ * @return std::optional<QByteArray> frame or nullopt if incomplete
+ */
+std::optional<QByteArray> FrameDecoder::next() {
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+
+  // header is the packet length followed by the packet type
+  constexpr qsizetype headerSize = sizeof(quint32) + sizeof(quint32);
+
+  if (bufferedBytes() < qsizetype(sizeof(quint32))) {
+    return std::nullopt;
+  }
+
+  const auto packetLength = qFromBigEndian<quint32>(buffer.constData() + offset);
+
+  if (packetLength < headerSize) {
+    throw MalformedPacket(ErrorCode::CodingError, "Invalid Packet Length");
+  }
+
+  if (bufferedBytes() < qsizetype(packetLength)) {
+    return std::nullopt;
+  }
+
+  // hand over the whole buffer when it holds exactly one frame
+  if (offset == 0 && buffer.size() == qsizetype(packetLength)) {
+    QByteArray frame;
+    frame.swap(buffer);
+    return frame;
+  }
+
+  auto frame = buffer.mid(offset, packetLength);
+  offset += packetLength;
+  return frame;
+}
+
+/**
+ * @brief Get the number of bytes not yet returned as a frame
+ *
+ * @return qsizetype
+ */
+qsizetype FrameDecoder::bufferedBytes() const noexcept {
+  return buffer.size() - offset;
+}
+
+/**
+ * @brief Drop all the buffered bytes
+ */
+void FrameDecoder::clear() {
+  buffer.clear();
+  offset = 0;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
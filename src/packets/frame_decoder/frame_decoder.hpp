@@ -0,0 +1,54 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <optional>
+
+// Qt header files
+#include <QByteArray>
+#include <QtTypes>
+
+// Local header files
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Splits a byte stream into length prefixed frames, owns the
+ * receive buffer of one session so partial frames survive across reads
+ */
+class FrameDecoder {
+ private:  // members
+
+  QByteArray buffer;
+  qsizetype offset = 0;
+
+ public:
+
+  /**
+   * @brief Append the bytes received from the device
+   *
+   * @param bytes
+   */
+  void append(const QByteArray& bytes);
+
+  /**
+   * @brief Take the next complete frame from the buffer
+   *
+   * @throws MalformedPacket if the length prefix is smaller than the header
+   * @return std::optional<QByteArray> frame or nullopt if incomplete
+   */
+  std::optional<QByteArray> next();
+
+  /**
+   * @brief Get the number of bytes not yet returned as a frame
+   *
+   * @return qsizetype
+   */
+  qsizetype bufferedBytes() const noexcept;
+
+  /**
+   * @brief Drop all the buffered bytes
+   */
+  void clear();
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
@@ -3,6 +3,11 @@
 #include <QByteArray>
 
 namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Origin ids are sent as the 16 RFC 4122 bytes of the QUuid
+ */
+constexpr qsizetype originIdLength = 16;
+
 class NetworkPacket {
  public:
   explicit NetworkPacket() {}
@@ -0,0 +1,463 @@
+#include "offerpacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+//-------------------------------- OfferItem --------------------------------//
+
+/**
+ * @brief Get the Mime Length object
+ *
+ * @return quint32
+ */
+quint32 OfferItem::getMimeLength() const noexcept {
+  return quint32(this->mimeType.size());
+}
+
+/**
+ * @brief Set the Mime Type object
+ *
+ * @param type
+ */
+void OfferItem::setMimeType(const QByteArray& type) {
+  this->mimeType = type;
+}
+
+/**
+ * @brief Get the Mime Type object
+ *
+ * @return QByteArray
+ */
+QByteArray OfferItem::getMimeType() const noexcept {
+  return this->mimeType;
+}
+
+/**
+ * @brief Set the Payload Length object
+ *
+ * @param length
+ */
+void OfferItem::setPayloadLength(quint64 length) {
+  this->payloadLength = length;
+}
+
+/**
+ * @brief Get the Payload Length object
+ *
+ * @return quint64
+ */
+quint64 OfferItem::getPayloadLength() const noexcept {
+  return this->payloadLength;
+}
+
+/**
+ * @brief Set the Hash object
+ *
+ * @param hash SHA-256 of the payload
+ */
+void OfferItem::setHash(const QByteArray& hash) {
+  this->hash = hash;
+}
+
+/**
+ * @brief Get the Hash object
+ *
+ * @return QByteArray
+ */
+QByteArray OfferItem::getHash() const noexcept {
+  return this->hash;
+}
+
+/**
+ * @brief Get the size of the item
+ *
+ * @return quint32
+ */
+quint32 OfferItem::size() const noexcept {
+  return quint32(
+    sizeof(decltype(std::declval<OfferItem>().getMimeLength())) +
+    this->mimeType.size() +
+    sizeof(this->payloadLength) +
+    contentHashLength
+  );
+}
+
+/**
+ * @brief To Stream
+ */
+void OfferItem::toStream(QDataStream& stream) const {
+  stream << this->getMimeLength();
+  stream.writeRawData(this->mimeType.data(), this->mimeType.size());
+  stream << this->payloadLength;
+  stream.writeRawData(this->hash.data(), contentHashLength);
+}
+
+/**
+ * @brief From Stream
+ */
+OfferItem OfferItem::fromStream(QDataStream& stream) {
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+
+  OfferItem item;
+
+  quint32 mimeLength;
+  quint64 payloadLength;
+  QByteArray hash(contentHashLength, Qt::Uninitialized);
+
+  stream >> mimeLength;
+
+  if (stream.status() != QDataStream::Ok || mimeLength > quint64(stream.device()->bytesAvailable())) {
+    throw MalformedPacket(ErrorCode::CodingError, "OfferItem");
+  }
+
+  QByteArray mimeType(mimeLength, Qt::Uninitialized);
+
+  stream.readRawData(mimeType.data(), mimeLength);
+  stream >> payloadLength;
+
+  if (stream.readRawData(hash.data(), contentHashLength) != contentHashLength || stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "OfferItem");
+  }
+
+  item.setMimeType(mimeType);
+  item.setPayloadLength(payloadLength);
+  item.setHash(hash);
+
+  return item;
+}
+
+//------------------------------- OfferPacket -------------------------------//
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 OfferPacket::getPacketLength() const noexcept {
+  auto size = quint32(
+    sizeof(decltype(std::declval<OfferPacket>().getPacketLength())) +
+    sizeof(this->packetType) +
+    originIdLength +
+    sizeof(this->sequence) +
+    sizeof(decltype(std::declval<OfferPacket>().getItemCount()))
+  );
+
+  for (const auto& item : this->items) {
+    size += item.size();
+  }
+
+  return size;
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 OfferPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Origin Id object
+ *
+ * @param id device the items were copied on
+ */
+void OfferPacket::setOriginId(const QUuid& id) {
+  this->originId = id;
+}
+
+/**
+ * @brief Get the Origin Id object
+ *
+ * @return QUuid
+ */
+QUuid OfferPacket::getOriginId() const noexcept {
+  return this->originId;
+}
+
+/**
+ * @brief Set the Sequence object
+ *
+ * @param sequence clock of the origin when the items were copied
+ */
+void OfferPacket::setSequence(quint64 sequence) {
+  this->sequence = sequence;
+}
+
+/**
+ * @brief Get the Sequence object
+ *
+ * @return quint64
+ */
+quint64 OfferPacket::getSequence() const noexcept {
+  return this->sequence;
+}
+
+/**
+ * @brief Get the Item Count object
+ *
+ * @return quint32
+ */
+quint32 OfferPacket::getItemCount() const noexcept {
+  return quint32(this->items.size());
+}
+
+/**
+ * @brief Set the Items object
+ *
+ * @param items
+ */
+void OfferPacket::setItems(const QVector<OfferItem>& items) {
+  this->items = items;
+}
+
+/**
+ * @brief Get the Items object
+ *
+ * @return QVector<OfferItem>
+ */
+QVector<OfferItem> OfferPacket::getItems() const noexcept {
+  return this->items;
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray OfferPacket::toBytes() const {
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  stream << this->getPacketLength();
+  stream << this->packetType;
+  stream.writeRawData(this->originId.toRfc4122().constData(), originIdLength);
+  stream << this->sequence;
+  stream << this->getItemCount();
+
+  for (const auto& item : this->items) {
+    item.toStream(stream);
+  }
+
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+OfferPacket OfferPacket::fromBytes(const QByteArray& array) {
+  auto stream = QDataStream(array);
+
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+
+  OfferPacket packet;
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  quint32 packetLength;
+  quint32 packetType;
+  QByteArray originId(originIdLength, Qt::Uninitialized);
+  quint64 sequence;
+  quint32 itemCount;
+
+  stream >> packetLength;
+  stream >> packetType;
+
+  if (packetType != PacketType::OFFER_PACKET) {
+    throw common::types::exceptions::NotThisPacket("Not OfferPacket");
+  }
+
+  stream.readRawData(originId.data(), originIdLength);
+  stream >> sequence;
+  stream >> itemCount;
+
+  if (stream.status() != QDataStream::Ok || packetLength != quint32(array.size())) {
+    throw MalformedPacket(ErrorCode::CodingError, "OfferPacket");
+  }
+
+  QVector<OfferItem> items;
+
+  for (quint32 i = 0; i < itemCount; i++) {
+    items.append(OfferItem::fromStream(stream));
+  }
+
+  // no trailing bytes after the items
+  if (!stream.atEnd()) {
+    throw MalformedPacket(ErrorCode::CodingError, "OfferPacket");
+  }
+
+  packet.setOriginId(QUuid::fromRfc4122(originId));
+  packet.setSequence(sequence);
+  packet.setItems(items);
+
+  return packet;
+}
+
+//-------------------------------- NeedPacket -------------------------------//
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 NeedPacket::getPacketLength() const noexcept {
+  return quint32(
+    sizeof(decltype(std::declval<NeedPacket>().getPacketLength())) +
+    sizeof(this->packetType) +
+    originIdLength +
+    sizeof(this->sequence) +
+    sizeof(decltype(std::declval<NeedPacket>().getHashCount())) +
+    this->hashes.size() * contentHashLength
+  );
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 NeedPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Origin Id object
+ *
+ * @param id origin of the offer
+ */
+void NeedPacket::setOriginId(const QUuid& id) {
+  this->originId = id;
+}
+
+/**
+ * @brief Get the Origin Id object
+ *
+ * @return QUuid
+ */
+QUuid NeedPacket::getOriginId() const noexcept {
+  return this->originId;
+}
+
+/**
+ * @brief Set the Sequence object
+ *
+ * @param sequence sequence of the offer
+ */
+void NeedPacket::setSequence(quint64 sequence) {
+  this->sequence = sequence;
+}
+
+/**
+ * @brief Get the Sequence object
+ *
+ * @return quint64
+ */
+quint64 NeedPacket::getSequence() const noexcept {
+  return this->sequence;
+}
+
+/**
+ * @brief Get the Hash Count object
+ *
+ * @return quint32
+ */
+quint32 NeedPacket::getHashCount() const noexcept {
+  return quint32(this->hashes.size());
+}
+
+/**
+ * @brief Set the Hashes object
+ *
+ * @param hashes
+ */
+void NeedPacket::setHashes(const QVector<QByteArray>& hashes) {
+  this->hashes = hashes;
+}
+
+/**
+ * @brief Get the Hashes object
+ *
+ * @return QVector<QByteArray>
+ */
+QVector<QByteArray> NeedPacket::getHashes() const noexcept {
+  return this->hashes;
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray NeedPacket::toBytes() const {
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  stream << this->getPacketLength();
+  stream << this->packetType;
+  stream.writeRawData(this->originId.toRfc4122().constData(), originIdLength);
+  stream << this->sequence;
+  stream << this->getHashCount();
+
+  for (const auto& hash : this->hashes) {
+    stream.writeRawData(hash.constData(), contentHashLength);
+  }
+
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+NeedPacket NeedPacket::fromBytes(const QByteArray& array) {
+  auto stream = QDataStream(array);
+
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+
+  NeedPacket packet;
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  quint32 packetLength;
+  quint32 packetType;
+  QByteArray originId(originIdLength, Qt::Uninitialized);
+  quint64 sequence;
+  quint32 hashCount;
+
+  stream >> packetLength;
+  stream >> packetType;
+
+  if (packetType != PacketType::NEED_PACKET) {
+    throw common::types::exceptions::NotThisPacket("Not NeedPacket");
+  }
+
+  stream.readRawData(originId.data(), originIdLength);
+  stream >> sequence;
+  stream >> hashCount;
+
+  if (stream.status() != QDataStream::Ok || packetLength != quint32(array.size())) {
+    throw MalformedPacket(ErrorCode::CodingError, "NeedPacket");
+  }
+
+  // the hashes fill the rest of the packet
+  if (quint64(hashCount) * contentHashLength != quint64(stream.device()->bytesAvailable())) {
+    throw MalformedPacket(ErrorCode::CodingError, "NeedPacket");
+  }
+
+  QVector<QByteArray> hashes;
+  hashes.reserve(hashCount);
+
+  for (quint32 i = 0; i < hashCount; i++) {
+    QByteArray hash(contentHashLength, Qt::Uninitialized);
+    stream.readRawData(hash.data(), contentHashLength);
+    hashes.append(hash);
+  }
+
+  packet.setOriginId(QUuid::fromRfc4122(originId));
+  packet.setSequence(sequence);
+  packet.setHashes(hashes);
+
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
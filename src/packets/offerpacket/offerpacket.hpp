@@ -0,0 +1,281 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <stdexcept>
+
+// Qt header files
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QUuid>
+#include <QVector>
+#include <QtTypes>
+
+// Local header files
+#include "packets/network_packet.hpp"
+#include "packets/packet_type.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Content hashes are SHA-256 digests
+ */
+constexpr qsizetype contentHashLength = 32;
+
+/**
+ * @brief Offered item, the payload is described by its length and hash
+ */
+class OfferItem {
+ private:
+
+  QByteArray mimeType;
+  quint64 payloadLength;
+  QByteArray hash;
+
+ public:
+
+  /**
+   * @brief Get the Mime Length object
+   *
+   * @return quint32
+   */
+  quint32 getMimeLength() const noexcept;
+
+  /**
+   * @brief Set the Mime Type object
+   *
+   * @param type
+   */
+  void setMimeType(const QByteArray& type);
+
+  /**
+   * @brief Get the Mime Type object
+   *
+   * @return QByteArray
+   */
+  QByteArray getMimeType() const noexcept;
+
+  /**
+   * @brief Set the Payload Length object
+   *
+   * @param length
+   */
+  void setPayloadLength(quint64 length);
+
+  /**
+   * @brief Get the Payload Length object
+   *
+   * @return quint64
+   */
+  quint64 getPayloadLength() const noexcept;
+
+  /**
+   * @brief Set the Hash object
+   *
+   * @param hash SHA-256 of the payload
+   */
+  void setHash(const QByteArray& hash);
+
+  /**
+   * @brief Get the Hash object
+   *
+   * @return QByteArray
+   */
+  QByteArray getHash() const noexcept;
+
+  /**
+   * @brief Get the size of the item
+   *
+   * @return quint32
+   */
+  quint32 size() const noexcept;
+
+  /**
+   * @brief To Stream
+   */
+  void toStream(QDataStream& stream) const;
+
+  /**
+   * @brief From Stream
+   */
+  static OfferItem fromStream(QDataStream& stream);
+};
+
+/**
+ * @brief Offers clipboard items by hash before any payload is sent, the
+ * receiver answers with a NeedPacket listing the hashes it lacks
+ */
+class OfferPacket : public NetworkPacket {
+ private:  // private members
+
+  quint32 packetType = PacketType::OFFER_PACKET;
+  QUuid originId;
+  quint64 sequence = 0;
+  QVector<OfferItem> items;
+
+ public:
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Origin Id object
+   *
+   * @param id device the items were copied on
+   */
+  void setOriginId(const QUuid& id);
+
+  /**
+   * @brief Get the Origin Id object
+   *
+   * @return QUuid
+   */
+  QUuid getOriginId() const noexcept;
+
+  /**
+   * @brief Set the Sequence object
+   *
+   * @param sequence clock of the origin when the items were copied
+   */
+  void setSequence(quint64 sequence);
+
+  /**
+   * @brief Get the Sequence object
+   *
+   * @return quint64
+   */
+  quint64 getSequence() const noexcept;
+
+  /**
+   * @brief Get the Item Count object
+   *
+   * @return quint32
+   */
+  quint32 getItemCount() const noexcept;
+
+  /**
+   * @brief Set the Items object
+   *
+   * @param items
+   */
+  void setItems(const QVector<OfferItem>& items);
+
+  /**
+   * @brief Get the Items object
+   *
+   * @return QVector<OfferItem>
+   */
+  QVector<OfferItem> getItems() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const override;
+
+  /**
+   * @brief From Bytes
+   */
+  static OfferPacket fromBytes(const QByteArray& array);
+};
+
+/**
+ * @brief Answer to an OfferPacket with the hashes of the items whose
+ * payloads the receiver does not have, the payloads follow as a
+ * SyncingPacket or a stream with the same origin and sequence
+ */
+class NeedPacket : public NetworkPacket {
+ private:  // private members
+
+  quint32 packetType = PacketType::NEED_PACKET;
+  QUuid originId;
+  quint64 sequence = 0;
+  QVector<QByteArray> hashes;
+
+ public:
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Origin Id object
+   *
+   * @param id origin of the offer
+   */
+  void setOriginId(const QUuid& id);
+
+  /**
+   * @brief Get the Origin Id object
+   *
+   * @return QUuid
+   */
+  QUuid getOriginId() const noexcept;
+
+  /**
+   * @brief Set the Sequence object
+   *
+   * @param sequence sequence of the offer
+   */
+  void setSequence(quint64 sequence);
+
+  /**
+   * @brief Get the Sequence object
+   *
+   * @return quint64
+   */
+  quint64 getSequence() const noexcept;
+
+  /**
+   * @brief Get the Hash Count object
+   *
+   * @return quint32
+   */
+  quint32 getHashCount() const noexcept;
+
+  /**
+   * @brief Set the Hashes object
+   *
+   * @param hashes
+   */
+  void setHashes(const QVector<QByteArray>& hashes);
+
+  /**
+   * @brief Get the Hashes object
+   *
+   * @return QVector<QByteArray>
+   */
+  QVector<QByteArray> getHashes() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const override;
+
+  /**
+   * @brief From Bytes
+   */
+  static NeedPacket fromBytes(const QByteArray& array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
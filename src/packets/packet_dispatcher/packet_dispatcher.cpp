@@ -0,0 +1,25 @@
+#include "packet_dispatcher.hpp"
+
+#include <QtEndian>
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Peek the Packet Type from the header of a frame without
+ * decoding the rest of the packet
+ *
+ * @param frame length prefixed frame
+ * @return std::optional<quint32> packet type or nullopt if the
+ * frame is shorter than the header
+ */
+std::optional<quint32> peekPacketType(const QByteArray& frame) noexcept {
+  // header is the packet length followed by the packet type
+  constexpr auto lengthSize = sizeof(quint32);
+  constexpr auto typeSize   = sizeof(quint32);
+
+  if (frame.size() < qsizetype(lengthSize + typeSize)) {
+    return std::nullopt;
+  }
+
+  return qFromBigEndian<quint32>(frame.constData() + lengthSize);
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
@@ -0,0 +1,90 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <functional>
+#include <optional>
+
+// Qt header files
+#include <QByteArray>
+#include <QHash>
+#include <QtTypes>
+
+// Local header files
+#include "packets/packet_type.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Peek the Packet Type from the header of a frame without
+ * decoding the rest of the packet
+ *
+ * @param frame length prefixed frame
+ * @return std::optional<quint32> packet type or nullopt if the
+ * frame is shorter than the header
+ */
+std::optional<quint32> peekPacketType(const QByteArray& frame) noexcept;
+
+/**
+ * @brief Registry of decoders keyed on the Packet Type field, reads the
+ * header once and calls exactly one decoder for each frame
+ *
+ * @tparam Context extra arguments passed to every handler (ex: session)
+ */
+template <typename... Context>
+class PacketDispatcher {
+ private:  // types
+
+  using Decoder = std::function<void(Context..., const QByteArray&)>;
+
+ private:  // members
+
+  QHash<quint32, Decoder> decoders;
+
+ public:
+
+  /**
+   * @brief Register a handler for the Packet, the packet is decoded
+   * with Packet::fromBytes only when the header matches packetType
+   *
+   * @param packetType type field of the Packet
+   * @param handler called with the decoded Packet
+   */
+  template <typename Packet>
+  void registerPacket(quint32 packetType, std::function<void(Context..., const Packet&)> handler) {
+    decoders.insert(packetType, [handler](Context... context, const QByteArray& frame) {
+      handler(context..., Packet::fromBytes(frame));
+    });
+  }
+
+  /**
+   * @brief Check whether a decoder is registered for the type
+   */
+  bool isRegistered(quint32 packetType) const noexcept {
+    return decoders.contains(packetType);
+  }
+
+  /**
+   * @brief Decode the frame with the decoder registered for its type,
+   * exceptions thrown by the decoder (ex: MalformedPacket) are propagated
+   *
+   * @return true if a decoder handled the frame false if no decoder
+   * is registered for the type
+   */
+  bool dispatch(Context... context, const QByteArray& frame) const {
+    const auto packetType = peekPacketType(frame);
+
+    if (!packetType.has_value()) {
+      return false;
+    }
+
+    const auto decoder = decoders.constFind(packetType.value());
+
+    if (decoder == decoders.cend()) {
+      return false;
+    }
+
+    decoder.value()(context..., frame);
+
+    return true;
+  }
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
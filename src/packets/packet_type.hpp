@@ -9,5 +9,13 @@ enum PacketType : quint32 {
   PING_PONG_PACKET = 0x03,
   SYNCING_PACKET = 0x02,
   CERTIFICATE_EXCHANGE = 0x04,
+  STREAM_BEGIN_PACKET = 0x05,
+  STREAM_CHUNK_PACKET = 0x06,
+  STREAM_END_PACKET = 0x07,
+  OFFER_PACKET = 0x08,
+  NEED_PACKET = 0x09,
+  CAPABILITY_PACKET = 0x0A,
+  DELTA_PACKET = 0x0B,
+  STAMPED_SYNCING_PACKET = 0x0C,
 };
 }
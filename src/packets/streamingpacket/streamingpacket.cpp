@@ -0,0 +1,563 @@
+#include "streamingpacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+//---------------------------- StreamBeginPacket ----------------------------//
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 StreamBeginPacket::getPacketLength() const noexcept {
+  return quint32(
+    sizeof(decltype(std::declval<StreamBeginPacket>().getPacketLength())) +
+    sizeof(this->packetType) +
+    sizeof(this->transferId) +
+    sizeof(this->itemId) +
+    sizeof(this->totalLength) +
+    sizeof(decltype(std::declval<StreamBeginPacket>().getMimeLength())) +
+    this->mimeType.size() +
+    sizeof(this->encoding)
+  );
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 StreamBeginPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Transfer Id object
+ *
+ * @param id
+ */
+void StreamBeginPacket::setTransferId(quint32 id) {
+  this->transferId = id;
+}
+
+/**
+ * @brief Get the Transfer Id object
+ *
+ * @return quint32
+ */
+quint32 StreamBeginPacket::getTransferId() const noexcept {
+  return this->transferId;
+}
+
+/**
+ * @brief Set the Item Id object
+ *
+ * @param id index of the item in the transfer
+ */
+void StreamBeginPacket::setItemId(quint32 id) {
+  this->itemId = id;
+}
+
+/**
+ * @brief Get the Item Id object
+ *
+ * @return quint32
+ */
+quint32 StreamBeginPacket::getItemId() const noexcept {
+  return this->itemId;
+}
+
+/**
+ * @brief Set the Total Length object
+ *
+ * @param length length of the item payload
+ */
+void StreamBeginPacket::setTotalLength(quint64 length) {
+  this->totalLength = length;
+}
+
+/**
+ * @brief Get the Total Length object
+ *
+ * @return quint64
+ */
+quint64 StreamBeginPacket::getTotalLength() const noexcept {
+  return this->totalLength;
+}
+
+/**
+ * @brief Get the Mime Length object
+ *
+ * @return quint32
+ */
+quint32 StreamBeginPacket::getMimeLength() const noexcept {
+  return quint32(this->mimeType.size());
+}
+
+/**
+ * @brief Set the Mime Type object
+ *
+ * @param type
+ */
+void StreamBeginPacket::setMimeType(const QByteArray& type) {
+  this->mimeType = type;
+}
+
+/**
+ * @brief Get the Mime Type object
+ *
+ * @return QByteArray
+ */
+QByteArray StreamBeginPacket::getMimeType() const noexcept {
+  return this->mimeType;
+}
+
+/**
+ * @brief Set the Encoding object
+ *
+ * @param encoding encoding of the streamed payload
+ */
+void StreamBeginPacket::setEncoding(quint32 encoding) {
+  this->encoding = encoding;
+}
+
+/**
+ * @brief Get the Encoding object
+ *
+ * @return quint32
+ */
+quint32 StreamBeginPacket::getEncoding() const noexcept {
+  return this->encoding;
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray StreamBeginPacket::toBytes() const {
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  stream << this->getPacketLength();
+  stream << this->packetType;
+  stream << this->transferId;
+  stream << this->itemId;
+  stream << this->totalLength;
+  stream << this->getMimeLength();
+  stream.writeRawData(this->mimeType.data(), this->mimeType.size());
+  stream << this->encoding;
+
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+StreamBeginPacket StreamBeginPacket::fromBytes(const QByteArray& array) {
+  auto stream = QDataStream(array);
+
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+  using common::types::enums::Encoding;
+
+  StreamBeginPacket packet;
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  quint32 packetLength;
+  quint32 packetType;
+  quint32 transferId;
+  quint32 itemId;
+  quint64 totalLength;
+  quint32 mimeLength;
+
+  stream >> packetLength;
+  stream >> packetType;
+
+  if (packetType != PacketType::STREAM_BEGIN_PACKET) {
+    throw common::types::exceptions::NotThisPacket("Not StreamBeginPacket");
+  }
+
+  stream >> transferId;
+  stream >> itemId;
+  stream >> totalLength;
+  stream >> mimeLength;
+
+  if (stream.status() != QDataStream::Ok || packetLength != quint32(array.size())) {
+    throw MalformedPacket(ErrorCode::CodingError, "StreamBeginPacket");
+  }
+
+  if (mimeLength > quint32(array.size() - stream.device()->pos())) {
+    throw MalformedPacket(ErrorCode::CodingError, "StreamBeginPacket");
+  }
+
+  QByteArray mimeType(mimeLength, Qt::Uninitialized);
+
+  if (stream.readRawData(mimeType.data(), mimeLength) != qint64(mimeLength)) {
+    throw MalformedPacket(ErrorCode::CodingError, "StreamBeginPacket");
+  }
+
+  quint32 encoding;
+  stream >> encoding;
+
+  if (stream.status() != QDataStream::Ok) {
+    throw MalformedPacket(ErrorCode::CodingError, "StreamBeginPacket");
+  }
+
+  if (encoding != Encoding::Identity && encoding != Encoding::Deflate) {
+    throw MalformedPacket(ErrorCode::CodingError, "StreamBeginPacket");
+  }
+
+  packet.setTransferId(transferId);
+  packet.setItemId(itemId);
+  packet.setTotalLength(totalLength);
+  packet.setMimeType(mimeType);
+  packet.setEncoding(encoding);
+
+  return packet;
+}
+
+//---------------------------- StreamChunkPacket ----------------------------//
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 StreamChunkPacket::getPacketLength() const noexcept {
+  return quint32(
+    sizeof(decltype(std::declval<StreamChunkPacket>().getPacketLength())) +
+    sizeof(this->packetType) +
+    sizeof(this->transferId) +
+    sizeof(this->itemId) +
+    sizeof(this->offset) +
+    sizeof(decltype(std::declval<StreamChunkPacket>().getPayloadLength())) +
+    this->payload.size()
+  );
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 StreamChunkPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Transfer Id object
+ *
+ * @param id
+ */
+void StreamChunkPacket::setTransferId(quint32 id) {
+  this->transferId = id;
+}
+
+/**
+ * @brief Get the Transfer Id object
+ *
+ * @return quint32
+ */
+quint32 StreamChunkPacket::getTransferId() const noexcept {
+  return this->transferId;
+}
+
+/**
+ * @brief Set the Item Id object
+ *
+ * @param id
+ */
+void StreamChunkPacket::setItemId(quint32 id) {
+  this->itemId = id;
+}
+
+/**
+ * @brief Get the Item Id object
+ *
+ * @return quint32
+ */
+quint32 StreamChunkPacket::getItemId() const noexcept {
+  return this->itemId;
+}
+
+/**
+ * @brief Set the Offset object
+ *
+ * @param offset offset of the chunk in the item payload
+ */
+void StreamChunkPacket::setOffset(quint64 offset) {
+  this->offset = offset;
+}
+
+/**
+ * @brief Get the Offset object
+ *
+ * @return quint64
+ */
+quint64 StreamChunkPacket::getOffset() const noexcept {
+  return this->offset;
+}
+
+/**
+ * @brief Get the Payload Length object
+ *
+ * @return quint32
+ */
+quint32 StreamChunkPacket::getPayloadLength() const noexcept {
+  return quint32(this->payload.size());
+}
+
+/**
+ * @brief Set the Payload object
+ *
+ * @param payload
+ */
+void StreamChunkPacket::setPayload(const QByteArray& payload) {
+  this->payload = payload;
+}
+
+/**
+ * @brief Get the Payload object
+ *
+ * @return QByteArray
+ */
+QByteArray StreamChunkPacket::getPayload() const noexcept {
+  return this->payload;
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray StreamChunkPacket::toBytes() const {
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  byteArr.reserve(this->getPacketLength());
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  stream << this->getPacketLength();
+  stream << this->packetType;
+  stream << this->transferId;
+  stream << this->itemId;
+  stream << this->offset;
+  stream << this->getPayloadLength();
+  stream.writeRawData(this->payload.data(), this->payload.size());
+
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+StreamChunkPacket StreamChunkPacket::fromBytes(const QByteArray& array) {
+  auto stream = QDataStream(array);
+
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+
+  StreamChunkPacket packet;
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  quint32 packetLength;
+  quint32 packetType;
+  quint32 transferId;
+  quint32 itemId;
+  quint64 offset;
+  quint32 payloadLength;
+
+  stream >> packetLength;
+  stream >> packetType;
+
+  if (packetType != PacketType::STREAM_CHUNK_PACKET) {
+    throw common::types::exceptions::NotThisPacket("Not StreamChunkPacket");
+  }
+
+  stream >> transferId;
+  stream >> itemId;
+  stream >> offset;
+  stream >> payloadLength;
+
+  if (stream.status() != QDataStream::Ok || packetLength != quint32(array.size())) {
+    throw MalformedPacket(ErrorCode::CodingError, "StreamChunkPacket");
+  }
+
+  if (payloadLength != quint32(array.size() - stream.device()->pos())) {
+    throw MalformedPacket(ErrorCode::CodingError, "StreamChunkPacket");
+  }
+
+  packet.setTransferId(transferId);
+  packet.setItemId(itemId);
+  packet.setOffset(offset);
+  packet.setPayload(array.right(payloadLength));
+
+  return packet;
+}
+
+//----------------------------- StreamEndPacket -----------------------------//
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 StreamEndPacket::getPacketLength() const noexcept {
+  return quint32(
+    sizeof(decltype(std::declval<StreamEndPacket>().getPacketLength())) +
+    sizeof(this->packetType) +
+    sizeof(this->transferId) +
+    sizeof(this->itemCount) +
+    originIdLength +
+    sizeof(this->sequence)
+  );
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 StreamEndPacket::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Set the Transfer Id object
+ *
+ * @param id
+ */
+void StreamEndPacket::setTransferId(quint32 id) {
+  this->transferId = id;
+}
+
+/**
+ * @brief Get the Transfer Id object
+ *
+ * @return quint32
+ */
+quint32 StreamEndPacket::getTransferId() const noexcept {
+  return this->transferId;
+}
+
+/**
+ * @brief Set the Item Count object
+ *
+ * @param count
+ */
+void StreamEndPacket::setItemCount(quint32 count) {
+  this->itemCount = count;
+}
+
+/**
+ * @brief Get the Item Count object
+ *
+ * @return quint32
+ */
+quint32 StreamEndPacket::getItemCount() const noexcept {
+  return this->itemCount;
+}
+
+/**
+ * @brief Set the Origin Id object
+ *
+ * @param id device the items were copied on
+ */
+void StreamEndPacket::setOriginId(const QUuid& id) {
+  this->originId = id;
+}
+
+/**
+ * @brief Get the Origin Id object
+ *
+ * @return QUuid
+ */
+QUuid StreamEndPacket::getOriginId() const noexcept {
+  return this->originId;
+}
+
+/**
+ * @brief Set the Sequence object
+ *
+ * @param sequence clock of the origin when the items were copied
+ */
+void StreamEndPacket::setSequence(quint64 sequence) {
+  this->sequence = sequence;
+}
+
+/**
+ * @brief Get the Sequence object
+ *
+ * @return quint64
+ */
+quint64 StreamEndPacket::getSequence() const noexcept {
+  return this->sequence;
+}
+
+/**
+ * @brief to Bytes
+ */
+QByteArray StreamEndPacket::toBytes() const {
+  auto byteArr = QByteArray();
+  auto stream  = QDataStream(&byteArr, QIODevice::WriteOnly);
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  stream << this->getPacketLength();
+  stream << this->packetType;
+  stream << this->transferId;
+  stream << this->itemCount;
+  stream.writeRawData(this->originId.toRfc4122().constData(), originIdLength);
+  stream << this->sequence;
+
+  return byteArr;
+}
+
+/**
+ * @brief From Bytes
+ */
+StreamEndPacket StreamEndPacket::fromBytes(const QByteArray& array) {
+  auto stream = QDataStream(array);
+
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+
+  StreamEndPacket packet;
+
+  stream.setByteOrder(QDataStream::BigEndian);
+
+  quint32 packetLength;
+  quint32 packetType;
+  quint32 transferId;
+  quint32 itemCount;
+  QByteArray originId(originIdLength, Qt::Uninitialized);
+  quint64 sequence;
+
+  stream >> packetLength;
+  stream >> packetType;
+
+  if (packetType != PacketType::STREAM_END_PACKET) {
+    throw common::types::exceptions::NotThisPacket("Not StreamEndPacket");
+  }
+
+  stream >> transferId;
+  stream >> itemCount;
+
+  if (stream.readRawData(originId.data(), originIdLength) != originIdLength) {
+    throw MalformedPacket(ErrorCode::CodingError, "StreamEndPacket");
+  }
+
+  stream >> sequence;
+
+  if (stream.status() != QDataStream::Ok || packetLength != quint32(array.size())) {
+    throw MalformedPacket(ErrorCode::CodingError, "StreamEndPacket");
+  }
+
+  packet.setTransferId(transferId);
+  packet.setItemCount(itemCount);
+  packet.setOriginId(QUuid::fromRfc4122(originId));
+  packet.setSequence(sequence);
+
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
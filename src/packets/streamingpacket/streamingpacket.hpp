@@ -0,0 +1,336 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Standard header files
+#include <stdexcept>
+
+// Qt header files
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QUuid>
+#include <QtTypes>
+
+// Local header files
+#include "packets/network_packet.hpp"
+#include "packets/packet_type.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Starts one item of a streamed transfer, the payload of the
+ * item follows as StreamChunkPackets
+ */
+class StreamBeginPacket : public NetworkPacket {
+ private:  // private members
+
+  quint32 packetType = PacketType::STREAM_BEGIN_PACKET;
+  quint32 transferId;
+  quint32 itemId;
+  quint64 totalLength;
+  QByteArray mimeType;
+  quint32 encoding = common::types::enums::Encoding::Identity;
+
+ public:
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Transfer Id object
+   *
+   * @param id
+   */
+  void setTransferId(quint32 id);
+
+  /**
+   * @brief Get the Transfer Id object
+   *
+   * @return quint32
+   */
+  quint32 getTransferId() const noexcept;
+
+  /**
+   * @brief Set the Item Id object
+   *
+   * @param id index of the item in the transfer
+   */
+  void setItemId(quint32 id);
+
+  /**
+   * @brief Get the Item Id object
+   *
+   * @return quint32
+   */
+  quint32 getItemId() const noexcept;
+
+  /**
+   * @brief Set the Total Length object
+   *
+   * @param length length of the item payload
+   */
+  void setTotalLength(quint64 length);
+
+  /**
+   * @brief Get the Total Length object
+   *
+   * @return quint64
+   */
+  quint64 getTotalLength() const noexcept;
+
+  /**
+   * @brief Get the Mime Length object
+   *
+   * @return quint32
+   */
+  quint32 getMimeLength() const noexcept;
+
+  /**
+   * @brief Set the Mime Type object
+   *
+   * @param type
+   */
+  void setMimeType(const QByteArray& type);
+
+  /**
+   * @brief Get the Mime Type object
+   *
+   * @return QByteArray
+   */
+  QByteArray getMimeType() const noexcept;
+
+  /**
+   * @brief Set the Encoding object
+   *
+   * @param encoding encoding of the streamed payload
+   */
+  void setEncoding(quint32 encoding);
+
+  /**
+   * @brief Get the Encoding object
+   *
+   * @return quint32
+   */
+  quint32 getEncoding() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const override;
+
+  /**
+   * @brief From Bytes
+   */
+  static StreamBeginPacket fromBytes(const QByteArray& array);
+};
+
+/**
+ * @brief Fragment of an item payload at the given offset
+ */
+class StreamChunkPacket : public NetworkPacket {
+ private:  // private members
+
+  quint32 packetType = PacketType::STREAM_CHUNK_PACKET;
+  quint32 transferId;
+  quint32 itemId;
+  quint64 offset;
+  QByteArray payload;
+
+ public:
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Transfer Id object
+   *
+   * @param id
+   */
+  void setTransferId(quint32 id);
+
+  /**
+   * @brief Get the Transfer Id object
+   *
+   * @return quint32
+   */
+  quint32 getTransferId() const noexcept;
+
+  /**
+   * @brief Set the Item Id object
+   *
+   * @param id
+   */
+  void setItemId(quint32 id);
+
+  /**
+   * @brief Get the Item Id object
+   *
+   * @return quint32
+   */
+  quint32 getItemId() const noexcept;
+
+  /**
+   * @brief Set the Offset object
+   *
+   * @param offset offset of the chunk in the item payload
+   */
+  void setOffset(quint64 offset);
+
+  /**
+   * @brief Get the Offset object
+   *
+   * @return quint64
+   */
+  quint64 getOffset() const noexcept;
+
+  /**
+   * @brief Get the Payload Length object
+   *
+   * @return quint32
+   */
+  quint32 getPayloadLength() const noexcept;
+
+  /**
+   * @brief Set the Payload object
+   *
+   * @param payload
+   */
+  void setPayload(const QByteArray& payload);
+
+  /**
+   * @brief Get the Payload object
+   *
+   * @return QByteArray
+   */
+  QByteArray getPayload() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const override;
+
+  /**
+   * @brief From Bytes
+   */
+  static StreamChunkPacket fromBytes(const QByteArray& array);
+};
+
+/**
+ * @brief Ends a streamed transfer, the receiver commits the items
+ * only if every item announced is complete, the origin and sequence
+ * of the items are carried here like in the SyncingPacket
+ */
+class StreamEndPacket : public NetworkPacket {
+ private:  // private members
+
+  quint32 packetType = PacketType::STREAM_END_PACKET;
+  quint32 transferId;
+  quint32 itemCount;
+  QUuid originId;
+  quint64 sequence = 0;
+
+ public:
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Set the Transfer Id object
+   *
+   * @param id
+   */
+  void setTransferId(quint32 id);
+
+  /**
+   * @brief Get the Transfer Id object
+   *
+   * @return quint32
+   */
+  quint32 getTransferId() const noexcept;
+
+  /**
+   * @brief Set the Item Count object
+   *
+   * @param count
+   */
+  void setItemCount(quint32 count);
+
+  /**
+   * @brief Get the Item Count object
+   *
+   * @return quint32
+   */
+  quint32 getItemCount() const noexcept;
+
+  /**
+   * @brief Set the Origin Id object
+   *
+   * @param id device the items were copied on
+   */
+  void setOriginId(const QUuid& id);
+
+  /**
+   * @brief Get the Origin Id object
+   *
+   * @return QUuid
+   */
+  QUuid getOriginId() const noexcept;
+
+  /**
+   * @brief Set the Sequence object
+   *
+   * @param sequence clock of the origin when the items were copied
+   */
+  void setSequence(quint64 sequence);
+
+  /**
+   * @brief Get the Sequence object
+   *
+   * @return quint64
+   */
+  quint64 getSequence() const noexcept;
+
+  /**
+   * @brief to Bytes
+   */
+  QByteArray toBytes() const override;
+
+  /**
+   * @brief From Bytes
+   */
+  static StreamEndPacket fromBytes(const QByteArray& array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
@@ -29,6 +29,24 @@ QByteArray SyncingItem::getMimeType() const noexcept {
   return this->mimeType;
 }
 
+/**
+ * @brief Set the Encoding object
+ *
+ * @param encoding encoding of the payload
+ */
+void SyncingItem::setEncoding(quint32 encoding) {
+  this->encoding = encoding;
+}
+
+/**
+ * @brief Get the Encoding object
+ *
+ * @return quint32
+ */
+quint32 SyncingItem::getEncoding() const noexcept {
+  return this->encoding;
+}
+
 /**
  * @brief Get the Payload Length object
  *
@@ -59,12 +77,14 @@ QByteArray SyncingItem::getPayload() const noexcept {
 /**
  * @brief Get the size of the packet
  *
+ * @param hasEncoding false for the legacy layout without encoding
  * @return size_t
  */
-quint32 SyncingItem::size() const noexcept {
+quint32 SyncingItem::size(bool hasEncoding) const noexcept {
   return quint32(
     sizeof(decltype(std::declval<SyncingItem>().getMimeLength())) +
     this->mimeType.size() +
+    (hasEncoding ? sizeof(this->encoding) : 0) +
     sizeof(decltype(std::declval<SyncingItem>().getPayloadLength())) +
     this->payload.size()
   );
@@ -72,10 +92,13 @@ quint32 SyncingItem::size() const noexcept {
 
 /**
  * @brief To Stream
+ *
+ * @param hasEncoding false for the legacy layout without encoding
  */
-void SyncingItem::toStream(QDataStream& stream) const {
+void SyncingItem::toStream(QDataStream& stream, bool hasEncoding) const {
   stream << this->getMimeLength();
   stream.writeRawData(this->mimeType.data(), this->getMimeLength());
+  if (hasEncoding) stream << this->encoding;
   stream << this->getPayloadLength();
   stream.writeRawData(this->payload.data(), this->getPayloadLength());
 }
@@ -100,17 +123,21 @@ QByteArray SyncingItem::toBytes() const {
 
 /**
  * @brief From Stream
+ *
+ * @param hasEncoding false for the legacy layout without encoding
  */
-SyncingItem SyncingItem::fromStream(QDataStream& stream) {
+SyncingItem SyncingItem::fromStream(QDataStream& stream, bool hasEncoding) {
   // using the utility functions
   using common::types::exceptions::MalformedPacket;
   using common::types::enums::ErrorCode;
+  using common::types::enums::Encoding;
 
   // Create the SyncingItem
   SyncingItem pack;
 
   quint32 mimeLength;
   QByteArray mimeType;
+  quint32 encoding = Encoding::Identity;
   quint32 payloadLength;
   QByteArray payload;
 
@@ -118,6 +145,7 @@ SyncingItem SyncingItem::fromStream(QDataStream& stream) {
   stream >> mimeLength;
   mimeType.resize(mimeLength);
   stream.readRawData(mimeType.data(), mimeLength);
+  if (hasEncoding) stream >> encoding;
   stream >> payloadLength;
   payload.resize(payloadLength);
   stream.readRawData(payload.data(), payloadLength);
@@ -127,7 +155,13 @@ SyncingItem SyncingItem::fromStream(QDataStream& stream) {
     throw MalformedPacket(ErrorCode::CodingError, "SyncingItem");
   }
 
+  // if the encoding is unknown
+  if (encoding != Encoding::Identity && encoding != Encoding::Deflate) {
+    throw MalformedPacket(ErrorCode::CodingError, "SyncingItem");
+  }
+
   pack.setMimeType(mimeType);
+  pack.setEncoding(encoding);
   pack.setPayload(payload);
 
   // return the payload
@@ -156,8 +190,13 @@ SyncingItem SyncingItem::fromBytes(const QByteArray &array) {
 quint32 SyncingPacket::getPacketLength() const noexcept {
   size_t size = (sizeof(decltype(std::declval<SyncingPacket>().getPacketLength())) + sizeof(this->packetType) + sizeof(decltype(std::declval<SyncingPacket>().getItemCount())));
 
+  // the legacy layout has no origin and sequence
+  if (this->isStamped()) {
+    size += originIdLength + sizeof(this->sequence);
+  }
+
   for (const auto& payload : this->items) {
-    size += payload.size();
+    size += payload.size(this->isStamped());
   }
 
   return qint32(size);
@@ -172,6 +211,64 @@ quint32 SyncingPacket::getPacketType() const noexcept {
   return this->packetType;
 }
 
+/**
+ * @brief Set the Packet Type object
+ *
+ * @param packetType STAMPED_SYNCING_PACKET or SYNCING_PACKET
+ */
+void SyncingPacket::setPacketType(quint32 packetType) {
+  if (packetType != PacketType::SYNCING_PACKET && packetType != PacketType::STAMPED_SYNCING_PACKET) {
+    throw std::invalid_argument("Not a SyncingPacket type");
+  }
+
+  this->packetType = packetType;
+}
+
+/**
+ * @brief Whether the packet carries origin, sequence and encodings
+ *
+ * @return bool
+ */
+bool SyncingPacket::isStamped() const noexcept {
+  return this->packetType == PacketType::STAMPED_SYNCING_PACKET;
+}
+
+/**
+ * @brief Set the Origin Id object
+ *
+ * @param id device the items were copied on
+ */
+void SyncingPacket::setOriginId(const QUuid& id) {
+  this->originId = id;
+}
+
+/**
+ * @brief Get the Origin Id object
+ *
+ * @return QUuid
+ */
+QUuid SyncingPacket::getOriginId() const noexcept {
+  return this->originId;
+}
+
+/**
+ * @brief Set the Sequence object
+ *
+ * @param sequence clock of the origin when the items were copied
+ */
+void SyncingPacket::setSequence(quint64 sequence) {
+  this->sequence = sequence;
+}
+
+/**
+ * @brief Get the Sequence object
+ *
+ * @return quint64
+ */
+quint64 SyncingPacket::getSequence() const noexcept {
+  return this->sequence;
+}
+
 /**
  * @brief Get the Item Count object
  *
@@ -199,6 +296,21 @@ QVector<SyncingItem> SyncingPacket::getItems() const noexcept {
   return this->items;
 }
 
+/**
+ * @brief Get the bit set of the encodings used by the items
+ *
+ * @return quint32
+ */
+quint32 SyncingPacket::getEncodings() const noexcept {
+  quint32 encodings = 0;
+
+  for (const auto& item : this->items) {
+    encodings |= quint32(1) << item.getEncoding();
+  }
+
+  return encodings;
+}
+
 /**
  * @brief to Bytes
  */
@@ -213,11 +325,17 @@ QByteArray SyncingPacket::toBytes() const {
   // Write the fields
   stream << this->getPacketLength();
   stream << this->packetType;
+
+  if (this->isStamped()) {
+    stream.writeRawData(this->originId.toRfc4122().constData(), originIdLength);
+    stream << this->sequence;
+  }
+
   stream << this->getItemCount();
 
   // Write the Payloads
   for (const auto& payload : this->items) {
-    payload.toStream(stream);
+    payload.toStream(stream, this->isStamped());
   }
 
   // Return the QByteArray
@@ -243,18 +361,28 @@ SyncingPacket SyncingPacket::fromBytes(const QByteArray &array) {
 
   quint32 packetLength;
   quint32 packetType;
+  QByteArray originId(originIdLength, '\0');
+  quint64 sequence = 0;
   quint32 itemCount;
 
   // Read the Packet Fields
   stream >> packetLength;
   stream >> packetType;
-  stream >> itemCount;
 
   // check the packet type
-  if (packetType != PacketType::SYNCING_PACKET) {
+  if (packetType != PacketType::SYNCING_PACKET && packetType != PacketType::STAMPED_SYNCING_PACKET) {
     throw common::types::exceptions::NotThisPacket("Not SyncingPacket");
   }
 
+  packet.setPacketType(packetType);
+
+  if (packet.isStamped()) {
+    stream.readRawData(originId.data(), originIdLength);
+    stream >> sequence;
+  }
+
+  stream >> itemCount;
+
   // if the stream is not good
   if (stream.status() != QDataStream::Ok) {
     throw MalformedPacket(ErrorCode::CodingError, "SyncingPacket");
@@ -264,7 +392,7 @@ SyncingPacket SyncingPacket::fromBytes(const QByteArray &array) {
 
   // Read the Payloads
   for (quint32 i = 0; i < itemCount; i++) {
-    items.push_back(SyncingItem::fromStream(stream));
+    items.push_back(SyncingItem::fromStream(stream, packet.isStamped()));
   }
 
   // if the stream is not good
@@ -272,6 +400,8 @@ SyncingPacket SyncingPacket::fromBytes(const QByteArray &array) {
     throw MalformedPacket(ErrorCode::CodingError, "SyncingPacket");
   }
 
+  packet.setOriginId(QUuid::fromRfc4122(originId));
+  packet.setSequence(sequence);
   packet.setItems(items);
 
   // return the packet
@@ -8,6 +8,7 @@
 #include <QByteArray>
 #include <QDataStream>
 #include <QIODevice>
+#include <QUuid>
 #include <QtTypes>
 
 // Local header files
@@ -24,6 +25,7 @@ class SyncingItem {
  private:
 
   QByteArray mimeType;
+  quint32 encoding = common::types::enums::Encoding::Identity;
   QByteArray payload;
 
  public:
@@ -49,6 +51,20 @@ class SyncingItem {
    */
   QByteArray getMimeType() const noexcept;
 
+  /**
+   * @brief Set the Encoding object
+   *
+   * @param encoding encoding of the payload
+   */
+  void setEncoding(quint32 encoding);
+
+  /**
+   * @brief Get the Encoding object
+   *
+   * @return quint32
+   */
+  quint32 getEncoding() const noexcept;
+
   /**
    * @brief Get the Payload Length object
    *
@@ -73,14 +89,17 @@ class SyncingItem {
   /**
    * @brief Get the size of the packet
    *
+   * @param hasEncoding false for the legacy layout without encoding
    * @return size_t
    */
-  quint32 size() const noexcept;
+  quint32 size(bool hasEncoding = true) const noexcept;
 
   /**
    * @brief To Stream
+   *
+   * @param hasEncoding false for the legacy layout without encoding
    */
-  void toStream(QDataStream& stream) const;
+  void toStream(QDataStream& stream, bool hasEncoding = true) const;
 
   /**
    * @brief to Bytes
@@ -89,8 +108,10 @@ class SyncingItem {
 
   /**
    * @brief From Stream
+   *
+   * @param hasEncoding false for the legacy layout without encoding
    */
-  static SyncingItem fromStream(QDataStream& stream);
+  static SyncingItem fromStream(QDataStream& stream, bool hasEncoding = true);
 
   /**
    * @brief From Bytes
@@ -99,12 +120,16 @@ class SyncingItem {
 };
 
 /**
- * @brief Clipboard Sync Packet
+ * @brief Clipboard Sync Packet, STAMPED_SYNCING_PACKET carries the
+ * origin, sequence and item encodings, SYNCING_PACKET is the legacy
+ * layout without them for peers that did not announce capabilities
  */
 class SyncingPacket: public NetworkPacket {
  private:  // private members
 
-  quint32 packetType = PacketType::SYNCING_PACKET;
+  quint32 packetType = PacketType::STAMPED_SYNCING_PACKET;
+  QUuid originId;
+  quint64 sequence = 0;
   QVector<SyncingItem> items;
 
  public:
@@ -123,6 +148,48 @@ class SyncingPacket: public NetworkPacket {
    */
   quint32 getPacketType() const noexcept;
 
+  /**
+   * @brief Set the Packet Type object
+   *
+   * @param packetType STAMPED_SYNCING_PACKET or SYNCING_PACKET
+   */
+  void setPacketType(quint32 packetType);
+
+  /**
+   * @brief Whether the packet carries origin, sequence and encodings
+   *
+   * @return bool
+   */
+  bool isStamped() const noexcept;
+
+  /**
+   * @brief Set the Origin Id object
+   *
+   * @param id device the items were copied on
+   */
+  void setOriginId(const QUuid& id);
+
+  /**
+   * @brief Get the Origin Id object
+   *
+   * @return QUuid
+   */
+  QUuid getOriginId() const noexcept;
+
+  /**
+   * @brief Set the Sequence object
+   *
+   * @param sequence clock of the origin when the items were copied
+   */
+  void setSequence(quint64 sequence);
+
+  /**
+   * @brief Get the Sequence object
+   *
+   * @return quint64
+   */
+  quint64 getSequence() const noexcept;
+
   /**
    * @brief Get the Item Count object
    *
@@ -144,6 +211,13 @@ class SyncingPacket: public NetworkPacket {
    */
   QVector<SyncingItem> getItems() const noexcept;
 
+  /**
+   * @brief Get the bit set of the encodings used by the items
+   *
+   * @return quint32
+   */
+  quint32 getEncodings() const noexcept;
+
   /**
    * @brief to Bytes
    */
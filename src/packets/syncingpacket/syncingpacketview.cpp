@@ -0,0 +1,266 @@
+#include "syncingpacketview.hpp"
+
+#include <QtEndian>
+
+#include "utility/functions/compression/compression.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets::internal {
+/**
+ * @brief Read big endian quint32 from the frame at the offset
+ */
+quint32 readUInt32(const QByteArray &array, qsizetype offset) {
+  return qFromBigEndian<quint32>(array.constData() + offset);
+}
+
+/**
+ * @brief Read big endian quint64 from the frame at the offset
+ */
+quint64 readUInt64(const QByteArray &array, qsizetype offset) {
+  return qFromBigEndian<quint64>(array.constData() + offset);
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::packets::internal
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+using internal::readUInt32;
+using internal::readUInt64;
+
+/**
+ * @brief Get the Packet Length object
+ *
+ * @return quint32
+ */
+quint32 SyncingPacketView::getPacketLength() const noexcept {
+  return quint32(this->frame.size());
+}
+
+/**
+ * @brief Get the Packet Type object
+ *
+ * @return quint32
+ */
+quint32 SyncingPacketView::getPacketType() const noexcept {
+  return this->packetType;
+}
+
+/**
+ * @brief Whether the sender stamped the items with origin and sequence
+ *
+ * @return bool
+ */
+bool SyncingPacketView::isStamped() const noexcept {
+  return this->packetType == PacketType::STAMPED_SYNCING_PACKET;
+}
+
+/**
+ * @brief Get the Origin Id object
+ *
+ * @return QUuid
+ */
+QUuid SyncingPacketView::getOriginId() const noexcept {
+  return this->originId;
+}
+
+/**
+ * @brief Get the Sequence object
+ *
+ * @return quint64
+ */
+quint64 SyncingPacketView::getSequence() const noexcept {
+  return this->sequence;
+}
+
+/**
+ * @brief Get the Item Count object
+ *
+ * @return quint32
+ */
+quint32 SyncingPacketView::getItemCount() const noexcept {
+  return quint32(this->items.size());
+}
+
+/**
+ * @brief Get the Mime Type of the item
+ *
+ * @param index
+ * @return QByteArrayView valid while the view is alive
+ */
+QByteArrayView SyncingPacketView::getMimeType(qsizetype index) const {
+  const auto &item = this->items.at(index);
+  return QByteArrayView(this->frame.constData() + item.mimeOffset, item.mimeLength);
+}
+
+/**
+ * @brief Get the Encoding of the item
+ *
+ * @param index
+ * @return quint32
+ */
+quint32 SyncingPacketView::getEncoding(qsizetype index) const {
+  return this->items.at(index).encoding;
+}
+
+/**
+ * @brief Get the bit set of the encodings used by the items
+ *
+ * @return quint32
+ */
+quint32 SyncingPacketView::getEncodings() const noexcept {
+  quint32 encodings = 0;
+
+  for (const auto &item : this->items) {
+    encodings |= utility::functions::encodingBit(item.encoding);
+  }
+
+  return encodings;
+}
+
+/**
+ * @brief Get the encoded Payload of the item without copying it
+ *
+ * @param index
+ * @return QByteArrayView valid while the view is alive
+ */
+QByteArrayView SyncingPacketView::getPayloadView(qsizetype index) const {
+  const auto &item = this->items.at(index);
+  return QByteArrayView(this->frame.constData() + item.payloadOffset, item.payloadLength);
+}
+
+/**
+ * @brief Get the decoded Payload of the item
+ *
+ * @param index
+ * @return QByteArray owning its bytes so it outlives the view
+ */
+QByteArray SyncingPacketView::getPayload(qsizetype index) const {
+  const auto &item   = this->items.at(index);
+  const auto encoded = this->getPayloadView(index);
+
+  // identity items are copied once, compressed ones are inflated from the
+  // frame which is alive for the duration of the call
+  if (item.encoding == common::types::enums::Encoding::Identity) {
+    return encoded.toByteArray();
+  }
+
+  return utility::functions::decodePayload(item.encoding, QByteArray::fromRawData(encoded.data(), encoded.size()));
+}
+
+/**
+ * @brief Get the items as mime type and payload pairs
+ *
+ * @return QVector<QPair<QString, QByteArray>> decoded payloads
+ */
+QVector<QPair<QString, QByteArray>> SyncingPacketView::getItems() const {
+  QVector<QPair<QString, QByteArray>> result;
+  result.reserve(this->items.size());
+
+  for (qsizetype i = 0; i < this->items.size(); i++) {
+    result.append(qMakePair(QString::fromUtf8(this->getMimeType(i)), this->getPayload(i)));
+  }
+
+  return result;
+}
+
+/**
+ * @brief to Bytes returns the received frame as it is
+ */
+QByteArray SyncingPacketView::toBytes() const {
+  return this->frame;
+}
+
+/**
+ * @brief From Bytes
+ */
+SyncingPacketView SyncingPacketView::fromBytes(const QByteArray &array) {
+  // using the utility functions
+  using common::types::exceptions::MalformedPacket;
+  using common::types::enums::ErrorCode;
+  using common::types::enums::Encoding;
+
+  // size of each of the integer fields
+  constexpr qsizetype fieldSize = sizeof(quint32);
+
+  // packet length and packet type
+  if (array.size() < 2 * fieldSize) {
+    throw MalformedPacket(ErrorCode::CodingError, "SyncingPacket");
+  }
+
+  const quint32 packetType = readUInt32(array, fieldSize);
+
+  // check the packet type
+  if (packetType != PacketType::SYNCING_PACKET && packetType != PacketType::STAMPED_SYNCING_PACKET) {
+    throw common::types::exceptions::NotThisPacket("Not SyncingPacket");
+  }
+
+  const bool isStamped = packetType == PacketType::STAMPED_SYNCING_PACKET;
+
+  // origin id and sequence of the stamped layout and the item count
+  const qsizetype headerSize = 3 * fieldSize + (isStamped ? originIdLength + qsizetype(sizeof(quint64)) : 0);
+
+  if (array.size() < headerSize) {
+    throw MalformedPacket(ErrorCode::CodingError, "SyncingPacket");
+  }
+
+  // check the packet length
+  if (readUInt32(array, 0) != quint32(array.size())) {
+    throw MalformedPacket(ErrorCode::CodingError, "SyncingPacket");
+  }
+
+  const quint32 itemCount = readUInt32(array, headerSize - fieldSize);
+  qsizetype offset = headerSize;
+
+  // Create the SyncingPacketView
+  SyncingPacketView packet;
+
+  packet.packetType = packetType;
+
+  if (isStamped) {
+    packet.originId = QUuid::fromRfc4122(QByteArrayView(array.constData() + 2 * fieldSize, originIdLength));
+    packet.sequence = readUInt64(array, 2 * fieldSize + originIdLength);
+  }
+
+  // Validate the items
+  for (quint32 i = 0; i < itemCount; i++) {
+    ItemRange item;
+
+    if (array.size() - offset < fieldSize) {
+      throw MalformedPacket(ErrorCode::CodingError, "SyncingItem");
+    }
+
+    item.mimeLength = readUInt32(array, offset);
+    item.mimeOffset = offset + fieldSize;
+    offset          = item.mimeOffset + item.mimeLength;
+
+    // encoding and payload length
+    if (array.size() - offset < (isStamped ? 2 : 1) * fieldSize) {
+      throw MalformedPacket(ErrorCode::CodingError, "SyncingItem");
+    }
+
+    item.encoding = isStamped ? readUInt32(array, offset) : quint32(Encoding::Identity);
+    offset        = isStamped ? offset + fieldSize : offset;
+
+    if (item.encoding != Encoding::Identity && item.encoding != Encoding::Deflate) {
+      throw MalformedPacket(ErrorCode::CodingError, "SyncingItem");
+    }
+
+    item.payloadLength = readUInt32(array, offset);
+    item.payloadOffset = offset + fieldSize;
+    offset             = item.payloadOffset + item.payloadLength;
+
+    if (offset > array.size()) {
+      throw MalformedPacket(ErrorCode::CodingError, "SyncingItem");
+    }
+
+    packet.items.append(item);
+  }
+
+  // no trailing bytes after the items
+  if (offset != array.size()) {
+    throw MalformedPacket(ErrorCode::CodingError, "SyncingPacket");
+  }
+
+  packet.frame = array;
+
+  // return the packet
+  return packet;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
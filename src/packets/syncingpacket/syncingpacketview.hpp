@@ -0,0 +1,149 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt header files
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QPair>
+#include <QString>
+#include <QUuid>
+#include <QVector>
+#include <QtTypes>
+
+// Local header files
+#include "packets/network_packet.hpp"
+#include "packets/packet_type.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::packets {
+/**
+ * @brief Read only view of a received SyncingPacket, the frame is
+ * validated once and kept as it is so it can be forwarded without
+ * encoding it again, mime types and encoded payloads are views into it,
+ * parsing is deferred and a payload is copied or decoded only when it is
+ * read, items that outlive the frame own a copy of their bytes since a
+ * slice of a QByteArray can not share its buffer, the legacy layout
+ * reads as a nil origin, sequence 0 and items as is
+ */
+class SyncingPacketView : public NetworkPacket {
+ private:  // types
+
+  struct ItemRange {
+    qsizetype mimeOffset;
+    qsizetype mimeLength;
+    quint32 encoding;
+    qsizetype payloadOffset;
+    qsizetype payloadLength;
+  };
+
+ private:  // members
+
+  QByteArray frame;
+  quint32 packetType = PacketType::STAMPED_SYNCING_PACKET;
+  QUuid originId;
+  quint64 sequence = 0;
+  QVector<ItemRange> items;
+
+ public:
+
+  /**
+   * @brief Get the Packet Length object
+   *
+   * @return quint32
+   */
+  quint32 getPacketLength() const noexcept;
+
+  /**
+   * @brief Get the Packet Type object
+   *
+   * @return quint32
+   */
+  quint32 getPacketType() const noexcept;
+
+  /**
+   * @brief Whether the sender stamped the items with origin and sequence
+   *
+   * @return bool
+   */
+  bool isStamped() const noexcept;
+
+  /**
+   * @brief Get the Origin Id object
+   *
+   * @return QUuid
+   */
+  QUuid getOriginId() const noexcept;
+
+  /**
+   * @brief Get the Sequence object
+   *
+   * @return quint64
+   */
+  quint64 getSequence() const noexcept;
+
+  /**
+   * @brief Get the Item Count object
+   *
+   * @return quint32
+   */
+  quint32 getItemCount() const noexcept;
+
+  /**
+   * @brief Get the Mime Type of the item
+   *
+   * @param index
+   * @return QByteArrayView valid while the view is alive
+   */
+  QByteArrayView getMimeType(qsizetype index) const;
+
+  /**
+   * @brief Get the Encoding of the item
+   *
+   * @param index
+   * @return quint32
+   */
+  quint32 getEncoding(qsizetype index) const;
+
+  /**
+   * @brief Get the bit set of the encodings used by the items
+   *
+   * @return quint32
+   */
+  quint32 getEncodings() const noexcept;
+
+  /**
+   * @brief Get the encoded Payload of the item without copying it
+   *
+   * @param index
+   * @return QByteArrayView valid while the view is alive
+   */
+  QByteArrayView getPayloadView(qsizetype index) const;
+
+  /**
+   * @brief Get the decoded Payload of the item, an identity payload is
+   * copied out of the frame, use getPayloadView while the view is alive
+   * to read it without a copy
+   *
+   * @param index
+   * @return QByteArray owning its bytes so it outlives the view
+   */
+  QByteArray getPayload(qsizetype index) const;
+
+  /**
+   * @brief Get the items as mime type and payload pairs
+   *
+   * @return QVector<QPair<QString, QByteArray>> decoded payloads
+   */
+  QVector<QPair<QString, QByteArray>> getItems() const;
+
+  /**
+   * @brief to Bytes returns the received frame as it is
+   */
+  QByteArray toBytes() const override;
+
+  /**
+   * @brief From Bytes
+   */
+  static SyncingPacketView fromBytes(const QByteArray &array);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::packets
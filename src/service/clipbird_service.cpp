@@ -1,9 +1,9 @@
 #include "clipbird_service.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::service {
-void ClipbirdService::handleClientDisconnected(syncing::Session* session) {
+void ClipbirdService::handleClientDisconnected(syncing::SessionInfo session) {
   for (auto server: syncingManager->getAvailableServers()) {
-    if (trustedServers->hasTrustedServer(server->getName()) && server->getName() != session->getName()) {
+    if (trustedServers->hasTrustedServer(server->getName()) && server->getName() != session.name) {
       syncingManager->connectToServer(server);
       break;
     }
@@ -16,22 +16,23 @@ void ClipbirdService::handleServerFound(syncing::ClientServer* server) {
   }
 }
 
-void ClipbirdService::handleClientConnected(syncing::Session* client) {
-  if (this->trustedClients->isTrustedClient(common::trust::TrustedClient{client->getName(), client->getCertificate()})) {
-    client->sendPacket(utility::functions::createPacket(utility::functions::params::AuthenticationParams{common::types::enums::AuthOkay}));
+void ClipbirdService::handleClientConnected(syncing::SessionInfo client) {
+  // the session lives in the syncing thread so only its values are read here
+  if (this->trustedClients->isTrustedClient(common::trust::TrustedClient{client.name, client.certificate})) {
+    syncingManager->authenticate(client.session, common::types::enums::AuthOkay);
     return;
   }
 
   ui::gui::notification::JoinRequest *joinRequest = new ui::gui::notification::JoinRequest(this);
 
   auto handleAccept = [client, joinRequest, this]() {
-    trustedClients->addTrustedClient(common::trust::TrustedClient{client->getName(), client->getCertificate()});
-    client->sendPacket(utility::functions::createPacket(utility::functions::params::AuthenticationParams{common::types::enums::AuthOkay}));
+    trustedClients->addTrustedClient(common::trust::TrustedClient{client.name, client.certificate});
+    syncingManager->authenticate(client.session, common::types::enums::AuthOkay);
     joinRequest->deleteLater();
   };
 
-  auto handleReject = [client, joinRequest]() {
-    client->sendPacket(utility::functions::createPacket(utility::functions::params::AuthenticationParams{common::types::enums::AuthFail}));
+  auto handleReject = [client, joinRequest, this]() {
+    syncingManager->authenticate(client.session, common::types::enums::AuthFail);
     joinRequest->deleteLater();
   };
 
@@ -47,7 +48,7 @@ void ClipbirdService::handleClientConnected(syncing::Session* client) {
     handleReject
   );
 
-  joinRequest->show(client->getName());
+  joinRequest->show(client.name);
 }
 
 void ClipbirdService::setHostState(bool isServer, bool useBluetooth) {
@@ -98,7 +99,7 @@ ClipbirdService::ClipbirdService(QObject* parent): QObject(parent) {
     applicationClipboard,
     &clipboard::ApplicationClipboard::OnClipboardChange,
     syncingManager,
-    &syncing::SyncingManager::synchronize
+    qOverload<const QVector<QPair<QString, QByteArray>>&, quint64>(&syncing::SyncingManager::synchronize)
   );
 
   QObject::connect(
@@ -117,6 +118,24 @@ ClipbirdService::ClipbirdService(QObject* parent): QObject(parent) {
     }
   );
 
+  QObject::connect(
+    applicationState,
+    &ApplicatiionState::historyDepthChanged,
+    clipboardHistory,
+    &history::ClipboardHistory::setDepth
+  );
+
+  QObject::connect(
+    applicationState,
+    &ApplicatiionState::clipboardDebounceChanged,
+    applicationClipboard,
+    &clipboard::ApplicationClipboard::setDebounceInterval
+  );
+
+  clipboardHistory->setDepth(applicationState->getHistoryDepth());
+
+  applicationClipboard->setDebounceInterval(applicationState->getClipboardDebounce());
+
   this->setHostState(
     applicationState->getIsServer(),
     applicationState->shouldUseBluetooth()
@@ -20,9 +20,9 @@ class ClipbirdService : public QObject {
   Q_DISABLE_COPY_MOVE(ClipbirdService)
 
  private:
-  void handleClientDisconnected(syncing::Session* session);
+  void handleClientDisconnected(syncing::SessionInfo session);
   void handleServerFound(syncing::ClientServer* server);
-  void handleClientConnected(syncing::Session* client);
+  void handleClientConnected(syncing::SessionInfo client);
   void setHostState(bool isServer, bool useBluetooth);
 
  public:
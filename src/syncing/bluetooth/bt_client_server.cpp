@@ -19,6 +19,14 @@ BtClientServer::~BtClientServer() {
   // No additional implementation needed
 }
 
+KnownEndpoint BtClientServer::getEndpoint() const {
+  return KnownEndpoint{
+    btResolvedDevice.name,
+    common::types::enums::Transport::Bluetooth,
+    btResolvedDevice.address.toString()
+  };
+}
+
 void BtClientServer::connect(syncing::ClientServerEventHandler *handler) {
   BtClientServerSession* session = new BtClientServerSession(
     trustedServers,
@@ -27,5 +27,6 @@ class BtClientServer : public ClientServer {
   virtual void connect(
     syncing::ClientServerEventHandler *handler
   ) override;
+  virtual KnownEndpoint getEndpoint() const override;
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing
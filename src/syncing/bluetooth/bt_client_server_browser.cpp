@@ -1,5 +1,7 @@
 #include "bt_client_server_browser.hpp"
 
+#include "syncing/bluetooth/bt_constants.hpp"
+
 namespace srilakshmikanthanp::clipbirdesk::syncing::bluetooth {
 
 BtClientServerBrowser::BtClientServerBrowser(
@@ -89,6 +91,11 @@ void BtClientServerBrowser::stop() {
   sdpBrowser->stop();
 }
 
+ClientServer* BtClientServerBrowser::createClientServer(const KnownEndpoint& endpoint) {
+  BtResolvedDevice device{endpoint.name, QBluetoothAddress(endpoint.host), QBluetoothUuid(BT_SERVICE_UUID)};
+  return new BtClientServer(device, sslConfig, trustedServers, this);
+}
+
 BtClientServerBrowser::~BtClientServerBrowser() {
   this->stop();
 }
@@ -5,6 +5,7 @@
 #include "constants/constants.hpp"
 #include "packets/certificate_exchange_packet/certificate_exchange_packet.hpp"
 #include "common/types/exceptions/exceptions.hpp"
+#include "utility/functions/crypto/crypto.hpp"
 #include "utility/functions/nbytes/nbytes.hpp"
 #include "utility/functions/packet/packet.hpp"
 #include "utility/functions/packet/packet.hpp"
@@ -12,6 +13,7 @@
 namespace srilakshmikanthanp::clipbirdesk::syncing::bluetooth {
 void BtClientServerSession::handleCertificateExchangePacket(const packets::CertificateExchangePacket& packet) {
   this->certificate = packet.getCertificate();
+  this->fingerprint = utility::functions::fingerprint(this->certificate);
   emit this->connected(this);
 }
 
@@ -21,32 +23,14 @@ void BtClientServerSession::handleTrustedServersChanged(QList<common::trust::Tru
   }
 }
 
-void BtClientServerSession::handlePingTimeout() {
-  using utility::functions::params::PingPacketParams;
-  using utility::functions::createPacket;
-  auto pingPacket = createPacket(PingPacketParams{common::types::enums::PingType::Ping});
-  this->sendPacket(pingPacket);
-}
-
-void BtClientServerSession::handlePongTimeout() {
-  auto lastRead = m_bt_socket->property(READ_TIME).toDateTime();
-  auto now      = QDateTime::currentDateTime();
-  auto diff     = lastRead.msecsTo(now);
-
-  if (diff > constants::getAppMaxReadIdleTime()) {
-    m_bt_socket->disconnectFromService();
-  }
-}
-
 void BtClientServerSession::handleConnected() {
   this->m_bt_socket->write(utility::functions::createPacket({this->sslConfig.certificate}).toBytes());
-  this->m_pingTimer->start(constants::getAppMaxWriteIdleTime());
-  this->m_pongTimer->start(constants::getAppMaxReadIdleTime());
+  this->startHeartbeat();
 }
 
 void BtClientServerSession::handleDisconnected() {
-  this->m_pingTimer->stop();
-  this->m_pongTimer->stop();
+  this->decoder.clear();
+  this->stopHeartbeat();
   emit disconnected(this);
 }
 
@@ -56,152 +40,42 @@ void BtClientServerSession::handleError(QBluetoothSocket::SocketError socketErro
   ));
 }
 
-void BtClientServerSession::handleReadyRead() {
-  using utility::functions::fromQByteArray;
-
-  m_bt_socket->setProperty(READ_TIME, QDateTime::currentDateTime());
-
-  // get the first four bytes of the packet
-  QDataStream get(m_bt_socket);
-
-  // QByteArray to store the data
-  QByteArray data;
-
-  /// uploader QDataStream
-  QDataStream put(&data, QIODevice::WriteOnly);
-
-  // start the transaction
-  get.startTransaction();
-
-  // get the packet length
-  qint32 packetLength;
-
-  // read the packet length
-  get >> packetLength;
-
-  // write the packet length
-  put << packetLength;
-
-  // infer the read size
-  auto toRead = packetLength - data.length();
-
-  // check has enough bytes
-  if (m_bt_socket->bytesAvailable() < toRead) {
-    return get.rollbackTransaction();
-  }
-
-  // resize the data
-  data.resize(packetLength);
-
-  // read the data from the socket
-  auto start = data.data() + data.size() - toRead;
-  auto bytes = get.readRawData(start, toRead);
-
-  // check for error
-  if (bytes == -1) {
-    return get.rollbackTransaction();
-  }
-
-  // update the toRead
-  toRead -= bytes;
-
-  // if toRead is not zero then return
-  if (toRead) {
-    return get.rollbackTransaction();
-  }
-
-  // commit the transaction
-  if (!get.commitTransaction()) {
-    return;
-  }
-
-  try {
-    this->handleCertificateExchangePacket(fromQByteArray<packets::CertificateExchangePacket>(data));
-    return;
-  } catch (const common::types::exceptions::MalformedPacket& e) {
-    qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
-  } catch (const std::exception& e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
-  }
+void BtClientServerSession::handleFrame(const QByteArray& data) {
+  // certificate exchange must complete before any other packet
+  const auto packetType = packets::peekPacketType(data);
 
-  if (!this->isHandshakeCompleted()) {
+  if (packetType != packets::PacketType::CERTIFICATE_EXCHANGE && !this->isHandshakeCompleted()) {
+    this->decoder.clear();
     this->m_bt_socket->disconnectFromService();
     return;
   }
 
   try {
-    emit this->networkPacket(this, fromQByteArray<packets::Authentication>(data));
-    return;
+    if (!dispatcher.dispatch(data)) {
+      qDebug() << "Unknown Packet Found";
+    }
   } catch (const common::types::exceptions::MalformedPacket& e) {
     qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
   } catch (const std::exception& e) {
     qDebug() << e.what();
-    return;
   } catch (...) {
     qDebug() << "Unknown Error";
-    return;
-  }
-
-  try {
-    emit this->networkPacket(this, fromQByteArray<packets::SyncingPacket>(data));
-    return;
-  } catch (const common::types::exceptions::MalformedPacket& e) {
-    qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
-  } catch (const std::exception& e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
   }
+}
 
-  try {
-    emit this->networkPacket(this, fromQByteArray<packets::PingPongPacket>(data));
-    return;
-  } catch (const common::types::exceptions::MalformedPacket& e) {
-    qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
-  } catch (const std::exception& e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
-  }
+void BtClientServerSession::handleReadyRead() {
+  this->markRead();
+  decoder.append(m_bt_socket->readAll());
 
   try {
-    emit this->networkPacket(this, fromQByteArray<packets::InvalidRequest>(data));
-    return;
+    while (auto frame = decoder.next()) {
+      this->handleFrame(frame.value());
+    }
   } catch (const common::types::exceptions::MalformedPacket& e) {
     qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
-  } catch (const std::exception& e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
+    decoder.clear();
+    m_bt_socket->abort();
   }
-
-  // if no packet is found
-  qDebug() << "Unknown Packet Found";
 }
 
 bool BtClientServerSession::isHandshakeCompleted() const {
@@ -217,9 +91,69 @@ BtClientServerSession::BtClientServerSession(
     trustedServers(trustedServers),
     device(device),
     sslConfig(sslConfig) {
-  QObject::connect(
-    m_pingTimer, &QTimer::timeout,
-    this, &BtClientServerSession::handlePingTimeout
+  dispatcher.registerPacket<packets::CertificateExchangePacket>(
+    packets::PacketType::CERTIFICATE_EXCHANGE,
+    [this](const packets::CertificateExchangePacket& packet) { this->handleCertificateExchangePacket(packet); }
+  );
+
+  dispatcher.registerPacket<packets::Authentication>(
+    packets::PacketType::AUTHENTICATION_PACKET,
+    [this](const packets::Authentication& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::SyncingPacketView>(
+    packets::PacketType::SYNCING_PACKET,
+    [this](const packets::SyncingPacketView& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::SyncingPacketView>(
+    packets::PacketType::STAMPED_SYNCING_PACKET,
+    [this](const packets::SyncingPacketView& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::PingPongPacket>(
+    packets::PacketType::PING_PONG_PACKET,
+    [this](const packets::PingPongPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::StreamBeginPacket>(
+    packets::PacketType::STREAM_BEGIN_PACKET,
+    [this](const packets::StreamBeginPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::StreamChunkPacket>(
+    packets::PacketType::STREAM_CHUNK_PACKET,
+    [this](const packets::StreamChunkPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::StreamEndPacket>(
+    packets::PacketType::STREAM_END_PACKET,
+    [this](const packets::StreamEndPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::OfferPacket>(
+    packets::PacketType::OFFER_PACKET,
+    [this](const packets::OfferPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::NeedPacket>(
+    packets::PacketType::NEED_PACKET,
+    [this](const packets::NeedPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::CapabilityPacket>(
+    packets::PacketType::CAPABILITY_PACKET,
+    [this](const packets::CapabilityPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::DeltaPacket>(
+    packets::PacketType::DELTA_PACKET,
+    [this](const packets::DeltaPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::InvalidRequest>(
+    packets::PacketType::INVALID_REQUEST,
+    [this](const packets::InvalidRequest& packet) { emit this->networkPacket(this, packet); }
   );
 
   QObject::connect(
@@ -251,8 +185,10 @@ BtClientServerSession::BtClientServerSession(
   );
 
   QObject::connect(
-    m_pongTimer, &QTimer::timeout,
-    this, &BtClientServerSession::handlePongTimeout
+    m_bt_socket,
+    &QBluetoothSocket::bytesWritten,
+    this,
+    &Session::onBytesWritten
   );
 
   QObject::connect(
@@ -267,8 +203,8 @@ BtClientServerSession::~BtClientServerSession() {
   // Nothing to do here
 }
 
-void BtClientServerSession::sendPacket(const packets::NetworkPacket& packet) {
-  this->m_bt_socket->write(packet.toBytes());
+void BtClientServerSession::writeFrame(const QByteArray& frame) {
+  this->m_bt_socket->write(frame);
 }
 
 void BtClientServerSession::disconnectFromHost() {
@@ -279,7 +215,7 @@ bool BtClientServerSession::isTrusted() const {
   if (!this->isHandshakeCompleted()) {
     throw std::runtime_error("Handshake not completed. Certificate not available.");
   } else {
-    return this->trustedServers->isTrustedServer(common::trust::TrustedServer{this->device.name, certificate});
+    return this->trustedServers->isTrustedServerFingerprint(this->device.name, fingerprint);
   }
 }
 
@@ -291,6 +227,10 @@ QByteArray BtClientServerSession::getCertificate() const {
   }
 }
 
+qint64 BtClientServerSession::socketBytesToWrite() const {
+  return this->m_bt_socket->bytesToWrite();
+}
+
 void BtClientServerSession::connect() {
   if (this->m_bt_socket->state() == QBluetoothSocket::SocketState::ConnectedState) {
     this->m_bt_socket->abort();
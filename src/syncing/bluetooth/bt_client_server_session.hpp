@@ -16,8 +16,15 @@
 #include "packets/authentication/authentication.hpp"
 #include "packets/certificate_exchange_packet/certificate_exchange_packet.hpp"
 #include "packets/pingpongpacket/pingpongpacket.hpp"
+#include "packets/streamingpacket/streamingpacket.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
+#include "packets/capabilitypacket/capabilitypacket.hpp"
+#include "packets/deltapacket/deltapacket.hpp"
 #include "packets/syncingpacket/syncingpacket.hpp"
+#include "packets/syncingpacket/syncingpacketview.hpp"
 #include "packets/invalidrequest/invalidrequest.hpp"
+#include "packets/frame_decoder/frame_decoder.hpp"
+#include "packets/packet_dispatcher/packet_dispatcher.hpp"
 #include "syncing/session.hpp"
 #include "syncing/bluetooth/bt_resolved_device.hpp"
 
@@ -32,9 +39,9 @@ class BtClientServerSession : public Session {
 
   QBluetoothSocket* m_bt_socket = new QBluetoothSocket(QBluetoothServiceInfo::RfcommProtocol, this);
   QByteArray certificate;
-  QTimer* m_pingTimer = new QTimer(this);
-  QTimer* m_pongTimer = new QTimer(this);
-  const char* READ_TIME = "READ_TIME";
+  QByteArray fingerprint;
+  packets::PacketDispatcher<> dispatcher;
+  packets::FrameDecoder decoder;
 
  private:
   Q_DISABLE_COPY_MOVE(BtClientServerSession)
@@ -42,16 +49,19 @@ class BtClientServerSession : public Session {
  private:
   void handleCertificateExchangePacket(const packets::CertificateExchangePacket& packet);
   void handleTrustedServersChanged(QList<common::trust::TrustedServer> servers);
-  void handlePingTimeout();
-  void handlePongTimeout();
   void handleConnected();
   void handleDisconnected();
   void handleError(QBluetoothSocket::SocketError error);
+  void handleFrame(const QByteArray& data);
   void handleReadyRead();
 
  private:
   bool isHandshakeCompleted() const;
 
+ protected:
+  virtual void writeFrame(const QByteArray& frame) override;
+  virtual qint64 socketBytesToWrite() const override;
+
  public:
   explicit BtClientServerSession(
     common::trust::TrustedServers* trustedServers,
@@ -62,7 +72,6 @@ class BtClientServerSession : public Session {
 
   virtual ~BtClientServerSession();
 
-  virtual void sendPacket(const packets::NetworkPacket& packet) override;
   virtual void disconnectFromHost() override;
   virtual bool isTrusted() const override;
   virtual QByteArray getCertificate() const override;
@@ -6,13 +6,21 @@
 #include "bt_constants.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::syncing::bluetooth {
-void BtServer::handleCertificateExchangePacket(const packets::CertificateExchangePacket& packet) {
-  auto client = qobject_cast<QBluetoothSocket *>(sender());
+BtServerClientSession* BtServer::getSession(QBluetoothSocket* client) const {
+  if (!client->property(SESSION).isValid()) {
+    return nullptr;
+  }
+
+  return client->property(SESSION).value<BtServerClientSession*>();
+}
+
+void BtServer::handleCertificateExchangePacket(QBluetoothSocket* client, const packets::CertificateExchangePacket& packet) {
   auto name = client->peerName();
   auto session = new BtServerClientSession(name, packet.getCertificate(), trustedClients, client, this);
   client->setProperty(SESSION, QVariant::fromValue<QObject*>(session));
   client->setParent(session);
   m_clients.append(session);
+  session->startHeartbeat();
   emit onClientConnected(session);
 }
 
@@ -34,6 +42,7 @@ void BtServer::handlePendingConnections() {
       &BtServer::handleClientReadyRead
     );
 
+    m_decoders.insert(client, packets::FrameDecoder());
     client->write(utility::functions::createPacket({this->sslConfig.certificate}).toBytes());
   }
 }
@@ -53,6 +62,7 @@ void BtServer::handleError(QAbstractSocket::SocketError socketError) {
 
 void BtServer::handleClientDisconnection() {
   auto client = qobject_cast<QBluetoothSocket *>(sender());
+  m_decoders.remove(client);
   QList<BtServerClientSession*>::iterator iterator = std::find_if(m_clients.begin(), m_clients.end(), [&](BtServerClientSession* c) {
     return c->getSocket() == client;
   });
@@ -61,123 +71,43 @@ void BtServer::handleClientDisconnection() {
     return;
   }
 
+  auto session = *iterator;
   m_clients.erase(iterator);
-  emit onClientDisconnected(*iterator);
+  session->stopHeartbeat();
+  emit onClientDisconnected(session);
 }
 
-void BtServer::handleClientReadyRead() {
-  auto client = qobject_cast<QBluetoothSocket *>(sender());
-  client->setProperty(READ_TIME, QDateTime::currentDateTime());
-
+void BtServer::handleClientFrame(QBluetoothSocket* client, const QByteArray& data) {
   using utility::functions::createPacket;
-  using utility::functions::fromQByteArray;
-
-  // get the first four bytes of the packet
-  QDataStream get(client);
-
-  // QByteArray to store the data
-  QByteArray data;
-
-  /// uploader QDataStream
-  QDataStream put(&data, QIODevice::WriteOnly);
-
-  // start the transaction
-  get.startTransaction();
-
-  // get the packet length
-  qint32 packetLength;
-
-  // read the packet length
-  get >> packetLength;
-
-  // write the packet length
-  put << packetLength;
-
-  // infer the read size
-  qint32 toRead = packetLength - data.size();
-
-  // check has enough bytes
-  if (client->bytesAvailable() < toRead) {
-    return get.rollbackTransaction();
-  }
-
-  // resize the data
-  data.resize(packetLength);
-
-  // read the data from the socket
-  auto start = data.data() + data.size() - toRead;
-  auto bytes = get.readRawData(start, toRead);
-
-  // check for error
-  if (bytes == -1) {
-    return get.rollbackTransaction();
-  }
 
-  // update the toRead
-  toRead -= bytes;
+  // certificate exchange is the only packet allowed before the session
+  const auto packetType = packets::peekPacketType(data);
 
-  // if toRead is not zero then return
-  if (toRead) {
-    return get.rollbackTransaction();
-  }
-
-  // commit the transaction
-  if (!get.commitTransaction()) {
-    return;
-  }
-
-  try {
-    emit this->handleCertificateExchangePacket(fromQByteArray<packets::CertificateExchangePacket>(data));
-    return;
-  } catch (const common::types::exceptions::MalformedPacket& e) {
-    qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
-  } catch (const std::exception& e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
-  }
+  if (packetType == packets::PacketType::CERTIFICATE_EXCHANGE) {
+    try {
+      dispatcher.dispatch(client, data);
+    } catch (const std::exception& e) {
+      qDebug() << e.what();
+    } catch (...) {
+      qDebug() << "Unknown Error";
+    }
 
-  if (!client->property(SESSION).isValid()) {
     return;
   }
 
-  BtServerClientSession* session = client->property(SESSION).value<BtServerClientSession*>();
+  BtServerClientSession* session = getSession(client);
 
   if (session == nullptr) {
     return;
   }
 
-  // Deserialize the data to SyncingPacket
-  try {
-    emit this->onNetworkPacket(session, fromQByteArray<packets::SyncingPacket>(data));
-    return;
-  } catch (const common::types::exceptions::MalformedPacket &e) {
-    session->sendPacket(createPacket({e.getCode(), e.what()}));
-    return;
-  } catch (const common::types::exceptions::NotThisPacket &e) {
-    // No-Op
-  } catch (const std::exception &e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
-  }
-
-  // Deserialize the data to SyncingPacket
   try {
-    emit this->onNetworkPacket(session, fromQByteArray<packets::PingPongPacket>(data));
-    return;
+    if (dispatcher.dispatch(client, data)) {
+      return;
+    }
   } catch (const common::types::exceptions::MalformedPacket &e) {
     session->sendPacket(createPacket({e.getCode(), e.what()}));
     return;
-  } catch (const common::types::exceptions::NotThisPacket &e) {
-    // No-Op
   } catch (const std::exception &e) {
     qDebug() << e.what();
     return;
@@ -192,46 +122,88 @@ void BtServer::handleClientReadyRead() {
   session->sendPacket(createPacket({code, msg}));
 }
 
+void BtServer::handleClientReadyRead() {
+  auto client = qobject_cast<QBluetoothSocket *>(sender());
+  if (!m_decoders.contains(client)) {
+    return;
+  }
 
-void BtServer::handlePingTimeout() {
-  using utility::functions::params::PingPacketParams;
-  using packets::PingPongPacket;
-  using utility::functions::createPacket;
-  auto pingPacket = createPacket(PingPacketParams{
-    common::types::enums::PingType::Ping
-  });
-}
+  if (auto* session = getSession(client)) {
+    session->markRead();
+  }
 
-void BtServer::handlePongTimeout() {
-  for (auto client : m_clients) {
-    auto lastRead = client->property(READ_TIME).toDateTime();
-    auto now      = QDateTime::currentDateTime();
-    auto diff     = lastRead.msecsTo(now);
+  m_decoders[client].append(client->readAll());
 
-    if (diff > constants::getAppMaxReadIdleTime()) {
-      client->disconnectFromHost();
+  // handlers may disconnect the client so look up the decoder on each frame
+  try {
+    while (m_decoders.contains(client)) {
+      auto frame = m_decoders[client].next();
+      if (!frame.has_value()) break;
+      this->handleClientFrame(client, frame.value());
     }
+  } catch (const common::types::exceptions::MalformedPacket &e) {
+    qDebug() << e.what();
+    m_decoders.remove(client);
+    client->abort();
   }
 }
 
 BtServer::BtServer(const common::types::SslConfig sslConfig, common::trust::TrustedClients* trustedClients, QObject *parent): Server(sslConfig, parent), trustedClients(trustedClients) {
   m_server->setSecurityFlags(QBluetooth::Security::Encryption | QBluetooth::Security::Secure);
 
-  QObject::connect(
-    m_server, &QBluetoothServer::newConnection,
-    this, &BtServer::handlePendingConnections
+  dispatcher.registerPacket<packets::CertificateExchangePacket>(
+    packets::PacketType::CERTIFICATE_EXCHANGE,
+    [this](QBluetoothSocket* client, const packets::CertificateExchangePacket& packet) { this->handleCertificateExchangePacket(client, packet); }
+  );
+  dispatcher.registerPacket<packets::SyncingPacketView>(
+    packets::PacketType::SYNCING_PACKET,
+    [this](QBluetoothSocket* client, const packets::SyncingPacketView& packet) { emit this->onNetworkPacket(getSession(client), packet); }
+  );
+  dispatcher.registerPacket<packets::SyncingPacketView>(
+    packets::PacketType::STAMPED_SYNCING_PACKET,
+    [this](QBluetoothSocket* client, const packets::SyncingPacketView& packet) { emit this->onNetworkPacket(getSession(client), packet); }
+  );
+  dispatcher.registerPacket<packets::PingPongPacket>(
+    packets::PacketType::PING_PONG_PACKET,
+    [this](QBluetoothSocket* client, const packets::PingPongPacket& packet) { emit this->onNetworkPacket(getSession(client), packet); }
+  );
+  dispatcher.registerPacket<packets::StreamBeginPacket>(
+    packets::PacketType::STREAM_BEGIN_PACKET,
+    [this](QBluetoothSocket* client, const packets::StreamBeginPacket& packet) { emit this->onNetworkPacket(getSession(client), packet); }
+  );
+  dispatcher.registerPacket<packets::StreamChunkPacket>(
+    packets::PacketType::STREAM_CHUNK_PACKET,
+    [this](QBluetoothSocket* client, const packets::StreamChunkPacket& packet) { emit this->onNetworkPacket(getSession(client), packet); }
+  );
+  dispatcher.registerPacket<packets::StreamEndPacket>(
+    packets::PacketType::STREAM_END_PACKET,
+    [this](QBluetoothSocket* client, const packets::StreamEndPacket& packet) { emit this->onNetworkPacket(getSession(client), packet); }
+  );
+
+  dispatcher.registerPacket<packets::OfferPacket>(
+    packets::PacketType::OFFER_PACKET,
+    [this](QBluetoothSocket* client, const packets::OfferPacket& packet) { emit this->onNetworkPacket(getSession(client), packet); }
+  );
+
+  dispatcher.registerPacket<packets::NeedPacket>(
+    packets::PacketType::NEED_PACKET,
+    [this](QBluetoothSocket* client, const packets::NeedPacket& packet) { emit this->onNetworkPacket(getSession(client), packet); }
   );
-  connect(
-    this->m_pingTimer, &QTimer::timeout,
-    this, &BtServer::handlePingTimeout
+
+  dispatcher.registerPacket<packets::CapabilityPacket>(
+    packets::PacketType::CAPABILITY_PACKET,
+    [this](QBluetoothSocket* client, const packets::CapabilityPacket& packet) { emit this->onNetworkPacket(getSession(client), packet); }
   );
-  connect(
-    this->m_pongTimer, &QTimer::timeout,
-    this, &BtServer::handlePongTimeout
+
+  dispatcher.registerPacket<packets::DeltaPacket>(
+    packets::PacketType::DELTA_PACKET,
+    [this](QBluetoothSocket* client, const packets::DeltaPacket& packet) { emit this->onNetworkPacket(getSession(client), packet); }
   );
 
-  this->m_pingTimer->start(constants::getAppMaxWriteIdleTime());
-  this->m_pongTimer->start(constants::getAppMaxReadIdleTime());
+  QObject::connect(
+    m_server, &QBluetoothServer::newConnection,
+    this, &BtServer::handlePendingConnections
+  );
 }
 
 BtServer::~BtServer() {
@@ -251,18 +223,11 @@ void BtServer::stop() {
     m_server->close();
   }
 
-  if (m_pingTimer->isActive()) {
-    m_pingTimer->stop();
-  }
-
-  if (m_pongTimer->isActive()) {
-    m_pongTimer->stop();
-  }
-
   for (auto client : m_clients) {
     client->disconnectFromHost();
   }
 
   m_clients.clear();
+  m_decoders.clear();
 }
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -2,6 +2,7 @@
 
 #include <QApplication>
 #include <QByteArray>
+#include <QHash>
 #include <QList>
 #include <QObject>
 #include <QSslConfiguration>
@@ -18,6 +19,13 @@
 #include "common/types/exceptions/exceptions.hpp"
 #include "common/trust/trusted_clients.hpp"
 #include "constants/constants.hpp"
+#include "packets/frame_decoder/frame_decoder.hpp"
+#include "packets/packet_dispatcher/packet_dispatcher.hpp"
+#include "packets/streamingpacket/streamingpacket.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
+#include "packets/capabilitypacket/capabilitypacket.hpp"
+#include "packets/deltapacket/deltapacket.hpp"
+#include "packets/syncingpacket/syncingpacketview.hpp"
 #include "syncing/server.hpp"
 #include "syncing/session.hpp"
 #include "syncing/synchronizer.hpp"
@@ -39,22 +47,21 @@ class BtServer : public syncing::Server {
 
   QBluetoothServer* m_server   = new QBluetoothServer(QBluetoothServiceInfo::RfcommProtocol, this);
   QBluetoothServiceInfo serviceInfo;
-  QTimer* m_pingTimer          = new QTimer(this);
-  QTimer* m_pongTimer          = new QTimer(this);
-  const char* READ_TIME        = "READ_TIME";
   const char* SESSION          = "SESSION";
   common::trust::TrustedClients* trustedClients;
   QList<BtServerClientSession*> m_clients;
+  packets::PacketDispatcher<QBluetoothSocket*> dispatcher;
+  QHash<QBluetoothSocket*, packets::FrameDecoder> m_decoders;
 
  private:
-  void handleCertificateExchangePacket(const packets::CertificateExchangePacket& packet);
+  BtServerClientSession* getSession(QBluetoothSocket* client) const;
+  void handleCertificateExchangePacket(QBluetoothSocket* client, const packets::CertificateExchangePacket& packet);
   void handlePendingConnections();
   void handleSslErrors(QBluetoothSocket *, const QList<QSslError>& errors);
   void handleError(QAbstractSocket::SocketError socketError);
   void handleClientDisconnection();
+  void handleClientFrame(QBluetoothSocket* client, const QByteArray& data);
   void handleClientReadyRead();
-  void handlePingTimeout();
-  void handlePongTimeout();
 
  public:
 
@@ -1,5 +1,7 @@
 #include "bt_server_client_session.hpp"
 
+#include "utility/functions/crypto/crypto.hpp"
+
 namespace srilakshmikanthanp::clipbirdesk::syncing::bluetooth {
 void BtServerClientSession::handleTrustedClientsChanged(QList<common::trust::TrustedClient> servers) {
   if (m_socket->state() == QBluetoothSocket::SocketState::ConnectedState) {
@@ -13,13 +15,24 @@ BtServerClientSession::BtServerClientSession(
   common::trust::TrustedClients* trustedClients,
   QBluetoothSocket* socket,
   QObject* parent
-) : Session(name, parent), trustedClients(trustedClients), m_certificate(certificate), m_socket(socket) {
+) : Session(name, parent),
+    trustedClients(trustedClients),
+    m_certificate(certificate),
+    m_fingerprint(utility::functions::fingerprint(certificate)),
+    m_socket(socket) {
   QObject::connect(
     this->trustedClients,
     &common::trust::TrustedClients::trustedClientsChanged,
     this,
     &BtServerClientSession::handleTrustedClientsChanged
   );
+
+  QObject::connect(
+    this->m_socket,
+    &QBluetoothSocket::bytesWritten,
+    this,
+    &Session::onBytesWritten
+  );
 }
 
 BtServerClientSession::~BtServerClientSession() {
@@ -30,8 +43,8 @@ QBluetoothSocket* BtServerClientSession::getSocket() const {
   return m_socket;
 }
 
-void BtServerClientSession::sendPacket(const packets::NetworkPacket& packet) {
-  this->m_socket->write(packet.toBytes());
+void BtServerClientSession::writeFrame(const QByteArray& frame) {
+  this->m_socket->write(frame);
 }
 
 void BtServerClientSession::disconnectFromHost() {
@@ -39,10 +52,14 @@ void BtServerClientSession::disconnectFromHost() {
 }
 
 bool BtServerClientSession::isTrusted() const {
-  return this->trustedClients->isTrustedClient(common::trust::TrustedClient{this->getName(), m_certificate});
+  return this->trustedClients->isTrustedClientFingerprint(this->getName(), m_fingerprint);
 }
 
 QByteArray BtServerClientSession::getCertificate() const {
   return m_certificate;
 }
+
+qint64 BtServerClientSession::socketBytesToWrite() const {
+  return this->m_socket->bytesToWrite();
+}
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing::bluetooth
@@ -18,11 +18,16 @@ class BtServerClientSession : public Session {
 
   common::trust::TrustedClients* trustedClients;
   QByteArray m_certificate;
+  QByteArray m_fingerprint;
   QBluetoothSocket* m_socket;
 
  private:
   void handleTrustedClientsChanged(QList<common::trust::TrustedClient> servers);
 
+ protected:
+  void writeFrame(const QByteArray& frame) override;
+  qint64 socketBytesToWrite() const override;
+
  public:
 
   BtServerClientSession(
@@ -37,7 +42,6 @@ class BtServerClientSession : public Session {
 
   QBluetoothSocket* getSocket() const;
 
-  void sendPacket(const packets::NetworkPacket& packet) override;
   void disconnectFromHost() override;
   bool isTrusted() const override;
   QByteArray getCertificate() const override;
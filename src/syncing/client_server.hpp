@@ -3,6 +3,7 @@
 #include <QString>
 
 #include "session.hpp"
+#include "known_endpoint.hpp"
 #include "packets/network_packet.hpp"
 #include "syncing/client_server_event_handler.hpp"
 
@@ -22,5 +23,11 @@ class ClientServer: public QObject {
   QString getName();
 
   virtual void connect(syncing::ClientServerEventHandler *handler) = 0;
+
+  /**
+   * @brief Endpoint the server was resolved at, the fingerprint is
+   * left empty since it is only known once connected
+   */
+  virtual KnownEndpoint getEndpoint() const = 0;
 };
 }
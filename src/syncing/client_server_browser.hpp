@@ -23,6 +23,13 @@ class ClientServerBrowser : public QObject {
   virtual void start() = 0;
   virtual void stop() = 0;
 
+  /**
+   * @brief Create a server for an endpoint known from an earlier
+   * connection without waiting for discovery, the server is not
+   * reported as found
+   */
+  virtual ClientServer* createClientServer(const KnownEndpoint& endpoint) = 0;
+
  signals:
   void onBrowsingStartFailed(std::exception_ptr eptr);
   void onBrowsingStopFailed(std::exception_ptr eptr);
@@ -0,0 +1,52 @@
+#include "content_store.hpp"
+
+#include <QCryptographicHash>
+
+#include "constants/constants.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+Q_GLOBAL_STATIC_WITH_ARGS(ContentStore, contentStoreInstance, (qsizetype(constants::getAppContentStoreSize())))
+
+ContentStore::ContentStore(qsizetype capacity) : entries(capacity) {}
+
+QByteArray ContentStore::hash(const QByteArray& payload) {
+  return QCryptographicHash::hash(payload, QCryptographicHash::Sha256);
+}
+
+QVector<QByteArray> ContentStore::putItems(const QVector<QPair<QString, QByteArray>>& items) {
+  QVector<QByteArray> hashes;
+  hashes.reserve(items.size());
+
+  for (const auto& [mimeType, payload] : items) {
+    hashes.append(hash(payload));
+    this->put(hashes.last(), payload);
+  }
+
+  return hashes;
+}
+
+void ContentStore::put(const QByteArray& hash, const QByteArray& payload) {
+  QMutexLocker locker(&lock);
+
+  // cost is the payload size so the cache is bounded by bytes, an
+  // entry already stored only moves to the front
+  if (entries.object(hash) == nullptr) {
+    entries.insert(hash, new QByteArray(payload), qMax<qsizetype>(payload.size(), 1));
+  }
+}
+
+bool ContentStore::contains(const QByteArray& hash) const {
+  QMutexLocker locker(&lock);
+  return entries.contains(hash);
+}
+
+QByteArray ContentStore::get(const QByteArray& hash) {
+  QMutexLocker locker(&lock);
+  const auto* payload = entries.object(hash);
+  return payload != nullptr ? *payload : QByteArray();
+}
+
+ContentStore* ContentStoreFactory::getContentStore() {
+  return contentStoreInstance;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <QByteArray>
+#include <QCache>
+#include <QMutex>
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Payloads of the clipboard items synced recently keyed by their
+ * SHA-256 hash, bounded by the total bytes and evicting the least
+ * recently used, it is filled with everything copied or applied so it
+ * holds what the clipboard history holds and answers offers from peers
+ */
+class ContentStore {
+ private:
+  Q_DISABLE_COPY_MOVE(ContentStore)
+
+ private:
+  mutable QMutex lock;
+  QCache<QByteArray, QByteArray> entries;
+
+ public:
+  explicit ContentStore(qsizetype capacity);
+  ~ContentStore() = default;
+
+  /**
+   * @brief SHA-256 of the payload
+   */
+  static QByteArray hash(const QByteArray& payload);
+
+  /**
+   * @brief Store the payloads of the items
+   * @return QVector<QByteArray> hashes of the items in order
+   */
+  QVector<QByteArray> putItems(const QVector<QPair<QString, QByteArray>>& items);
+
+  /**
+   * @brief Store the payload under its hash, payloads larger than the
+   * capacity are not kept
+   */
+  void put(const QByteArray& hash, const QByteArray& payload);
+
+  /**
+   * @brief Check whether the payload of the hash is stored
+   */
+  bool contains(const QByteArray& hash) const;
+
+  /**
+   * @brief Payload of the hash or null array if it is not stored,
+   * the payload is shared not copied
+   */
+  QByteArray get(const QByteArray& hash);
+};
+
+struct ContentStoreFactory {
+  static ContentStore* getContentStore();
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+
+#include "common/types/enums/enums.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Where a server was last reached, host is the IP address for
+ * network and the device address for bluetooth where port is unused
+ */
+struct KnownEndpoint {
+  QString name;
+  common::types::enums::Transport transport;
+  QString host;
+  quint16 port = 0;
+  QByteArray fingerprint;
+
+  bool isSameAddress(const KnownEndpoint& other) const {
+    return name == other.name && transport == other.transport && host == other.host && port == other.port;
+  }
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
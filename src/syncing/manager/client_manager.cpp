@@ -1,6 +1,7 @@
 #include "client_manager.hpp"
 
 #include "syncing/client_server_browser_factory.hpp"
+#include "utility/functions/fingerprint/fingerprint.hpp"
 #include "utility/functions/packet/packet.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::syncing {
@@ -16,17 +17,186 @@ void ClientManager::handleInvalidRequestPacket(Session* session, const packets::
   emit handleError(session, std::make_exception_ptr(packets::InvalidRequestException(packet)));
 }
 
-void ClientManager::handleSyncingPacket(Session* session, const packets::SyncingPacket& packet) {
+void ClientManager::handleSyncingPacket(Session* session, const packets::SyncingPacketView& packet) {
   if (!session->isTrusted()) return;
-  QVector<QPair<QString, QByteArray>> items;
-  for (const auto& item : packet.getItems()) {
-    items.append(qMakePair(QString::fromUtf8(item.getMimeType()), item.getPayload()));
+
+  // the legacy layout carries no stamp so it is ordered as received
+  if (!packet.isStamped()) {
+    syncClock->next();
+    this->applyItems(packet.getItems());
+    return;
+  }
+
+  const auto originId = packet.getOriginId();
+  const auto sequence = packet.getSequence();
+
+  // payloads needed to complete an offer
+  auto* offer = session->findChild<OfferReceiver*>(QString(), Qt::FindDirectChildrenOnly);
+
+  if (offer != nullptr && offer->isPending(originId, sequence)) {
+    this->completeOffer(session, packet.getItems(), originId, sequence);
+    return;
   }
-  this->OnSyncRequest(items);
+
+  // echoes, duplicates and stale updates are dropped before a payload is copied
+  if (!syncClock->accept(originId, sequence)) return;
+
+  this->applyItems(packet.getItems());
 }
 
 void ClientManager::handlePingPongPacket(Session* session, const packets::PingPongPacket& packet) {
-  session->sendPacket(utility::functions::createPacket(utility::functions::params::PingPacketParams{.pingType = common::types::enums::Pong}));
+  if (packet.getPingType() == common::types::enums::Ping) {
+    session->sendPacket(utility::functions::createPacket(utility::functions::params::PingPacketParams{.pingType = common::types::enums::Pong}));
+  } else {
+    session->markPong();
+  }
+}
+
+void ClientManager::handleStreamBeginPacket(Session* session, const packets::StreamBeginPacket& packet) {
+  if (!session->isTrusted()) return;
+  this->getStreamReceiver(session)->handleBeginPacket(packet);
+}
+
+void ClientManager::handleStreamChunkPacket(Session* session, const packets::StreamChunkPacket& packet) {
+  if (!session->isTrusted()) return;
+  this->getStreamReceiver(session)->handleChunkPacket(packet);
+}
+
+void ClientManager::handleStreamEndPacket(Session* session, const packets::StreamEndPacket& packet) {
+  if (!session->isTrusted()) return;
+  this->getStreamReceiver(session)->handleEndPacket(packet);
+}
+
+void ClientManager::handleOfferPacket(Session* session, const packets::OfferPacket& packet) {
+  if (!session->isTrusted()) return;
+  if (!syncClock->accept(packet.getOriginId(), packet.getSequence())) return;
+
+  auto* offer        = this->getOfferReceiver(session);
+  const auto missing = offer->handleOfferPacket(packet);
+
+  // every payload is already here
+  if (missing.isEmpty()) {
+    this->applyItems(offer->complete({}));
+    return;
+  }
+
+  session->sendPacket(utility::functions::createPacket(utility::functions::params::NeedPacketParams{missing, packet.getOriginId(), packet.getSequence()}));
+}
+
+void ClientManager::handleNeedPacket(Session* session, const packets::NeedPacket& packet) {
+  if (!session->isTrusted()) return;
+
+  auto* offer = session->findChild<OfferSender*>(QString(), Qt::FindDirectChildrenOnly);
+
+  if (offer == nullptr) return;
+
+  const auto answer = offer->handleNeedPacket(packet);
+
+  if (!answer.has_value() || answer->items.isEmpty()) return;
+
+  // the edited text is sent as a delta against what the peer was last sent
+  if (answer->delta.has_value()) {
+    session->sendPacket(utility::functions::createPacket(utility::functions::params::DeltaPacketParams{answer->delta.value(), packet.getOriginId(), packet.getSequence()}));
+  } else {
+    this->sendItems(answer->items, packet.getOriginId(), packet.getSequence());
+  }
+}
+
+void ClientManager::handleDeltaPacket(Session* session, const packets::DeltaPacket& packet) {
+  if (!session->isTrusted()) return;
+
+  auto* offer = session->findChild<OfferReceiver*>(QString(), Qt::FindDirectChildrenOnly);
+
+  if (offer == nullptr || !offer->isPending(packet.getOriginId(), packet.getSequence())) return;
+
+  if (const auto items = offer->applyDelta(packet); items.has_value()) {
+    this->completeOffer(session, items.value(), packet.getOriginId(), packet.getSequence());
+  } else {
+    // a base is not here so the full items are asked for again
+    session->sendPacket(utility::functions::createPacket(utility::functions::params::NeedPacketParams{offer->getMissing(), packet.getOriginId(), packet.getSequence()}));
+  }
+}
+
+void ClientManager::handleCapabilityPacket(Session* session, const packets::CapabilityPacket& packet) {
+  // the server opens the exchange, a legacy one never does
+  session->setPeerEncodings(packet.getEncodings());
+  session->announceCapabilities();
+}
+
+OfferReceiver* ClientManager::getOfferReceiver(Session* session) {
+  if (auto* receiver = session->findChild<OfferReceiver*>(QString(), Qt::FindDirectChildrenOnly)) {
+    return receiver;
+  }
+
+  return new OfferReceiver(contentStore, session);
+}
+
+OfferSender* ClientManager::getOfferSender(Session* session) {
+  if (auto* sender = session->findChild<OfferSender*>(QString(), Qt::FindDirectChildrenOnly)) {
+    return sender;
+  }
+
+  return new OfferSender(contentStore, session);
+}
+
+bool ClientManager::completeOffer(Session* session, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence) {
+  auto* offer = session->findChild<OfferReceiver*>(QString(), Qt::FindDirectChildrenOnly);
+
+  if (offer == nullptr || !offer->isPending(originId, sequence)) {
+    return false;
+  }
+
+  const auto result = offer->complete(items);
+
+  // a newer update may have been applied while the payloads were sent
+  if (syncClock->isLatest(originId, sequence)) {
+    this->applyItems(result);
+  }
+
+  return true;
+}
+
+void ClientManager::applyItems(const QVector<QPair<QString, QByteArray>>& items) {
+  // kept so the same payloads offered again are not sent
+  if (OfferSender::isOfferable(items)) {
+    contentStore->putItems(items);
+  }
+
+  emit OnSyncRequest(items, utility::functions::contentFingerprint(items));
+}
+
+void ClientManager::sendItems(const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence) {
+  // large items are streamed in chunks to a peer that announced it
+  if (session->hasPeerCapabilities() && StreamSender::isStreamable(items)) {
+    auto* sender = StreamSender::send(session, ++transferId, originId, sequence, items);
+    connect(sender, &StreamSender::progress, this, [this, session = this->session](quint32 transferId, quint64 sent, quint64 total) {
+      emit transferSendProgress(session, transferId, sent, total);
+    });
+    return;
+  }
+
+  session->sendPacket(utility::functions::createPacket(utility::functions::params::SyncingPacketParams{.items = items, .originId = originId, .sequence = sequence, .encodings = session->getPeerEncodings(), .stamped = session->hasPeerCapabilities()}));
+}
+
+StreamReceiver* ClientManager::getStreamReceiver(Session* session) {
+  if (auto* receiver = session->findChild<StreamReceiver*>(QString(), Qt::FindDirectChildrenOnly)) {
+    return receiver;
+  }
+
+  // the receiver lives as long as the session
+  auto* receiver = new StreamReceiver(session);
+
+  connect(receiver, &StreamReceiver::progress, this, [this, session](quint32 transferId, quint64 received, quint64 total) {
+    emit transferReceiveProgress(session, transferId, received, total);
+  });
+
+  connect(receiver, &StreamReceiver::completed, this, [this, session](quint32 transferId, QUuid originId, quint64 sequence, QVector<QPair<QString, QByteArray>> items) {
+    if (this->completeOffer(session, items, originId, sequence)) return;
+    if (!syncClock->accept(originId, sequence)) return;
+    this->applyItems(items);
+  });
+
+  return receiver;
 }
 
 void ClientManager::handleServerFound(ClientServer *server) {
@@ -71,23 +241,61 @@ void ClientManager::handleNetworkPacket(Session* session, const packets::Network
     handleAuthenticationPacket(session, *authPacket);
   } else if (auto invalidPacket = dynamic_cast<const packets::InvalidRequest*>(&networkPacket)) {
     handleInvalidRequestPacket(session, *invalidPacket);
-  } else if (auto syncPacket = dynamic_cast<const packets::SyncingPacket*>(&networkPacket)) {
+  } else if (auto syncPacket = dynamic_cast<const packets::SyncingPacketView*>(&networkPacket)) {
     handleSyncingPacket(session, *syncPacket);
   } else if (auto pingPacket = dynamic_cast<const packets::PingPongPacket*>(&networkPacket)) {
     handlePingPongPacket(session, *pingPacket);
+  } else if (auto beginPacket = dynamic_cast<const packets::StreamBeginPacket*>(&networkPacket)) {
+    handleStreamBeginPacket(session, *beginPacket);
+  } else if (auto chunkPacket = dynamic_cast<const packets::StreamChunkPacket*>(&networkPacket)) {
+    handleStreamChunkPacket(session, *chunkPacket);
+  } else if (auto endPacket = dynamic_cast<const packets::StreamEndPacket*>(&networkPacket)) {
+    handleStreamEndPacket(session, *endPacket);
+  } else if (auto offerPacket = dynamic_cast<const packets::OfferPacket*>(&networkPacket)) {
+    handleOfferPacket(session, *offerPacket);
+  } else if (auto needPacket = dynamic_cast<const packets::NeedPacket*>(&networkPacket)) {
+    handleNeedPacket(session, *needPacket);
+  } else if (auto deltaPacket = dynamic_cast<const packets::DeltaPacket*>(&networkPacket)) {
+    handleDeltaPacket(session, *deltaPacket);
+  } else if (auto capabilityPacket = dynamic_cast<const packets::CapabilityPacket*>(&networkPacket)) {
+    handleCapabilityPacket(session, *capabilityPacket);
   }
 }
 
 void ClientManager::synchronize(const QVector<QPair<QString, QByteArray>>& items) {
-  if (session != nullptr && session->isTrusted()) {
-    session->sendPacket(utility::functions::createPacket(utility::functions::params::SyncingPacketParams{.items = items}));
+  if (session == nullptr || !session->isTrusted()) {
+    return;
   }
+
+  const auto originId = syncClock->getOrigin();
+  const auto sequence = syncClock->next();
+
+  // large items are offered by hash and the server asks for the
+  // payloads it does not have, a legacy server only takes the items
+  if (session->hasPeerCapabilities() && OfferSender::isOfferable(items)) {
+    const auto hashes = contentStore->putItems(items);
+    this->getOfferSender(session)->setOffer(originId, sequence, items, hashes);
+    session->sendPacket(utility::functions::createPacket(utility::functions::params::OfferPacketParams{items, hashes, originId, sequence}));
+    return;
+  }
+
+  this->sendItems(items, originId, sequence);
 }
 
 void ClientManager::connectToServer(ClientServer* server) {
   server->connect(this);
 }
 
+ClientServer* ClientManager::connectToEndpoint(const KnownEndpoint& endpoint) {
+  if (this->clientServerBrowser == nullptr) {
+    return nullptr;
+  }
+
+  auto* server = this->clientServerBrowser->createClientServer(endpoint);
+  server->connect(this);
+  return server;
+}
+
 void ClientManager::start(bool useBluetooth) {
   if (this->clientServerBrowser != nullptr) {
     throw std::runtime_error("ClientManager is already started");
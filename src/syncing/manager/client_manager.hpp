@@ -5,13 +5,22 @@
 
 #include "common/types/ssl_config/ssl_config.hpp"
 #include "packets/authentication/authentication.hpp"
+#include "packets/capabilitypacket/capabilitypacket.hpp"
+#include "packets/deltapacket/deltapacket.hpp"
 #include "packets/invalidrequest/invalid_request_exception.hpp"
 #include "packets/invalidrequest/invalidrequest.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
 #include "packets/syncingpacket/syncingpacket.hpp"
+#include "packets/syncingpacket/syncingpacketview.hpp"
 #include "packets/pingpongpacket/pingpongpacket.hpp"
+#include "packets/streamingpacket/streamingpacket.hpp"
 #include "syncing/manager/host_manager.hpp"
 #include "syncing/client_server.hpp"
 #include "syncing/session.hpp"
+#include "syncing/streaming/stream_receiver.hpp"
+#include "syncing/streaming/stream_sender.hpp"
+#include "syncing/offering/offer_receiver.hpp"
+#include "syncing/offering/offer_sender.hpp"
 #include "packets/network_packet.hpp"
 #include "syncing/client_server_browser.hpp"
 #include "syncing/client_server_event_handler.hpp"
@@ -26,8 +35,21 @@ class ClientManager : public ClientServerEventHandler {
  private:
   void handleAuthenticationPacket(Session* session, const packets::Authentication& packet);
   void handleInvalidRequestPacket(Session* session, const packets::InvalidRequest& packet);
-  void handleSyncingPacket(Session* session, const packets::SyncingPacket& packet);
+  void handleSyncingPacket(Session* session, const packets::SyncingPacketView& packet);
   void handlePingPongPacket(Session* session, const packets::PingPongPacket& packet);
+  void handleStreamBeginPacket(Session* session, const packets::StreamBeginPacket& packet);
+  void handleStreamChunkPacket(Session* session, const packets::StreamChunkPacket& packet);
+  void handleStreamEndPacket(Session* session, const packets::StreamEndPacket& packet);
+  void handleOfferPacket(Session* session, const packets::OfferPacket& packet);
+  void handleNeedPacket(Session* session, const packets::NeedPacket& packet);
+  void handleDeltaPacket(Session* session, const packets::DeltaPacket& packet);
+  void handleCapabilityPacket(Session* session, const packets::CapabilityPacket& packet);
+  StreamReceiver* getStreamReceiver(Session* session);
+  OfferReceiver* getOfferReceiver(Session* session);
+  OfferSender* getOfferSender(Session* session);
+  bool completeOffer(Session* session, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence);
+  void applyItems(const QVector<QPair<QString, QByteArray>>& items);
+  void sendItems(const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence);
   void handleServerFound(ClientServer *server);
   void handleServerGone(ClientServer *server);
   void handleBrowsingStarted();
@@ -44,6 +66,7 @@ class ClientManager : public ClientServerEventHandler {
  private:
   ClientServerBrowser* clientServerBrowser = nullptr;
   Session* session                         = nullptr;
+  quint32 transferId                       = 0;
 
  public:
   explicit ClientManager(QObject* parent = nullptr);
@@ -55,6 +78,14 @@ class ClientManager : public ClientServerEventHandler {
 
   void connectToServer(ClientServer* server);
 
+  /**
+   * @brief Connect to an endpoint known from an earlier connection
+   * without waiting for discovery
+   * @return ClientServer* - server created for the endpoint or nullptr
+   * if the manager is not started
+   */
+  ClientServer* connectToEndpoint(const KnownEndpoint& endpoint);
+
  signals:
   void browsingStartFailed(std::exception_ptr eptr);
   void browsingStopFailed(std::exception_ptr eptr);
@@ -2,7 +2,11 @@
 
 #include <QObject>
 
+#include "syncing/content_store/content_store.hpp"
+#include "syncing/session.hpp"
 #include "syncing/synchronizer.hpp"
+#include "syncing/sync_clock/sync_clock.hpp"
+#include "syncing/sync_clock/sync_clock_factory.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::syncing {
 class HostManager : public Synchronizer {
@@ -11,11 +15,19 @@ class HostManager : public Synchronizer {
  private:
   Q_DISABLE_COPY_MOVE(HostManager)
 
+ protected:
+  SyncClock* syncClock       = SyncClockFactory::getSyncClock();
+  ContentStore* contentStore = ContentStoreFactory::getContentStore();
+
  public:
   explicit HostManager(QObject *parent = nullptr);
   virtual ~HostManager();
 
   virtual void start(bool useBluetooth) = 0;
   virtual void stop()                   = 0;
+
+ signals:
+  void transferSendProgress(Session* session, quint32 transferId, quint64 sent, quint64 total);
+  void transferReceiveProgress(Session* session, quint32 transferId, quint64 received, quint64 total);
 };
 }
@@ -0,0 +1,62 @@
+#include "known_endpoints.hpp"
+
+#include <QVariantMap>
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+KnownEndpoints::KnownEndpoints(QObject* parent) : QObject(parent) {}
+
+KnownEndpoints::~KnownEndpoints() {}
+
+void KnownEndpoints::putEndpoint(const KnownEndpoint& endpoint) {
+  QVariantMap value;
+  value[transportKey]     = static_cast<quint32>(endpoint.transport);
+  value[hostKey]          = endpoint.host;
+  value[portKey]          = endpoint.port;
+  value[fingerprintKey]   = endpoint.fingerprint;
+  value[lastConnectedKey] = QDateTime::currentDateTimeUtc();
+
+  settings->beginGroup(knownEndpointsGroup);
+  settings->setValue(endpoint.name, value);
+  settings->endGroup();
+}
+
+std::optional<KnownEndpoint> KnownEndpoints::getLastEndpoint(common::types::enums::Transport transport) {
+  std::optional<KnownEndpoint> endpoint;
+  QDateTime lastConnected;
+
+  settings->beginGroup(knownEndpointsGroup);
+
+  for (const QString& name : settings->childKeys()) {
+    const auto value = settings->value(name).toMap();
+
+    if (value.value(transportKey).toUInt() != static_cast<quint32>(transport)) {
+      continue;
+    }
+
+    const auto connectedAt = value.value(lastConnectedKey).toDateTime();
+
+    if (endpoint.has_value() && connectedAt <= lastConnected) {
+      continue;
+    }
+
+    lastConnected = connectedAt;
+    endpoint      = KnownEndpoint{
+      name,
+      transport,
+      value.value(hostKey).toString(),
+      static_cast<quint16>(value.value(portKey).toUInt()),
+      value.value(fingerprintKey).toByteArray()
+    };
+  }
+
+  settings->endGroup();
+
+  return endpoint;
+}
+
+void KnownEndpoints::removeEndpoint(const QString& name) {
+  settings->beginGroup(knownEndpointsGroup);
+  settings->remove(name);
+  settings->endGroup();
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
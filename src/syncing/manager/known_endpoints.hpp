@@ -0,0 +1,57 @@
+#pragma once
+
+#include <QDateTime>
+#include <QObject>
+#include <QSettings>
+#include <QString>
+#include <optional>
+
+#include "syncing/known_endpoint.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Persisted endpoint of every server this host was last synced
+ * with, used to connect directly on start or wake before discovery
+ * has resolved the server again
+ */
+class KnownEndpoints : public QObject {
+  Q_OBJECT
+
+ private:  // settings
+
+  QSettings *settings = new QSettings("srilakshmikanthanp", "clipbird", this);
+
+ private: // groups
+
+  static constexpr const char* knownEndpointsGroup = "knownEndpoints";
+
+ private: // keys
+
+  static constexpr const char* transportKey     = "transport";
+  static constexpr const char* hostKey          = "host";
+  static constexpr const char* portKey          = "port";
+  static constexpr const char* fingerprintKey   = "fingerprint";
+  static constexpr const char* lastConnectedKey = "lastConnected";
+
+ private:
+  Q_DISABLE_COPY_MOVE(KnownEndpoints)
+
+ public:
+  explicit KnownEndpoints(QObject* parent = nullptr);
+  virtual ~KnownEndpoints();
+
+  /**
+   * @brief Remember the endpoint as the last one the server was
+   * reached at, the previous endpoint of the server is replaced
+   */
+  void putEndpoint(const KnownEndpoint& endpoint);
+
+  /**
+   * @brief Endpoint of the server most recently connected over the
+   * transport
+   */
+  std::optional<KnownEndpoint> getLastEndpoint(common::types::enums::Transport transport);
+
+  void removeEndpoint(const QString& name);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
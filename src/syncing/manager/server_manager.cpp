@@ -1,25 +1,127 @@
 #include "server_manager.hpp"
 
 #include "syncing/server_factory.hpp"
+#include "utility/functions/compression/compression.hpp"
+#include "utility/functions/fingerprint/fingerprint.hpp"
 #include "utility/functions/packet/packet.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::syncing {
 
-void ServerManager::onSyncingPacket(Session* session, const packets::SyncingPacket& packet) {
+void ServerManager::onSyncingPacket(Session* session, const packets::SyncingPacketView& packet) {
   if (!session->isTrusted()) return;
-  QVector<QPair<QString, QByteArray>> items;
-  for (const auto& item : packet.getItems()) {
-    items.append(qMakePair(QString::fromUtf8(item.getMimeType()), item.getPayload()));
+
+  // the legacy layout carries no stamp so it is ordered as received
+  if (!packet.isStamped()) {
+    this->applyItems(session, packet.getItems(), syncClock->getOrigin(), syncClock->next());
+    return;
+  }
+
+  const auto originId = packet.getOriginId();
+  const auto sequence = packet.getSequence();
+
+  // payloads needed to complete an offer
+  auto* offer = session->findChild<OfferReceiver*>(QString(), Qt::FindDirectChildrenOnly);
+
+  if (offer != nullptr && offer->isPending(originId, sequence)) {
+    this->completeOffer(session, packet.getItems(), originId, sequence);
+    return;
+  }
+
+  // echoes, duplicates and stale updates are neither relayed nor applied,
+  // and are dropped before a payload is copied
+  if (!syncClock->accept(originId, sequence)) return;
+
+  // copied and decoded once, the items leave for the GUI thread
+  const auto items = packet.getItems();
+
+  // forward the frame as received, it is not encoded again
+  if (relayEnabled) {
+    for (auto* client : this->relayFrame(session, packet.toBytes(), packet.getEncodings())) {
+      this->sendItems(client, items, originId, sequence);
+    }
   }
-  this->OnSyncRequest(items);
+
+  this->OnSyncRequest(items, utility::functions::contentFingerprint(items));
 }
 
 void ServerManager::onPingPongPacket(Session* session, const packets::PingPongPacket& packet) {
   if (packet.getPingType() == common::types::enums::Ping) {
     session->sendPacket(utility::functions::createPacket(utility::functions::params::PingPacketParams{.pingType = common::types::enums::Pong}));
+  } else {
+    session->markPong();
   }
 }
 
+void ServerManager::onStreamBeginPacket(Session* session, const packets::StreamBeginPacket& packet) {
+  if (!session->isTrusted()) return;
+  this->getStreamReceiver(session)->handleBeginPacket(packet);
+}
+
+void ServerManager::onStreamChunkPacket(Session* session, const packets::StreamChunkPacket& packet) {
+  if (!session->isTrusted()) return;
+  this->getStreamReceiver(session)->handleChunkPacket(packet);
+}
+
+void ServerManager::onStreamEndPacket(Session* session, const packets::StreamEndPacket& packet) {
+  if (!session->isTrusted()) return;
+  this->getStreamReceiver(session)->handleEndPacket(packet);
+}
+
+void ServerManager::onOfferPacket(Session* session, const packets::OfferPacket& packet) {
+  if (!session->isTrusted()) return;
+  if (!syncClock->accept(packet.getOriginId(), packet.getSequence())) return;
+
+  auto* offer        = this->getOfferReceiver(session);
+  const auto missing = offer->handleOfferPacket(packet);
+
+  // every payload is already here
+  if (missing.isEmpty()) {
+    this->applyItems(session, offer->complete({}), packet.getOriginId(), packet.getSequence());
+    return;
+  }
+
+  session->sendPacket(utility::functions::createPacket(utility::functions::params::NeedPacketParams{missing, packet.getOriginId(), packet.getSequence()}));
+}
+
+void ServerManager::onNeedPacket(Session* session, const packets::NeedPacket& packet) {
+  if (!session->isTrusted()) return;
+
+  auto* offer = session->findChild<OfferSender*>(QString(), Qt::FindDirectChildrenOnly);
+
+  if (offer == nullptr) return;
+
+  const auto answer = offer->handleNeedPacket(packet);
+
+  if (!answer.has_value() || answer->items.isEmpty()) return;
+
+  // the edited text is sent as a delta against what the peer was last sent
+  if (answer->delta.has_value()) {
+    session->sendPacket(utility::functions::createPacket(utility::functions::params::DeltaPacketParams{answer->delta.value(), packet.getOriginId(), packet.getSequence()}));
+  } else {
+    this->sendItems(session, answer->items, packet.getOriginId(), packet.getSequence());
+  }
+}
+
+void ServerManager::onDeltaPacket(Session* session, const packets::DeltaPacket& packet) {
+  if (!session->isTrusted()) return;
+
+  auto* offer = session->findChild<OfferReceiver*>(QString(), Qt::FindDirectChildrenOnly);
+
+  if (offer == nullptr || !offer->isPending(packet.getOriginId(), packet.getSequence())) return;
+
+  if (const auto items = offer->applyDelta(packet); items.has_value()) {
+    this->completeOffer(session, items.value(), packet.getOriginId(), packet.getSequence());
+  } else {
+    // a base is not here so the full items are asked for again
+    session->sendPacket(utility::functions::createPacket(utility::functions::params::NeedPacketParams{offer->getMissing(), packet.getOriginId(), packet.getSequence()}));
+  }
+}
+
+void ServerManager::onCapabilityPacket(Session* session, const packets::CapabilityPacket& packet) {
+  session->setPeerEncodings(packet.getEncodings());
+  session->announceCapabilities();
+}
+
 void ServerManager::onClientDisconnected(Session* session) {
   clients.removeOne(session);
   emit clientDisconnected(session);
@@ -27,6 +129,13 @@ void ServerManager::onClientDisconnected(Session* session) {
 
 void ServerManager::onClientConnected(Session* session) {
   clients.append(session);
+
+  // a legacy client rejects the packet so it is sent only if the
+  // handshake negotiated the protocol
+  if (session->isProtocolNegotiated()) {
+    session->announceCapabilities();
+  }
+
   emit clientConnected(session);
 }
 
@@ -51,20 +160,170 @@ void ServerManager::onServiceUnregistrationFailed(std::exception_ptr eptr) {
 }
 
 void ServerManager::onNetworkPacket(Session* session, const packets::NetworkPacket& networkPacket) {
-  if (auto syncPacket = dynamic_cast<const packets::SyncingPacket*>(&networkPacket)) {
+  if (auto syncPacket = dynamic_cast<const packets::SyncingPacketView*>(&networkPacket)) {
     onSyncingPacket(session, *syncPacket);
   } else if (auto pingPacket = dynamic_cast<const packets::PingPongPacket*>(&networkPacket)) {
     onPingPongPacket(session, *pingPacket);
+  } else if (auto beginPacket = dynamic_cast<const packets::StreamBeginPacket*>(&networkPacket)) {
+    onStreamBeginPacket(session, *beginPacket);
+  } else if (auto chunkPacket = dynamic_cast<const packets::StreamChunkPacket*>(&networkPacket)) {
+    onStreamChunkPacket(session, *chunkPacket);
+  } else if (auto endPacket = dynamic_cast<const packets::StreamEndPacket*>(&networkPacket)) {
+    onStreamEndPacket(session, *endPacket);
+  } else if (auto offerPacket = dynamic_cast<const packets::OfferPacket*>(&networkPacket)) {
+    onOfferPacket(session, *offerPacket);
+  } else if (auto needPacket = dynamic_cast<const packets::NeedPacket*>(&networkPacket)) {
+    onNeedPacket(session, *needPacket);
+  } else if (auto deltaPacket = dynamic_cast<const packets::DeltaPacket*>(&networkPacket)) {
+    onDeltaPacket(session, *deltaPacket);
+  } else if (auto capabilityPacket = dynamic_cast<const packets::CapabilityPacket*>(&networkPacket)) {
+    onCapabilityPacket(session, *capabilityPacket);
   }
 }
 
-void ServerManager::synchronize(const QVector<QPair<QString, QByteArray>>& items) {
-  auto syncingPacket = utility::functions::createPacket(utility::functions::params::SyncingPacketParams{.items = items});
+StreamReceiver* ServerManager::getStreamReceiver(Session* session) {
+  if (auto* receiver = session->findChild<StreamReceiver*>(QString(), Qt::FindDirectChildrenOnly)) {
+    return receiver;
+  }
+
+  // the receiver lives as long as the session
+  auto* receiver = new StreamReceiver(session);
+
+  connect(receiver, &StreamReceiver::progress, this, [this, session](quint32 transferId, quint64 received, quint64 total) {
+    emit transferReceiveProgress(session, transferId, received, total);
+  });
+
+  connect(receiver, &StreamReceiver::completed, this, [this, session](quint32 transferId, QUuid originId, quint64 sequence, QVector<QPair<QString, QByteArray>> items) {
+    if (this->completeOffer(session, items, originId, sequence)) return;
+    if (!syncClock->accept(originId, sequence)) return;
+    this->applyItems(session, items, originId, sequence);
+  });
+
+  return receiver;
+}
+
+OfferSender* ServerManager::getOfferSender(Session* session) {
+  if (auto* sender = session->findChild<OfferSender*>(QString(), Qt::FindDirectChildrenOnly)) {
+    return sender;
+  }
+
+  return new OfferSender(contentStore, session);
+}
+
+OfferReceiver* ServerManager::getOfferReceiver(Session* session) {
+  if (auto* receiver = session->findChild<OfferReceiver*>(QString(), Qt::FindDirectChildrenOnly)) {
+    return receiver;
+  }
+
+  return new OfferReceiver(contentStore, session);
+}
+
+bool ServerManager::completeOffer(Session* session, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence) {
+  auto* offer = session->findChild<OfferReceiver*>(QString(), Qt::FindDirectChildrenOnly);
+
+  if (offer == nullptr || !offer->isPending(originId, sequence)) {
+    return false;
+  }
+
+  const auto result = offer->complete(items);
+
+  // a newer update may have been applied while the payloads were sent
+  if (syncClock->isLatest(originId, sequence)) {
+    this->applyItems(session, result, originId, sequence);
+  }
+
+  return true;
+}
+
+void ServerManager::applyItems(Session* from, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence) {
+  if (relayEnabled) {
+    this->relayItems(from, items, originId, sequence);
+  } else if (OfferSender::isOfferable(items)) {
+    contentStore->putItems(items);
+  }
+
+  emit OnSyncRequest(items, utility::functions::contentFingerprint(items));
+}
+
+void ServerManager::sendItems(Session* session, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence) {
+  // large items are streamed in chunks to a peer that announced it
+  if (session->hasPeerCapabilities() && StreamSender::isStreamable(items)) {
+    transferId = transferId + 1;
+    this->sendStream(session, items, originId, sequence);
+    return;
+  }
+
+  session->sendPacket(utility::functions::createPacket(utility::functions::params::SyncingPacketParams{.items = items, .originId = originId, .sequence = sequence, .encodings = session->getPeerEncodings(), .stamped = session->hasPeerCapabilities()}));
+}
+
+void ServerManager::sendStream(Session* session, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence) {
+  auto* sender = StreamSender::send(session, transferId, originId, sequence, items);
+
+  connect(sender, &StreamSender::progress, this, [this, session](quint32 transferId, quint64 sent, quint64 total) {
+    emit transferSendProgress(session, transferId, sent, total);
+  });
+}
+
+QVector<Session*> ServerManager::relayFrame(Session* from, const QByteArray& frame, quint32 encodings) {
+  QVector<Session*> pending;
+
   for (auto* client : clients) {
-    if (client->isTrusted()) {
-      client->sendPacket(syncingPacket);
+    if (client == from || !client->isTrusted()) {
+      continue;
+    }
+
+    // clients that can not decode the frame are left to the caller
+    if (client->hasPeerCapabilities() && utility::functions::isDecodable(encodings, client->getPeerEncodings())) {
+      client->sendFrame(frame);
+    } else {
+      pending.append(client);
+    }
+  }
+
+  return pending;
+}
+
+void ServerManager::relayItems(Session* from, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence) {
+  // large items are offered by hash and each client asks for the
+  // payloads it does not have
+  if (OfferSender::isOfferable(items)) {
+    const auto hashes = contentStore->putItems(items);
+    const auto offerPacket = utility::functions::createPacket(utility::functions::params::OfferPacketParams{items, hashes, originId, sequence});
+    const auto frame = offerPacket.toBytes();
+    for (auto* client : clients) {
+      if (client == from || !client->isTrusted()) {
+        continue;
+      }
+
+      // a legacy client only takes the items
+      if (client->hasPeerCapabilities()) {
+        this->getOfferSender(client)->setOffer(originId, sequence, items, hashes);
+        client->sendFrame(frame);
+      } else {
+        this->sendItems(client, items, originId, sequence);
+      }
     }
+    return;
   }
+
+  auto syncingPacket = utility::functions::createPacket(utility::functions::params::SyncingPacketParams{.items = items, .originId = originId, .sequence = sequence, .encodings = utility::functions::getSupportedEncodings()});
+
+  // encode once and share the same frame with every client that can decode it
+  for (auto* client : this->relayFrame(from, syncingPacket.toBytes(), syncingPacket.getEncodings())) {
+    this->sendItems(client, items, originId, sequence);
+  }
+}
+
+void ServerManager::synchronize(const QVector<QPair<QString, QByteArray>>& items) {
+  this->relayItems(nullptr, items, syncClock->getOrigin(), syncClock->next());
+}
+
+void ServerManager::setRelayEnabled(bool enabled) {
+  relayEnabled = enabled;
+}
+
+bool ServerManager::isRelayEnabled() const noexcept {
+  return relayEnabled;
 }
 
 void ServerManager::start(bool useBluetooth) {
@@ -6,13 +6,22 @@
 
 #include "common/types/ssl_config/ssl_config.hpp"
 #include "packets/authentication/authentication.hpp"
+#include "packets/capabilitypacket/capabilitypacket.hpp"
+#include "packets/deltapacket/deltapacket.hpp"
 #include "packets/invalidrequest/invalidrequest.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
 #include "packets/syncingpacket/syncingpacket.hpp"
+#include "packets/syncingpacket/syncingpacketview.hpp"
 #include "packets/pingpongpacket/pingpongpacket.hpp"
+#include "packets/streamingpacket/streamingpacket.hpp"
 #include "syncing/manager/host_manager.hpp"
 #include "syncing/server.hpp"
 #include "syncing/server_factory.hpp"
 #include "syncing/session.hpp"
+#include "syncing/streaming/stream_receiver.hpp"
+#include "syncing/streaming/stream_sender.hpp"
+#include "syncing/offering/offer_receiver.hpp"
+#include "syncing/offering/offer_sender.hpp"
 #include "packets/network_packet.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::syncing {
@@ -23,8 +32,15 @@ class ServerManager : public HostManager {
   Q_DISABLE_COPY_MOVE(ServerManager)
 
  private:
-  void onSyncingPacket(Session* session, const packets::SyncingPacket& packet);
+  void onSyncingPacket(Session* session, const packets::SyncingPacketView& packet);
   void onPingPongPacket(Session* session, const packets::PingPongPacket& packet);
+  void onStreamBeginPacket(Session* session, const packets::StreamBeginPacket& packet);
+  void onStreamChunkPacket(Session* session, const packets::StreamChunkPacket& packet);
+  void onStreamEndPacket(Session* session, const packets::StreamEndPacket& packet);
+  void onOfferPacket(Session* session, const packets::OfferPacket& packet);
+  void onNeedPacket(Session* session, const packets::NeedPacket& packet);
+  void onDeltaPacket(Session* session, const packets::DeltaPacket& packet);
+  void onCapabilityPacket(Session* session, const packets::CapabilityPacket& packet);
   void onClientDisconnected(Session* session);
   void onClientConnected(Session* session);
   void onClientError(Session* session, std::exception_ptr eptr);
@@ -33,10 +49,21 @@ class ServerManager : public HostManager {
   void onServiceRegistrationFailed(std::exception_ptr eptr);
   void onServiceUnregistrationFailed(std::exception_ptr eptr);
   void onNetworkPacket(Session* session, const packets::NetworkPacket& networkPacket);
+  StreamReceiver* getStreamReceiver(Session* session);
+  OfferSender* getOfferSender(Session* session);
+  OfferReceiver* getOfferReceiver(Session* session);
+  bool completeOffer(Session* session, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence);
+  void applyItems(Session* from, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence);
+  void sendItems(Session* session, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence);
+  void sendStream(Session* session, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence);
+  QVector<Session*> relayFrame(Session* from, const QByteArray& frame, quint32 encodings);
+  void relayItems(Session* from, const QVector<QPair<QString, QByteArray>>& items, const QUuid& originId, quint64 sequence);
 
  private:
   Server* server = nullptr;
   QVector<Session*> clients;
+  quint32 transferId = 0;
+  bool relayEnabled  = true;
 
  public:
   explicit ServerManager(QObject* parent = nullptr);
@@ -46,6 +73,13 @@ class ServerManager : public HostManager {
   virtual void start(bool useBluetooth) override;
   virtual void stop() override;
 
+  /**
+   * @brief When enabled a sync received from a client is forwarded as is
+   * to every other trusted client, the originator is excluded
+   */
+  void setRelayEnabled(bool enabled);
+  bool isRelayEnabled() const noexcept;
+
  signals:
   void clientDisconnected(Session* session);
   void clientConnected(Session* session);
@@ -1,17 +1,32 @@
 #include "syncing_manager.hpp"
 
+#include <QTimer>
+
+#include "common/trust/trusted_servers_factory.hpp"
+#include "constants/constants.hpp"
+#include "utility/functions/crypto/crypto.hpp"
+#include "utility/functions/packet/packet.hpp"
+
 namespace srilakshmikanthanp::clipbirdesk::syncing {
 
 void SyncingManager::onServerFound(ClientServer* server) {
+  QMutexLocker locker(&stateLock);
   availableServers.append(server);
+  const auto servers = availableServers;
+  locker.unlock();
+
   emit serverFoundEvent(server);
-  emit availableServersChanged(availableServers);
+  emit availableServersChanged(servers);
 }
 
 void SyncingManager::onServerGone(ClientServer* server) {
+  QMutexLocker locker(&stateLock);
   availableServers.removeOne(server);
+  const auto servers = availableServers;
+  locker.unlock();
+
   emit serverGoneEvent(server);
-  emit availableServersChanged(availableServers);
+  emit availableServersChanged(servers);
 }
 
 void SyncingManager::onBrowsingStarted() {
@@ -31,31 +46,73 @@ void SyncingManager::onBrowsingStopFailed(std::exception_ptr eptr) {
 }
 
 void SyncingManager::onServerConnected(Session* session) {
-  this->connectedServer = session;
+  {
+    QMutexLocker locker(&stateLock);
+    this->connectedServer = session;
+  }
+
+  // the server has not seen what was copied before
+  lastFingerprint.reset();
+
+  // remember where the server was reached for the next start or wake
+  if (auto* server = qobject_cast<ClientServer*>(session->parent())) {
+    auto endpoint        = server->getEndpoint();
+    endpoint.fingerprint = utility::functions::fingerprint(session->getCertificate());
+    knownEndpoints->putEndpoint(endpoint);
+  }
+
+  // the GUI gets the trust as a value so it is sent again on change
+  connect(session, &Session::onTrustedStateChanged, this, &SyncingManager::updateConnectedServer, Qt::UniqueConnection);
+
   emit connectedToServer(session);
-  emit connectedServerChanged(session);
+  this->updateConnectedServer();
 }
 
 void SyncingManager::onServerDisconnected(Session* session) {
-  this->connectedServer = nullptr;
+  {
+    QMutexLocker locker(&stateLock);
+    this->connectedServer = nullptr;
+  }
+
+  disconnect(session, &Session::onTrustedStateChanged, this, &SyncingManager::updateConnectedServer);
+
   emit disconnectedFromServer(session);
-  emit connectedServerChanged(nullptr);
+  this->updateConnectedServer();
 }
 
 void SyncingManager::onServerError(Session* session, std::exception_ptr eptr) {
+  // a failed direct connect leaves the server to discovery
+  if (directServer != nullptr && session->parent() == directServer.data() && getConnectedServer() != session) {
+    this->dropDirectServer();
+  }
+
   emit errorEvent(session, eptr);
 }
 
 void SyncingManager::onClientDisconnected(Session* session) {
-  connectedClients.removeOne(session);
-  emit clientDisconnectedEvent(session);
-  emit connectedClientsChanged(connectedClients);
+  {
+    QMutexLocker locker(&stateLock);
+    connectedClients.removeOne(session);
+  }
+
+  emit clientDisconnectedEvent(session->getInfo());
+  this->updateConnectedClients();
 }
 
 void SyncingManager::onClientConnected(Session* session) {
-  connectedClients.append(session);
-  emit clientConnectedEvent(session);
-  emit connectedClientsChanged(connectedClients);
+  {
+    QMutexLocker locker(&stateLock);
+    connectedClients.append(session);
+  }
+
+  // the client has not seen what was copied before
+  lastFingerprint.reset();
+
+  // the GUI gets the trust as a value so it is sent again on change
+  connect(session, &Session::onTrustedStateChanged, this, &SyncingManager::updateConnectedClients, Qt::UniqueConnection);
+
+  emit clientConnectedEvent(session->getInfo());
+  this->updateConnectedClients();
 }
 
 void SyncingManager::onClientError(Session* session, std::exception_ptr eptr) {
@@ -78,7 +135,28 @@ void SyncingManager::onServiceUnregisteringFailed(std::exception_ptr eptr) {
   emit serviceUnregisteringFailedEvent(eptr);
 }
 
+void SyncingManager::onSyncRequest(const QVector<QPair<QString, QByteArray>>& items, quint64 fingerprint) {
+  // the received content is not sent back when it is copied again
+  lastFingerprint = fingerprint;
+  emit OnSyncRequest(items, fingerprint);
+}
+
 void SyncingManager::synchronize(const QVector<QPair<QString, QByteArray>>& items) {
+  this->synchronize(items, utility::functions::contentFingerprint(items));
+}
+
+void SyncingManager::synchronize(const QVector<QPair<QString, QByteArray>>& items, quint64 fingerprint) {
+  if (postToOwnThread([this, items, fingerprint] { this->synchronize(items, fingerprint); })) {
+    return;
+  }
+
+  // the same content was just sent or received
+  if (fingerprint == lastFingerprint) {
+    return;
+  }
+
+  lastFingerprint = fingerprint;
+
   if (hostManager != nullptr) {
     hostManager->synchronize(items);
   }
@@ -86,44 +164,184 @@ void SyncingManager::synchronize(const QVector<QPair<QString, QByteArray>>& item
 
 // Host management
 void SyncingManager::setHostAsServer(bool useBluetooth) {
+  if (postToOwnThread([this, useBluetooth] { this->setHostAsServer(useBluetooth); })) {
+    return;
+  }
+
   this->stop();
-  hostManager = serverManager;
+  this->setHostManager(serverManager);
   hostManager->start(useBluetooth);
   emit hostManagerChanged(hostManager);
   emit isHostServerChanged(true);
 }
 
 void SyncingManager::setHostAsClient(bool useBluetooth) {
+  if (postToOwnThread([this, useBluetooth] { this->setHostAsClient(useBluetooth); })) {
+    return;
+  }
+
   this->stop();
-  hostManager = clientManager;
+  this->setHostManager(clientManager);
   hostManager->start(useBluetooth);
   emit hostManagerChanged(hostManager);
   emit isHostServerChanged(false);
+
+  // discovery keeps running and takes over if the endpoint changed
+  this->connectToKnownServer(useBluetooth);
 }
 
 void SyncingManager::stop() {
-  for (auto* client : connectedClients) client->disconnectFromHost();
-  connectedClients.clear();
-  emit connectedClientsChanged(connectedClients);
+  if (postToOwnThread([this] { this->stop(); })) {
+    return;
+  }
 
+  QMutexLocker locker(&stateLock);
+  const auto clients = connectedClients;
+  connectedClients.clear();
   availableServers.clear();
-  emit availableServersChanged(availableServers);
+  locker.unlock();
+
+  for (auto* client : clients) client->disconnectFromHost();
+  this->updateConnectedClients();
+  emit availableServersChanged({});
+
+  this->dropDirectServer();
 
   if (hostManager != nullptr) {
     hostManager->stop();
   }
 
-  hostManager = nullptr;
+  this->setHostManager(nullptr);
   emit hostManagerChanged(hostManager);
   emit isHostServerChanged(false);
 }
 
 void SyncingManager::connectToServer(ClientServer* server) {
+  if (postToOwnThread([this, server] { this->connectToServer(server); })) {
+    return;
+  }
+
+  // the direct connect is already on the way to the same endpoint
+  if (directServer != nullptr && directServer.data() != server) {
+    if (directServer->getEndpoint().isSameAddress(server->getEndpoint())) {
+      return;
+    }
+
+    this->dropDirectServer();
+  }
+
   this->clientManager->connectToServer(server);
 }
 
+void SyncingManager::disconnectSession(QPointer<Session> session) {
+  if (postToOwnThread([this, session] { this->disconnectSession(session); })) {
+    return;
+  }
+
+  // the session may be gone by the time a posted call runs
+  if (this->isConnectedSession(session)) {
+    session->disconnectFromHost();
+  }
+}
+
+void SyncingManager::authenticate(QPointer<Session> session, common::types::enums::AuthStatus status) {
+  if (postToOwnThread([this, session, status] { this->authenticate(session, status); })) {
+    return;
+  }
+
+  // the session may be gone by the time a posted call runs
+  if (this->isConnectedSession(session)) {
+    session->sendPacket(utility::functions::createPacket(utility::functions::params::AuthenticationParams{status}));
+  }
+}
+
+bool SyncingManager::isConnectedSession(Session* session) const {
+  QMutexLocker locker(&stateLock);
+  return session != nullptr && (connectedClients.contains(session) || connectedServer == session);
+}
+
+void SyncingManager::updateConnectedClients() {
+  QVector<SessionInfo> clients;
+
+  // the list is only changed on this thread so it is read without the lock
+  for (auto* client : connectedClients) {
+    clients.append(client->getInfo());
+  }
+
+  {
+    QMutexLocker locker(&stateLock);
+    connectedClientsInfo = clients;
+  }
+
+  emit connectedClientsChanged(clients);
+}
+
+void SyncingManager::updateConnectedServer() {
+  std::optional<SessionInfo> server;
+
+  if (connectedServer != nullptr) {
+    server = connectedServer->getInfo();
+  }
+
+  {
+    QMutexLocker locker(&stateLock);
+    connectedServerInfo = server;
+  }
+
+  emit connectedServerChanged(server);
+}
+
+void SyncingManager::setHostManager(HostManager* manager) {
+  QMutexLocker locker(&stateLock);
+  hostManager = manager;
+}
+
+void SyncingManager::connectToKnownServer(bool useBluetooth) {
+  using common::types::enums::Transport;
+
+  const auto transport = useBluetooth ? Transport::Bluetooth : Transport::Network;
+  const auto endpoint  = knownEndpoints->getLastEndpoint(transport);
+  const auto trusted   = common::trust::TrustedServersFactory::getTrustedServers();
+
+  // only a server still trusted with the same certificate
+  if (!endpoint.has_value() || !trusted->isTrustedServerFingerprint(endpoint->name, endpoint->fingerprint)) {
+    return;
+  }
+
+  if ((directServer = clientManager->connectToEndpoint(endpoint.value())) == nullptr) {
+    return;
+  }
+
+  // give up on the endpoint if it does not answer in time
+  QTimer::singleShot(constants::getAppDirectConnectTimeout(), directServer.data(), [this, server = directServer.data()] {
+    const auto connected = getConnectedServer();
+
+    if (directServer.data() == server && (connected == nullptr || connected->parent() != server)) {
+      this->dropDirectServer();
+    }
+  });
+}
+
+void SyncingManager::dropDirectServer() {
+  if (directServer == nullptr) {
+    return;
+  }
+
+  QMutexLocker locker(&stateLock);
+  const auto isConnected = connectedServer != nullptr && connectedServer->parent() == directServer.data();
+  locker.unlock();
+
+  // a connected direct server is left to the browser that owns it
+  if (!isConnected) {
+    directServer->deleteLater();
+  }
+
+  directServer = nullptr;
+}
+
 // Getters
 std::optional<ClientServer*> SyncingManager::getClientServerByName(const QString& name) const {
+  QMutexLocker locker(&stateLock);
   for (auto* server : availableServers) {
     if (server->getName() == name) return server;
   }
@@ -131,6 +349,7 @@ std::optional<ClientServer*> SyncingManager::getClientServerByName(const QString
 }
 
 std::optional<Session*> SyncingManager::getServerClientSessionByName(const QString& name) const {
+  QMutexLocker locker(&stateLock);
   for (auto* session : connectedClients) {
     if (session->getName() == name) return session;
   }
@@ -138,22 +357,37 @@ std::optional<Session*> SyncingManager::getServerClientSessionByName(const QStri
 }
 
 QVector<ClientServer*> SyncingManager::getAvailableServers() const {
+  QMutexLocker locker(&stateLock);
   return availableServers;
 }
 
 QVector<Session*> SyncingManager::getConnectedClients() const {
+  QMutexLocker locker(&stateLock);
   return connectedClients;
 }
 
 Session* SyncingManager::getConnectedServer() const {
+  QMutexLocker locker(&stateLock);
   return this->connectedServer;
 }
 
+QVector<SessionInfo> SyncingManager::getConnectedClientsInfo() const {
+  QMutexLocker locker(&stateLock);
+  return connectedClientsInfo;
+}
+
+std::optional<SessionInfo> SyncingManager::getConnectedServerInfo() const {
+  QMutexLocker locker(&stateLock);
+  return connectedServerInfo;
+}
+
 HostManager* SyncingManager::getHostManager() const {
+  QMutexLocker locker(&stateLock);
   return hostManager;
 }
 
 bool SyncingManager::isHostServer() const {
+  QMutexLocker locker(&stateLock);
   return hostManager == serverManager;
 }
 
@@ -165,7 +399,7 @@ SyncingManager::SyncingManager(QObject* parent) : Synchronizer(parent) {
   connect(serverManager, &ServerManager::serviceRegisteringFailed, this, &SyncingManager::onServiceRegisteringFailed);
   connect(serverManager, &ServerManager::serviceUnregisteringFailed, this, &SyncingManager::onServiceUnregisteringFailed);
   connect(serverManager, &ServerManager::errorOccurred, this, &SyncingManager::onClientError);
-  connect(serverManager, &ServerManager::OnSyncRequest, this, &SyncingManager::OnSyncRequest);
+  connect(serverManager, &ServerManager::OnSyncRequest, this, &SyncingManager::onSyncRequest);
 
   connect(clientManager, &ClientManager::serverFound, this, &SyncingManager::onServerFound);
   connect(clientManager, &ClientManager::serverGone, this, &SyncingManager::onServerGone);
@@ -176,7 +410,7 @@ SyncingManager::SyncingManager(QObject* parent) : Synchronizer(parent) {
   connect(clientManager, &ClientManager::connected, this, &SyncingManager::onServerConnected);
   connect(clientManager, &ClientManager::disconnected, this, &SyncingManager::onServerDisconnected);
   connect(clientManager, &ClientManager::errorOccurred, this, &SyncingManager::onServerError);
-  connect(clientManager, &ClientManager::OnSyncRequest, this, &SyncingManager::OnSyncRequest);
+  connect(clientManager, &ClientManager::OnSyncRequest, this, &SyncingManager::onSyncRequest);
 }
 
 SyncingManager::~SyncingManager() {
@@ -1,16 +1,23 @@
 #pragma once
 
+#include <QMetaObject>
+#include <QMutex>
 #include <QObject>
+#include <QPointer>
 #include <QString>
+#include <QThread>
 #include <QVector>
 #include <optional>
 
+#include "common/types/enums/enums.hpp"
 #include "syncing/manager/client_manager.hpp"
 #include "syncing/manager/server_manager.hpp"
 #include "syncing/manager/host_manager.hpp"
+#include "syncing/manager/known_endpoints.hpp"
 #include "syncing/client_server.hpp"
 #include "syncing/session.hpp"
 #include "syncing/synchronizer.hpp"
+#include "utility/functions/fingerprint/fingerprint.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::syncing {
 class SyncingManager : public Synchronizer {
@@ -26,10 +33,41 @@ class SyncingManager : public Synchronizer {
   HostManager* hostManager = nullptr;
   Session* connectedServer = nullptr;
 
-  // State
+  // Fingerprint of the items last sent or received, same content is not sent again
+  std::optional<quint64> lastFingerprint;
+
+  // Last endpoints of servers, tried directly on start or wake
+  KnownEndpoints* knownEndpoints = new KnownEndpoints(this);
+  QPointer<ClientServer> directServer;
+
+  // State, guarded by the lock since getters may run on other threads
+  mutable QMutex stateLock;
   QVector<ClientServer*> availableServers;
   QVector<Session*> connectedClients;
 
+  // Snapshots of the sessions handed to other threads, taken on this thread
+  QVector<SessionInfo> connectedClientsInfo;
+  std::optional<SessionInfo> connectedServerInfo;
+
+ private:
+  /**
+   * @brief Post the call to the thread of the manager when called
+   * from another thread (ex: GUI), sockets must only be touched from
+   * the thread they live in
+   *
+   * @return true if the call was posted
+   */
+  template <typename Func>
+  bool postToOwnThread(Func&& func) {
+    if (QThread::currentThread() == this->thread()) {
+      return false;
+    }
+
+    QMetaObject::invokeMethod(this, std::forward<Func>(func), Qt::QueuedConnection);
+
+    return true;
+  }
+
  private:
   // ClientManager event handlers
   void onServerFound(ClientServer* server);
@@ -51,6 +89,20 @@ class SyncingManager : public Synchronizer {
   void onServiceRegisteringFailed(std::exception_ptr eptr);
   void onServiceUnregisteringFailed(std::exception_ptr eptr);
 
+  // Shared event handlers
+  void onSyncRequest(const QVector<QPair<QString, QByteArray>>& items, quint64 fingerprint);
+
+  void setHostManager(HostManager* manager);
+
+  // Take the snapshots again and notify
+  void updateConnectedClients();
+  void updateConnectedServer();
+  bool isConnectedSession(Session* session) const;
+
+  // Direct connect to the last known server
+  void connectToKnownServer(bool useBluetooth);
+  void dropDirectServer();
+
  public:
   explicit SyncingManager(QObject* parent = nullptr);
   virtual ~SyncingManager();
@@ -58,6 +110,9 @@ class SyncingManager : public Synchronizer {
   // Synchronizer interface
   virtual void synchronize(const QVector<QPair<QString, QByteArray>>& items) override;
 
+  // Synchronize with the fingerprint taken when the items were read
+  void synchronize(const QVector<QPair<QString, QByteArray>>& items, quint64 fingerprint);
+
   // Host management
   void setHostAsServer(bool useBluetooth = false);
   void setHostAsClient(bool useBluetooth = false);
@@ -67,6 +122,8 @@ class SyncingManager : public Synchronizer {
 
   // Connection management
   void connectToServer(ClientServer* server);
+  void disconnectSession(QPointer<Session> session);
+  void authenticate(QPointer<Session> session, common::types::enums::AuthStatus status);
 
   // Getters
   std::optional<ClientServer*> getClientServerByName(const QString& name) const;
@@ -74,6 +131,8 @@ class SyncingManager : public Synchronizer {
   QVector<ClientServer*> getAvailableServers() const;
   QVector<Session*> getConnectedClients() const;
   Session* getConnectedServer() const;
+  QVector<SessionInfo> getConnectedClientsInfo() const;
+  std::optional<SessionInfo> getConnectedServerInfo() const;
   HostManager* getHostManager() const;
   bool isHostServer() const;
   bool isBrowsing() const;
@@ -91,8 +150,8 @@ class SyncingManager : public Synchronizer {
   void errorEvent(Session* session, std::exception_ptr eptr);
 
   // ServerManager events
-  void clientDisconnectedEvent(Session* session);
-  void clientConnectedEvent(Session* session);
+  void clientDisconnectedEvent(SessionInfo session);
+  void clientConnectedEvent(SessionInfo session);
   void serviceRegisteredEvent();
   void serviceUnregisteredEvent();
   void serviceRegisteringFailedEvent(std::exception_ptr eptr);
@@ -100,8 +159,8 @@ class SyncingManager : public Synchronizer {
 
   // State change events
   void availableServersChanged(QVector<ClientServer*> servers);
-  void connectedClientsChanged(QVector<Session*> clients);
-  void connectedServerChanged(Session* server);
+  void connectedClientsChanged(QVector<SessionInfo> clients);
+  void connectedServerChanged(std::optional<SessionInfo> server);
   void hostManagerChanged(HostManager* manager);
   void isHostServerChanged(bool isServer);
 };
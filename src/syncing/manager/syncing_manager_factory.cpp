@@ -1,9 +1,48 @@
 #include "syncing_manager_factory.hpp"
 
+#include "syncing/manager/syncing_thread.hpp"
+#include "syncing/sync_clock/sync_clock_factory.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing::internal {
+/**
+ * @brief SyncingManager on its SyncingThread, signals of the manager
+ * reach GUI objects through queued connections
+ */
+class SyncingManagerThread {
+ private:
+
+  SyncingThread thread;
+  SyncingManager* manager;
+
+ public:
+
+  SyncingManagerThread() {
+    qRegisterMetaType<std::exception_ptr>();
+    qRegisterMetaType<QVector<QPair<QString, QByteArray>>>();
+    qRegisterMetaType<SessionInfo>();
+    qRegisterMetaType<QVector<SessionInfo>>();
+    qRegisterMetaType<std::optional<SessionInfo>>();
+
+    // the clock reads the device id from the GUI settings so it is made
+    // on this thread before anything runs on the syncing thread
+    SyncClockFactory::getSyncClock();
+
+    // created before the thread starts, then moved with its children
+    manager = new SyncingManager();
+    thread.adopt(manager);
+    thread.start();
+  }
+
+  SyncingManager* getSyncingManager() const {
+    return manager;
+  }
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing::internal
+
 namespace srilakshmikanthanp::clipbirdesk::syncing {
-Q_GLOBAL_STATIC(SyncingManager, syncingManagerInstance)
+Q_GLOBAL_STATIC(internal::SyncingManagerThread, syncingThreadInstance)
 
 SyncingManager* SyncingManagerFactory::getSyncingManager() {
-  return syncingManagerInstance;
+  return syncingThreadInstance->getSyncingManager();
 }
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -0,0 +1,36 @@
+#include "syncing_thread.hpp"
+
+#include <QCoreApplication>
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+SyncingThread::SyncingThread() {
+  thread.setObjectName("SyncingThread");
+
+  // nothing on the thread may outlive the application
+  if (auto* app = QCoreApplication::instance()) {
+    QObject::connect(app, &QCoreApplication::aboutToQuit, &thread, [this] { this->stop(); }, Qt::DirectConnection);
+  }
+}
+
+SyncingThread::~SyncingThread() {
+  this->stop();
+}
+
+void SyncingThread::adopt(QObject* object) {
+  object->moveToThread(&thread);
+  QObject::connect(&thread, &QThread::finished, object, &QObject::deleteLater);
+}
+
+void SyncingThread::start() {
+  thread.start();
+}
+
+void SyncingThread::stop() {
+  thread.quit();
+  thread.wait();
+}
+
+QThread* SyncingThread::getThread() noexcept {
+  return &thread;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
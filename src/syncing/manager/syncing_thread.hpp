@@ -0,0 +1,40 @@
+#pragma once
+
+#include <QObject>
+#include <QThread>
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Owns the thread the syncing layer runs on so sockets, TLS and
+ * heartbeats never wait for the GUI thread, the thread is quit and
+ * joined when the application is about to quit since a global instance
+ * is only destroyed after the application
+ */
+class SyncingThread {
+ private:
+  Q_DISABLE_COPY_MOVE(SyncingThread)
+
+ private:
+  QThread thread;
+
+ public:
+  SyncingThread();
+  ~SyncingThread();
+
+  /**
+   * @brief Move the object with its children to the thread, it is
+   * deleted there once the thread finishes
+   */
+  void adopt(QObject* object);
+
+  void start();
+
+  /**
+   * @brief Quit the event loop and wait for the thread, does nothing
+   * once the thread is finished
+   */
+  void stop();
+
+  QThread* getThread() noexcept;
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -19,6 +19,15 @@ NetClientServer::~NetClientServer() {
   // No operation
 }
 
+KnownEndpoint NetClientServer::getEndpoint() const {
+  return KnownEndpoint{
+    netResolvedDevice.name,
+    common::types::enums::Transport::Network,
+    netResolvedDevice.host.toString(),
+    netResolvedDevice.port
+  };
+}
+
 void NetClientServer::connect(syncing::ClientServerEventHandler *handler) {
   auto session = new NetClientServerSession(
     trustedServers,
@@ -32,5 +32,6 @@ class NetClientServer : public ClientServer {
   virtual void connect(
     syncing::ClientServerEventHandler *handler
   ) override;
+  virtual KnownEndpoint getEndpoint() const override;
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing
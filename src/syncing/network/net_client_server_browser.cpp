@@ -90,6 +90,11 @@ void NetClientServerBrowser::stop() {
   mdnsBrowser->stop();
 }
 
+ClientServer* NetClientServerBrowser::createClientServer(const KnownEndpoint& endpoint) {
+  NetResolvedDevice device{endpoint.name, QHostAddress(endpoint.host), endpoint.port};
+  return new NetClientServer(device, sslConfig, trustedServers, this);
+}
+
 NetClientServerBrowser::~NetClientServerBrowser() {
   this->stop();
 }
@@ -45,6 +45,7 @@ class NetClientServerBrowser : public ClientServerBrowser {
 
   virtual void start() override;
   virtual void stop() override;
+  virtual ClientServer* createClientServer(const KnownEndpoint& endpoint) override;
 };
 
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing::network
@@ -4,10 +4,21 @@
 
 #include "constants/constants.hpp"
 #include "common/types/exceptions/exceptions.hpp"
+#include "utility/functions/crypto/crypto.hpp"
 #include "utility/functions/nbytes/nbytes.hpp"
 #include "utility/functions/packet/packet.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::syncing::network {
+QByteArray NetClientServerSession::trustedFingerprint() const {
+  for (const auto& server : this->trustedServers->getTrustedServers()) {
+    if (server.name == this->device.name) {
+      return utility::functions::fingerprint(server.certificate);
+    }
+  }
+
+  return QByteArray();
+}
+
 void NetClientServerSession::handleTrustedServersChanged(QList<common::trust::TrustedServer> servers) {
   if (m_ssl_socket->state() == QAbstractSocket::ConnectedState) {
     emit onTrustedStateChanged(isTrusted());
@@ -47,32 +58,37 @@ void NetClientServerSession::handleSslErrors(const QList<QSslError>& errors) {
   this->m_ssl_socket->ignoreSslErrors();
 }
 
-void NetClientServerSession::handlePingTimeout() {
-  using utility::functions::params::PingPacketParams;
-  using utility::functions::createPacket;
-  auto pingPacket = createPacket(PingPacketParams{common::types::enums::PingType::Ping});
-  this->sendPacket(pingPacket);
+void NetClientServerSession::handleConnected() {
+  this->startHeartbeat();
+  emit connected(this);
 }
 
-void NetClientServerSession::handlePongTimeout() {
-  auto lastRead = m_ssl_socket->property(READ_TIME).toDateTime();
-  auto now      = QDateTime::currentDateTime();
-  auto diff     = lastRead.msecsTo(now);
+void NetClientServerSession::handleEncrypted() {
+  // peer certificate is fixed for the connection
+  this->m_certificate = this->m_ssl_socket->peerCertificate().toPem();
+  this->m_fingerprint = utility::functions::fingerprint(this->m_certificate);
 
-  if (diff > constants::getAppMaxReadIdleTime()) {
-    m_ssl_socket->disconnectFromHost();
-  }
+  // TLS 1.2 servers hand the ticket over within the handshake
+  this->handleNewSessionTicket();
+
+  qDebug() << "TLS handshake with" << this->device.name
+           << (this->m_ticketOffered ? "(ticket offered)" : "(full)")
+           << "took" << this->m_handshakeTimer.elapsed() << "ms";
 }
 
-void NetClientServerSession::handleConnected() {
-  this->m_pingTimer->start(constants::getAppMaxWriteIdleTime());
-  this->m_pongTimer->start(constants::getAppMaxReadIdleTime());
-  emit connected(this);
+void NetClientServerSession::handleNewSessionTicket() {
+  // TLS 1.3 servers send the ticket only after the handshake
+  const auto ssl = this->m_ssl_socket->sslConfiguration();
+  NetTicketCacheFactory::getTicketCache()->putTicket(
+    this->device.name, this->m_fingerprint, ssl.sessionTicket(), ssl.sessionTicketLifeTimeHint()
+  );
 }
 
 void NetClientServerSession::handleDisconnected() {
-  this->m_pingTimer->stop();
-  this->m_pongTimer->stop();
+  this->decoder.clear();
+  this->m_certificate.clear();
+  this->m_fingerprint.clear();
+  this->stopHeartbeat();
   emit disconnected(this);
 }
 
@@ -82,130 +98,33 @@ void NetClientServerSession::handleError(QAbstractSocket::SocketError socketErro
   ));
 }
 
-void NetClientServerSession::handleReadyRead() {
-  using utility::functions::fromQByteArray;
-  m_ssl_socket->setProperty(READ_TIME, QDateTime::currentDateTime());
-
-  // get the first four bytes of the packet
-  QDataStream get(m_ssl_socket);
-
-  // QByteArray to store the data
-  QByteArray data;
-
-  /// uploader QDataStream
-  QDataStream put(&data, QIODevice::WriteOnly);
-
-  // start the transaction
-  get.startTransaction();
-
-  // get the packet length
-  qint32 packetLength;
-
-  // read the packet length
-  get >> packetLength;
-
-  // write the packet length
-  put << packetLength;
-
-  // infer the read size
-  auto toRead = packetLength - data.length();
-
-  // check has enough bytes
-  if (m_ssl_socket->bytesAvailable() < toRead) {
-    return get.rollbackTransaction();
-  }
-
-  // resize the data
-  data.resize(packetLength);
-
-  // read the data from the socket
-  auto start = data.data() + data.size() - toRead;
-  auto bytes = get.readRawData(start, toRead);
-
-  // check for error
-  if (bytes == -1) {
-    return get.rollbackTransaction();
-  }
-
-  // update the toRead
-  toRead -= bytes;
-
-  // if toRead is not zero then return
-  if (toRead) {
-    return get.rollbackTransaction();
-  }
-
-  // commit the transaction
-  if (!get.commitTransaction()) {
-    return;
-  }
-
-  try {
-    emit this->networkPacket(this, fromQByteArray<packets::Authentication>(data));
-    return;
-  } catch (const common::types::exceptions::MalformedPacket& e) {
-    qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
-  } catch (const std::exception& e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
-  }
-
+void NetClientServerSession::handleFrame(const QByteArray& data) {
   try {
-    emit this->networkPacket(this, fromQByteArray<packets::SyncingPacket>(data));
-    return;
+    if (!dispatcher.dispatch(data)) {
+      qDebug() << "Unknown Packet Found";
+    }
   } catch (const common::types::exceptions::MalformedPacket& e) {
     qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
   } catch (const std::exception& e) {
     qDebug() << e.what();
-    return;
   } catch (...) {
     qDebug() << "Unknown Error";
-    return;
   }
+}
 
-  try {
-    emit this->networkPacket(this, fromQByteArray<packets::PingPongPacket>(data));
-    return;
-  } catch (const common::types::exceptions::MalformedPacket& e) {
-    qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
-  } catch (const std::exception& e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
-  }
+void NetClientServerSession::handleReadyRead() {
+  this->markRead();
+  decoder.append(m_ssl_socket->readAll());
 
   try {
-    emit this->networkPacket(this, fromQByteArray<packets::InvalidRequest>(data));
-    return;
+    while (auto frame = decoder.next()) {
+      this->handleFrame(frame.value());
+    }
   } catch (const common::types::exceptions::MalformedPacket& e) {
     qDebug() << e.what();
-    return;
-  } catch (const common::types::exceptions::NotThisPacket& e) {
-    // No-Op
-  } catch (const std::exception& e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
+    decoder.clear();
+    m_ssl_socket->abort();
   }
-
-  // if no packet is found
-  qDebug() << "Unknown Packet Found";
 }
 
 NetClientServerSession::NetClientServerSession(
@@ -217,9 +136,64 @@ NetClientServerSession::NetClientServerSession(
     trustedServers(trustedServers),
     device(device),
     sslConfig(sslConfig) {
-  QObject::connect(
-    m_pingTimer, &QTimer::timeout,
-    this, &NetClientServerSession::handlePingTimeout
+  dispatcher.registerPacket<packets::Authentication>(
+    packets::PacketType::AUTHENTICATION_PACKET,
+    [this](const packets::Authentication& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::SyncingPacketView>(
+    packets::PacketType::SYNCING_PACKET,
+    [this](const packets::SyncingPacketView& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::SyncingPacketView>(
+    packets::PacketType::STAMPED_SYNCING_PACKET,
+    [this](const packets::SyncingPacketView& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::PingPongPacket>(
+    packets::PacketType::PING_PONG_PACKET,
+    [this](const packets::PingPongPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::StreamBeginPacket>(
+    packets::PacketType::STREAM_BEGIN_PACKET,
+    [this](const packets::StreamBeginPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::StreamChunkPacket>(
+    packets::PacketType::STREAM_CHUNK_PACKET,
+    [this](const packets::StreamChunkPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::StreamEndPacket>(
+    packets::PacketType::STREAM_END_PACKET,
+    [this](const packets::StreamEndPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::OfferPacket>(
+    packets::PacketType::OFFER_PACKET,
+    [this](const packets::OfferPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::NeedPacket>(
+    packets::PacketType::NEED_PACKET,
+    [this](const packets::NeedPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::CapabilityPacket>(
+    packets::PacketType::CAPABILITY_PACKET,
+    [this](const packets::CapabilityPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::DeltaPacket>(
+    packets::PacketType::DELTA_PACKET,
+    [this](const packets::DeltaPacket& packet) { emit this->networkPacket(this, packet); }
+  );
+
+  dispatcher.registerPacket<packets::InvalidRequest>(
+    packets::PacketType::INVALID_REQUEST,
+    [this](const packets::InvalidRequest& packet) { emit this->networkPacket(this, packet); }
   );
 
   QObject::connect(
@@ -229,6 +203,20 @@ NetClientServerSession::NetClientServerSession(
     &NetClientServerSession::handleConnected
   );
 
+  QObject::connect(
+    m_ssl_socket,
+    &QSslSocket::encrypted,
+    this,
+    &NetClientServerSession::handleEncrypted
+  );
+
+  QObject::connect(
+    m_ssl_socket,
+    &QSslSocket::newSessionTicketReceived,
+    this,
+    &NetClientServerSession::handleNewSessionTicket
+  );
+
   QObject::connect(
     m_ssl_socket,
     &QSslSocket::disconnected,
@@ -251,8 +239,10 @@ NetClientServerSession::NetClientServerSession(
   );
 
   QObject::connect(
-    m_pongTimer, &QTimer::timeout,
-    this, &NetClientServerSession::handlePongTimeout
+    m_ssl_socket,
+    &QSslSocket::bytesWritten,
+    this,
+    &Session::onBytesWritten
   );
 
   QObject::connect(
@@ -267,8 +257,8 @@ NetClientServerSession::~NetClientServerSession() {
   // Nothing to do here
 }
 
-void NetClientServerSession::sendPacket(const packets::NetworkPacket& packet) {
-  this->m_ssl_socket->write(packet.toBytes());
+void NetClientServerSession::writeFrame(const QByteArray& frame) {
+  this->m_ssl_socket->write(frame);
 }
 
 void NetClientServerSession::disconnectFromHost() {
@@ -276,11 +266,15 @@ void NetClientServerSession::disconnectFromHost() {
 }
 
 bool NetClientServerSession::isTrusted() const {
-  return this->trustedServers->isTrustedServer(common::trust::TrustedServer{this->device.name, m_ssl_socket->peerCertificate().toPem()});
+  return this->trustedServers->isTrustedServerFingerprint(this->device.name, m_fingerprint);
 }
 
 QByteArray NetClientServerSession::getCertificate() const {
-  return m_ssl_socket->peerCertificate().toPem();
+  return m_certificate;
+}
+
+qint64 NetClientServerSession::socketBytesToWrite() const {
+  return this->m_ssl_socket->bytesToWrite();
 }
 
 void NetClientServerSession::connect() {
@@ -289,8 +283,22 @@ void NetClientServerSession::connect() {
   }
 
   QSslConfiguration ssl = m_ssl_socket->sslConfiguration();
-  ssl.setPrivateKey(QSslKey(sslConfig.privateKey, QSsl::Rsa, QSsl::Pem, QSsl::PrivateKey));
+  ssl.setPrivateKey(utility::functions::getQSslPrivateKey(sslConfig.privateKey));
   ssl.setLocalCertificate(QSslCertificate(sslConfig.certificate, QSsl::Pem));
+
+  // keep the session so the server's ticket can be read after handshake
+  ssl.setSslOption(QSsl::SslOptionDisableSessionTickets, false);
+  ssl.setSslOption(QSsl::SslOptionDisableSessionPersistence, false);
+
+  // offer the ticket only if the server still has the trusted certificate,
+  // only a server that keeps its ticket keys across connections resumes
+  const auto ticket = NetTicketCacheFactory::getTicketCache()->getTicket(device.name, trustedFingerprint());
+  ssl.setSessionTicket(ticket);
+  m_ticketOffered = !ticket.isEmpty();
+
+  // a server that negotiates it opens the capability exchange
+  ssl.setAllowedNextProtocols({constants::getAppProtocolName()});
+
   m_ssl_socket->setSslConfiguration(ssl);
 
   QObject::connect(
@@ -300,6 +308,7 @@ void NetClientServerSession::connect() {
     &NetClientServerSession::handleSslErrors
   );
 
+  m_handshakeTimer.start();
   m_ssl_socket->connectToHostEncrypted(device.host.toString(), device.port);
 }
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing::network
@@ -7,16 +7,25 @@
 #include <QSslCertificate>
 #include <QTimer>
 #include <QDateTime>
+#include <QElapsedTimer>
 
 #include "common/trust/trusted_servers.hpp"
 #include "common/types/ssl_config/ssl_config.hpp"
 #include "packets/network_packet.hpp"
 #include "packets/authentication/authentication.hpp"
+#include "packets/capabilitypacket/capabilitypacket.hpp"
+#include "packets/deltapacket/deltapacket.hpp"
 #include "packets/pingpongpacket/pingpongpacket.hpp"
+#include "packets/streamingpacket/streamingpacket.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
 #include "packets/syncingpacket/syncingpacket.hpp"
+#include "packets/syncingpacket/syncingpacketview.hpp"
 #include "packets/invalidrequest/invalidrequest.hpp"
+#include "packets/frame_decoder/frame_decoder.hpp"
+#include "packets/packet_dispatcher/packet_dispatcher.hpp"
 #include "syncing/session.hpp"
 #include "syncing/network/net_resolved_device.hpp"
+#include "syncing/network/net_ticket_cache.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::syncing::network {
 class NetClientServerSession : public Session {
@@ -28,23 +37,32 @@ class NetClientServerSession : public Session {
   common::types::SslConfig sslConfig;
 
   QSslSocket* m_ssl_socket = new QSslSocket(this);
-  QTimer* m_pingTimer = new QTimer(this);
-  QTimer* m_pongTimer = new QTimer(this);
-  const char* READ_TIME = "READ_TIME";
+  QByteArray m_certificate;
+  QByteArray m_fingerprint;
+  QElapsedTimer m_handshakeTimer;
+  bool m_ticketOffered = false;
+  packets::PacketDispatcher<> dispatcher;
+  packets::FrameDecoder decoder;
 
  private:
   Q_DISABLE_COPY_MOVE(NetClientServerSession)
 
  private:
+  QByteArray trustedFingerprint() const;
   void handleTrustedServersChanged(QList<common::trust::TrustedServer> servers);
   void handleSslErrors(const QList<QSslError>& errors);
-  void handlePingTimeout();
-  void handlePongTimeout();
   void handleConnected();
+  void handleEncrypted();
+  void handleNewSessionTicket();
   void handleDisconnected();
   void handleError(QAbstractSocket::SocketError socketError);
+  void handleFrame(const QByteArray& data);
   void handleReadyRead();
 
+ protected:
+  virtual void writeFrame(const QByteArray& frame) override;
+  virtual qint64 socketBytesToWrite() const override;
+
  public:
   explicit NetClientServerSession(
     common::trust::TrustedServers* trustedServers,
@@ -55,7 +73,6 @@ class NetClientServerSession : public Session {
 
   virtual ~NetClientServerSession();
 
-  virtual void sendPacket(const packets::NetworkPacket& packet) override;
   virtual void disconnectFromHost() override;
   virtual bool isTrusted() const override;
   virtual QByteArray getCertificate() const override;
@@ -3,6 +3,9 @@
 #include <QSslCertificate>
 #include <QSslKey>
 
+#include "constants/constants.hpp"
+#include "utility/functions/ssl/ssl.hpp"
+
 namespace srilakshmikanthanp::clipbirdesk::syncing::network {
 void NetServer::handlePendingConnections() {
   while (m_server->hasPendingConnections()) {
@@ -27,7 +30,9 @@ void NetServer::handlePendingConnections() {
     auto session = new NetServerClientSession(name, cert.toPem(), trustedClients, client, this);
     client->setParent(session);
     client->setProperty(SESSION, QVariant::fromValue<QObject*>(session));
+    m_decoders.insert(client, packets::FrameDecoder());
     m_clients.append(session);
+    session->startHeartbeat();
     emit onClientConnected(session);
   }
 }
@@ -77,6 +82,7 @@ void NetServer::handleError(QAbstractSocket::SocketError socketError) {
 
 void NetServer::handleClientDisconnection() {
   auto client = qobject_cast<QSslSocket *>(sender());
+  m_decoders.remove(client);
   QList<NetServerClientSession*>::iterator iterator = std::find_if(m_clients.begin(), m_clients.end(), [&](NetServerClientSession* c) {
     return c->getSocket() == client;
   });
@@ -85,102 +91,22 @@ void NetServer::handleClientDisconnection() {
     return;
   }
 
+  auto session = *iterator;
   m_clients.erase(iterator);
-  emit onClientDisconnected(*iterator);
+  session->stopHeartbeat();
+  emit onClientDisconnected(session);
 }
 
-void NetServer::handleClientReadyRead() {
-  auto client = qobject_cast<QSslSocket *>(sender());
-  client->setProperty(READ_TIME, QDateTime::currentDateTime());
-  NetServerClientSession* session = client->property(SESSION).value<NetServerClientSession*>();
-
-  if (session == nullptr) {
-    return;
-  }
-
+void NetServer::handleClientFrame(NetServerClientSession* session, const QByteArray& data) {
   using utility::functions::createPacket;
-  using utility::functions::fromQByteArray;
-
-  // get the first four bytes of the packet
-  QDataStream get(client);
-
-  // QByteArray to store the data
-  QByteArray data;
-
-  /// uploader QDataStream
-  QDataStream put(&data, QIODevice::WriteOnly);
-
-  // start the transaction
-  get.startTransaction();
-
-  // get the packet length
-  qint32 packetLength;
-
-  // read the packet length
-  get >> packetLength;
-
-  // write the packet length
-  put << packetLength;
-
-  // infer the read size
-  qint32 toRead = packetLength - data.size();
-
-  // check has enough bytes
-  if (client->bytesAvailable() < toRead) {
-    return get.rollbackTransaction();
-  }
-
-  // resize the data
-  data.resize(packetLength);
-
-  // read the data from the socket
-  auto start = data.data() + data.size() - toRead;
-  auto bytes = get.readRawData(start, toRead);
-
-  // check for error
-  if (bytes == -1) {
-    return get.rollbackTransaction();
-  }
-
-  // update the toRead
-  toRead -= bytes;
-
-  // if toRead is not zero then return
-  if (toRead) {
-    return get.rollbackTransaction();
-  }
-
-  // commit the transaction
-  if (!get.commitTransaction()) {
-    return;
-  }
-
-  // Deserialize the data to SyncingPacket
-  try {
-    emit this->onNetworkPacket(session, fromQByteArray<packets::SyncingPacket>(data));
-    return;
-  } catch (const common::types::exceptions::MalformedPacket &e) {
-    session->sendPacket(createPacket({e.getCode(), e.what()}));
-    return;
-  } catch (const common::types::exceptions::NotThisPacket &e) {
-    // No-Op
-  } catch (const std::exception &e) {
-    qDebug() << e.what();
-    return;
-  } catch (...) {
-    qDebug() << "Unknown Error";
-    return;
-  }
 
-  // Deserialize the data to SyncingPacket
   try {
-    emit this->onNetworkPacket(session, fromQByteArray<packets::PingPongPacket>(data));
-    return;
+    if (dispatcher.dispatch(session, data)) {
+      return;
+    }
   } catch (const common::types::exceptions::MalformedPacket &e) {
     session->sendPacket(createPacket({e.getCode(), e.what()}));
     return;
-  } catch (const common::types::exceptions::NotThisPacket &e) {
-    // No-Op
   } catch (const std::exception &e) {
     qDebug() << e.what();
     return;
@@ -195,29 +121,74 @@ void NetServer::handleClientReadyRead() {
   session->sendPacket(createPacket({code, msg}));
 }
 
+void NetServer::handleClientReadyRead() {
+  auto client = qobject_cast<QSslSocket *>(sender());
+  NetServerClientSession* session = client->property(SESSION).value<NetServerClientSession*>();
 
-void NetServer::handlePingTimeout() {
-  using utility::functions::params::PingPacketParams;
-  using packets::PingPongPacket;
-  using utility::functions::createPacket;
-  auto pingPacket = createPacket(PingPacketParams{
-    common::types::enums::PingType::Ping
-  });
-}
+  if (session == nullptr || !m_decoders.contains(client)) {
+    return;
+  }
 
-void NetServer::handlePongTimeout() {
-  for (auto client : m_clients) {
-    auto lastRead = client->property(READ_TIME).toDateTime();
-    auto now      = QDateTime::currentDateTime();
-    auto diff     = lastRead.msecsTo(now);
+  session->markRead();
 
-    if (diff > constants::getAppMaxReadIdleTime()) {
-      client->disconnectFromHost();
+  m_decoders[client].append(client->readAll());
+
+  // handlers may disconnect the client so look up the decoder on each frame
+  try {
+    while (m_decoders.contains(client)) {
+      auto frame = m_decoders[client].next();
+      if (!frame.has_value()) break;
+      this->handleClientFrame(session, frame.value());
     }
+  } catch (const common::types::exceptions::MalformedPacket &e) {
+    qDebug() << e.what();
+    m_decoders.remove(client);
+    client->abort();
   }
 }
 
 NetServer::NetServer(const common::types::SslConfig sslConfig, common::trust::TrustedClients* trustedClients, QObject *parent): Server(sslConfig, parent), trustedClients(trustedClients) {
+  dispatcher.registerPacket<packets::SyncingPacketView>(
+    packets::PacketType::SYNCING_PACKET,
+    [this](NetServerClientSession* session, const packets::SyncingPacketView& packet) { emit this->onNetworkPacket(session, packet); }
+  );
+  dispatcher.registerPacket<packets::SyncingPacketView>(
+    packets::PacketType::STAMPED_SYNCING_PACKET,
+    [this](NetServerClientSession* session, const packets::SyncingPacketView& packet) { emit this->onNetworkPacket(session, packet); }
+  );
+  dispatcher.registerPacket<packets::PingPongPacket>(
+    packets::PacketType::PING_PONG_PACKET,
+    [this](NetServerClientSession* session, const packets::PingPongPacket& packet) { emit this->onNetworkPacket(session, packet); }
+  );
+  dispatcher.registerPacket<packets::StreamBeginPacket>(
+    packets::PacketType::STREAM_BEGIN_PACKET,
+    [this](NetServerClientSession* session, const packets::StreamBeginPacket& packet) { emit this->onNetworkPacket(session, packet); }
+  );
+  dispatcher.registerPacket<packets::StreamChunkPacket>(
+    packets::PacketType::STREAM_CHUNK_PACKET,
+    [this](NetServerClientSession* session, const packets::StreamChunkPacket& packet) { emit this->onNetworkPacket(session, packet); }
+  );
+  dispatcher.registerPacket<packets::StreamEndPacket>(
+    packets::PacketType::STREAM_END_PACKET,
+    [this](NetServerClientSession* session, const packets::StreamEndPacket& packet) { emit this->onNetworkPacket(session, packet); }
+  );
+  dispatcher.registerPacket<packets::OfferPacket>(
+    packets::PacketType::OFFER_PACKET,
+    [this](NetServerClientSession* session, const packets::OfferPacket& packet) { emit this->onNetworkPacket(session, packet); }
+  );
+  dispatcher.registerPacket<packets::NeedPacket>(
+    packets::PacketType::NEED_PACKET,
+    [this](NetServerClientSession* session, const packets::NeedPacket& packet) { emit this->onNetworkPacket(session, packet); }
+  );
+  dispatcher.registerPacket<packets::CapabilityPacket>(
+    packets::PacketType::CAPABILITY_PACKET,
+    [this](NetServerClientSession* session, const packets::CapabilityPacket& packet) { emit this->onNetworkPacket(session, packet); }
+  );
+
+  dispatcher.registerPacket<packets::DeltaPacket>(
+    packets::PacketType::DELTA_PACKET,
+    [this](NetServerClientSession* session, const packets::DeltaPacket& packet) { emit this->onNetworkPacket(session, packet); }
+  );
   connect(
     this->m_mdnsRegister, &MdnsRegister::OnServiceUnregisteringFailed,
     this, &NetServer::onServiceUnregistrationFailed
@@ -234,14 +205,6 @@ NetServer::NetServer(const common::types::SslConfig sslConfig, common::trust::Tr
     this->m_mdnsRegister, &MdnsRegister::OnServiceUnregistered,
     this, &NetServer::onServiceUnregistered
   );
-  connect(
-    this->m_pingTimer, &QTimer::timeout,
-    this, &NetServer::handlePingTimeout
-  );
-  connect(
-    this->m_pongTimer, &QTimer::timeout,
-    this, &NetServer::handlePongTimeout
-  );
   QObject::connect(
     m_server, &QSslServer::sslErrors,
     this, &NetServer::handleSslErrors
@@ -250,9 +213,6 @@ NetServer::NetServer(const common::types::SslConfig sslConfig, common::trust::Tr
     m_server, &QSslServer::pendingConnectionAvailable,
     this, &NetServer::handlePendingConnections
   );
-
-  this->m_pingTimer->start(constants::getAppMaxWriteIdleTime());
-  this->m_pongTimer->start(constants::getAppMaxReadIdleTime());
 }
 
 NetServer::~NetServer() {
@@ -261,8 +221,16 @@ NetServer::~NetServer() {
 
 void NetServer::start() {
   QSslConfiguration ssl = m_server->sslConfiguration();
-  ssl.setPrivateKey(QSslKey(sslConfig.privateKey, QSsl::Rsa, QSsl::Pem, QSsl::PrivateKey));
+  ssl.setPrivateKey(utility::functions::getQSslPrivateKey(sslConfig.privateKey));
   ssl.setLocalCertificate(QSslCertificate(sslConfig.certificate, QSsl::Pem));
+
+  // every accepted socket gets a TLS context of its own so a ticket
+  // could never be resumed, clients do a full handshake
+  ssl.setSslOption(QSsl::SslOptionDisableSessionTickets, true);
+
+  // only clients offering the protocol are sent a CapabilityPacket
+  ssl.setAllowedNextProtocols({constants::getAppProtocolName()});
+
   m_server->setSslConfiguration(ssl);
 
   if (!m_server->listen()) {
@@ -271,20 +239,17 @@ void NetServer::start() {
 
   auto port = std::to_string(m_server->serverPort());
   m_mdnsRegister->registerService(m_server->serverPort());
-  m_pingTimer->start(constants::getAppMaxWriteIdleTime());
-  m_pongTimer->start(constants::getAppMaxReadIdleTime());
 }
 
 void NetServer::stop() {
   m_mdnsRegister->unregisterService();
   m_server->close();
-  m_pingTimer->stop();
-  m_pongTimer->stop();
 
   for (auto client : m_clients) {
     client->disconnectFromHost();
   }
 
   m_clients.clear();
+  m_decoders.clear();
 }
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -2,6 +2,7 @@
 
 #include <QApplication>
 #include <QByteArray>
+#include <QHash>
 #include <QList>
 #include <QObject>
 #include <QSslConfiguration>
@@ -12,6 +13,13 @@
 #include "common/types/exceptions/exceptions.hpp"
 #include "common/trust/trusted_clients.hpp"
 #include "net_mdns.hpp"
+#include "packets/frame_decoder/frame_decoder.hpp"
+#include "packets/packet_dispatcher/packet_dispatcher.hpp"
+#include "packets/streamingpacket/streamingpacket.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
+#include "packets/capabilitypacket/capabilitypacket.hpp"
+#include "packets/deltapacket/deltapacket.hpp"
+#include "packets/syncingpacket/syncingpacketview.hpp"
 #include "syncing/server.hpp"
 #include "syncing/session.hpp"
 #include "syncing/synchronizer.hpp"
@@ -32,22 +40,20 @@ class NetServer : public syncing::Server {
  private:
 
   QSslServer* m_server         = new QSslServer(this);
-  QTimer* m_pingTimer          = new QTimer(this);
-  QTimer* m_pongTimer          = new QTimer(this);
-  const char* READ_TIME        = "READ_TIME";
   const char* SESSION          = "SESSION";
   MdnsRegister* m_mdnsRegister = new MdnsRegister(this);
   common::trust::TrustedClients* trustedClients;
   QList<NetServerClientSession*> m_clients;
+  packets::PacketDispatcher<NetServerClientSession*> dispatcher;
+  QHash<QSslSocket*, packets::FrameDecoder> m_decoders;
 
  private:
   void handlePendingConnections();
   void handleSslErrors(QSslSocket *, const QList<QSslError>& errors);
   void handleError(QAbstractSocket::SocketError socketError);
   void handleClientDisconnection();
+  void handleClientFrame(NetServerClientSession* session, const QByteArray& data);
   void handleClientReadyRead();
-  void handlePingTimeout();
-  void handlePongTimeout();
 
  public:
 
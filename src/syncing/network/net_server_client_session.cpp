@@ -1,5 +1,8 @@
 #include "net_server_client_session.hpp"
 
+#include "constants/constants.hpp"
+#include "utility/functions/crypto/crypto.hpp"
+
 namespace srilakshmikanthanp::clipbirdesk::syncing::network {
 void NetServerClientSession::handleTrustedClientsChanged(QList<common::trust::TrustedClient> servers) {
   if (m_socket->state() == QAbstractSocket::ConnectedState) {
@@ -13,13 +16,24 @@ NetServerClientSession::NetServerClientSession(
   common::trust::TrustedClients* trustedClients,
   QSslSocket* socket,
   QObject* parent
-) : Session(name, parent), trustedClients(trustedClients), m_certificate(certificate), m_socket(socket) {
+) : Session(name, parent),
+    trustedClients(trustedClients),
+    m_certificate(certificate),
+    m_fingerprint(utility::functions::fingerprint(certificate)),
+    m_socket(socket) {
   connect(
     this->trustedClients,
     &common::trust::TrustedClients::trustedClientsChanged,
     this,
     &NetServerClientSession::handleTrustedClientsChanged
   );
+
+  QObject::connect(
+    this->m_socket,
+    &QSslSocket::bytesWritten,
+    this,
+    &Session::onBytesWritten
+  );
 }
 
 NetServerClientSession::~NetServerClientSession() {
@@ -30,17 +44,9 @@ QSslSocket* NetServerClientSession::getSocket() const {
   return m_socket;
 }
 
-void NetServerClientSession::sendPacket(const packets::NetworkPacket& packet) {
-  const auto data = packet.toBytes();
-  qint32 wrote    = 0L;
-
-  while (wrote < data.size()) {
-    auto bytes = this->m_socket->write(data.data() + wrote, data.size() - wrote);
-    if (bytes == -1) break;
-    wrote = wrote + bytes;
-  }
-
-  if (wrote != data.size()) {
+void NetServerClientSession::writeFrame(const QByteArray& frame) {
+  // the socket buffers the frame by sharing it so one frame can be sent to many sessions
+  if (this->m_socket->write(frame) != frame.size()) {
     qErrnoWarning("Error while writing to the socket");
   }
 
@@ -52,10 +58,18 @@ void NetServerClientSession::disconnectFromHost() {
 }
 
 bool NetServerClientSession::isTrusted() const {
-  return this->trustedClients->isTrustedClient(common::trust::TrustedClient{this->getName(), m_certificate});
+  return this->trustedClients->isTrustedClientFingerprint(this->getName(), m_fingerprint);
 }
 
 QByteArray NetServerClientSession::getCertificate() const {
   return m_certificate;
 }
+
+bool NetServerClientSession::isProtocolNegotiated() const {
+  return this->m_socket->sslConfiguration().nextNegotiatedProtocol() == constants::getAppProtocolName();
+}
+
+qint64 NetServerClientSession::socketBytesToWrite() const {
+  return this->m_socket->bytesToWrite();
+}
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing::network
@@ -18,11 +18,16 @@ class NetServerClientSession : public Session {
 
   common::trust::TrustedClients* trustedClients;
   QByteArray m_certificate;
+  QByteArray m_fingerprint;
   QSslSocket* m_socket;
 
  private:
   void handleTrustedClientsChanged(QList<common::trust::TrustedClient> servers);
 
+ protected:
+  void writeFrame(const QByteArray& frame) override;
+  qint64 socketBytesToWrite() const override;
+
  public:
 
   NetServerClientSession(
@@ -37,9 +42,9 @@ class NetServerClientSession : public Session {
 
   QSslSocket* getSocket() const;
 
-  void sendPacket(const packets::NetworkPacket& packet) override;
   void disconnectFromHost() override;
   bool isTrusted() const override;
   QByteArray getCertificate() const override;
+  bool isProtocolNegotiated() const override;
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing::network
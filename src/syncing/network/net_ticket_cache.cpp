@@ -0,0 +1,54 @@
+#include "net_ticket_cache.hpp"
+
+#include "constants/constants.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing::network {
+Q_GLOBAL_STATIC(NetTicketCache, netTicketCacheInstance)
+
+QByteArray NetTicketCache::getTicket(const QString& name, const QByteArray& fingerprint) {
+  QMutexLocker locker(&lock);
+
+  const auto key = qMakePair(name, fingerprint);
+  const auto itr = entries.constFind(key);
+
+  if (itr == entries.cend()) {
+    return QByteArray();
+  }
+
+  if (itr->expiry.hasExpired()) {
+    entries.remove(key);
+    return QByteArray();
+  }
+
+  return itr->ticket;
+}
+
+void NetTicketCache::putTicket(const QString& name, const QByteArray& fingerprint, const QByteArray& ticket, int lifetime) {
+  // a handshake without a new ticket keeps the one cached
+  if (ticket.isEmpty() || fingerprint.isEmpty()) {
+    return;
+  }
+
+  QMutexLocker locker(&lock);
+
+  // a server keeps one certificate so drop tickets of the old one
+  entries.removeIf([&](const auto& entry) { return entry.key().first == name; });
+
+  auto seconds = qint64(constants::getAppTlsTicketLifetime());
+
+  if (lifetime > 0) {
+    seconds = qMin(seconds, qint64(lifetime));
+  }
+
+  entries.insert(qMakePair(name, fingerprint), Entry{ticket, QDeadlineTimer(seconds * 1000)});
+}
+
+void NetTicketCache::removeTicket(const QString& name) {
+  QMutexLocker locker(&lock);
+  entries.removeIf([&](const auto& entry) { return entry.key().first == name; });
+}
+
+NetTicketCache* NetTicketCacheFactory::getTicketCache() {
+  return netTicketCacheInstance;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing::network
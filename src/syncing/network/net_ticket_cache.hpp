@@ -0,0 +1,57 @@
+#pragma once
+
+#include <QByteArray>
+#include <QDeadlineTimer>
+#include <QHash>
+#include <QMutex>
+#include <QPair>
+#include <QString>
+
+namespace srilakshmikanthanp::clipbirdesk::syncing::network {
+/**
+ * @brief TLS session tickets of the servers this host has connected to,
+ * keyed by server name and certificate fingerprint so a ticket is only
+ * offered to the server that issued it, a resumed handshake skips the
+ * certificate exchange and key agreement on reconnect
+ */
+class NetTicketCache {
+ private:
+  Q_DISABLE_COPY_MOVE(NetTicketCache)
+
+ private:
+  struct Entry {
+    QByteArray ticket;
+    QDeadlineTimer expiry;
+  };
+
+ private:
+  mutable QMutex lock;
+  QHash<QPair<QString, QByteArray>, Entry> entries;
+
+ public:
+  NetTicketCache() = default;
+  ~NetTicketCache() = default;
+
+  /**
+   * @brief Ticket for the server or empty if none or expired
+   */
+  QByteArray getTicket(const QString& name, const QByteArray& fingerprint);
+
+  /**
+   * @brief Store the ticket, older tickets of the server are replaced,
+   * an empty ticket is ignored so the cached one stays usable
+   * @param lifetime - lifetime hint from the server in seconds, non
+   * positive means the server gave no hint
+   */
+  void putTicket(const QString& name, const QByteArray& fingerprint, const QByteArray& ticket, int lifetime);
+
+  /**
+   * @brief Forget every ticket of the server
+   */
+  void removeTicket(const QString& name);
+};
+
+struct NetTicketCacheFactory {
+  static NetTicketCache* getTicketCache();
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing::network
@@ -0,0 +1,100 @@
+#include "offer_receiver.hpp"
+
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+#include "utility/functions/delta/delta.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+using common::types::exceptions::MalformedPacket;
+using common::types::enums::ErrorCode;
+
+OfferReceiver::OfferReceiver(ContentStore* store, QObject* parent) : QObject(parent), store(store) {}
+
+OfferReceiver::~OfferReceiver() {
+  // Nothing to do here
+}
+
+QVector<QByteArray> OfferReceiver::handleOfferPacket(const packets::OfferPacket& packet) {
+  QVector<QByteArray> missing;
+
+  originId = packet.getOriginId();
+  sequence = packet.getSequence();
+  pending  = true;
+  items.clear();
+
+  for (const auto& offered : packet.getItems()) {
+    Item item{QString::fromUtf8(offered.getMimeType()), offered.getHash(), store->get(offered.getHash())};
+
+    if (item.payload.isNull() || quint64(item.payload.size()) != offered.getPayloadLength()) {
+      item.payload = QByteArray();
+      missing.append(item.hash);
+    }
+
+    items.append(item);
+  }
+
+  return missing;
+}
+
+bool OfferReceiver::isPending(const QUuid& originId, quint64 sequence) const noexcept {
+  return pending && this->originId == originId && this->sequence == sequence;
+}
+
+QVector<QByteArray> OfferReceiver::getMissing() const {
+  QVector<QByteArray> missing;
+
+  for (const auto& item : items) {
+    if (item.payload.isNull()) missing.append(item.hash);
+  }
+
+  return missing;
+}
+
+std::optional<QVector<QPair<QString, QByteArray>>> OfferReceiver::applyDelta(const packets::DeltaPacket& packet) const {
+  QVector<QPair<QString, QByteArray>> needed;
+
+  for (const auto& item : packet.getItems()) {
+    const auto base = store->get(item.getBaseHash());
+
+    // evicted or never received, the full items are asked for again
+    if (base.isNull()) {
+      return std::nullopt;
+    }
+
+    needed.append(qMakePair(QString::fromUtf8(item.getMimeType()), utility::functions::applyDelta(base, item.getOps(), item.getTargetLength())));
+  }
+
+  return needed;
+}
+
+QVector<QPair<QString, QByteArray>> OfferReceiver::complete(const QVector<QPair<QString, QByteArray>>& needed) {
+  QVector<QPair<QString, QByteArray>> result;
+  result.reserve(items.size());
+  qsizetype next = 0;
+
+  pending = false;
+
+  for (const auto& item : items) {
+    if (!item.payload.isNull()) {
+      result.append(qMakePair(item.mimeType, item.payload));
+      continue;
+    }
+
+    if (next == needed.size() || needed[next].first != item.mimeType || ContentStore::hash(needed[next].second) != item.hash) {
+      items.clear();
+      throw MalformedPacket(ErrorCode::InvalidPacket, "OfferPacket");
+    }
+
+    store->put(item.hash, needed[next].second);
+    result.append(needed[next++]);
+  }
+
+  items.clear();
+
+  if (next != needed.size()) {
+    throw MalformedPacket(ErrorCode::InvalidPacket, "OfferPacket");
+  }
+
+  return result;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
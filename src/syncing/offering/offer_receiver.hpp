@@ -0,0 +1,82 @@
+#pragma once
+
+#include <QByteArray>
+#include <QObject>
+#include <QPair>
+#include <QString>
+#include <QUuid>
+#include <QVector>
+
+#include <optional>
+
+#include "packets/deltapacket/deltapacket.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
+#include "syncing/content_store/content_store.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Offer taken from one peer, the payloads found in the content
+ * store are kept with the offer and the rest are waited for as one
+ * SyncingPacket or stream with the origin and sequence of the offer
+ */
+class OfferReceiver : public QObject {
+  Q_OBJECT
+
+ private:
+  Q_DISABLE_COPY_MOVE(OfferReceiver)
+
+ private:
+  struct Item {
+    QString mimeType;
+    QByteArray hash;
+    QByteArray payload;
+  };
+
+ private:
+  ContentStore* store;
+  QUuid originId;
+  quint64 sequence = 0;
+  QVector<Item> items;
+  bool pending = false;
+
+ public:
+  explicit OfferReceiver(ContentStore* store, QObject* parent = nullptr);
+  virtual ~OfferReceiver();
+
+  /**
+   * @brief Take the offer in place of any pending one
+   * @return QVector<QByteArray> hashes of the payloads not in the store
+   */
+  QVector<QByteArray> handleOfferPacket(const packets::OfferPacket& packet);
+
+  /**
+   * @brief Check whether the items of the origin and sequence complete
+   * the pending offer
+   */
+  bool isPending(const QUuid& originId, quint64 sequence) const noexcept;
+
+  /**
+   * @brief Hashes of the payloads the pending offer still waits for
+   */
+  QVector<QByteArray> getMissing() const;
+
+  /**
+   * @brief Rebuild the needed items of the pending offer from the delta
+   * and their bases in the store, throws MalformedPacket if an op is out
+   * of its base
+   *
+   * @return std::optional<QVector<QPair<QString, QByteArray>>> nullopt if
+   * a base is not in the store
+   */
+  std::optional<QVector<QPair<QString, QByteArray>>> applyDelta(const packets::DeltaPacket& packet) const;
+
+  /**
+   * @brief Complete the pending offer with the needed items in the order
+   * they were offered, the payloads are checked against the hashes and
+   * stored, throws MalformedPacket if they do not match
+   *
+   * @return QVector<QPair<QString, QByteArray>> every item of the offer
+   */
+  QVector<QPair<QString, QByteArray>> complete(const QVector<QPair<QString, QByteArray>>& needed);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
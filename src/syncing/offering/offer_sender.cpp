@@ -0,0 +1,109 @@
+#include "offer_sender.hpp"
+
+#include "constants/constants.hpp"
+#include "utility/functions/delta/delta.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+std::optional<QVector<packets::DeltaItem>> OfferSender::createDelta(const QVector<QPair<QString, QByteArray>>& needed, const QVector<QByteArray>& neededHashes) const {
+  QVector<packets::DeltaItem> delta;
+  qsizetype deltaLength = 0;
+  qsizetype fullLength  = 0;
+
+  for (qsizetype i = 0; i < needed.size(); i++) {
+    const auto& [mimeType, payload] = needed[i];
+    const auto baseHash = bases.value(mimeType);
+
+    // the peer asked for the very payload it was last sent
+    if (!utility::functions::isDeltaCompatible(mimeType) || baseHash.isEmpty() || baseHash == neededHashes[i]) {
+      return std::nullopt;
+    }
+
+    const auto base = store->get(baseHash);
+
+    // the base was evicted from the store
+    if (base.isNull()) {
+      return std::nullopt;
+    }
+
+    const auto ops = utility::functions::createDelta(base, payload);
+
+    packets::DeltaItem item;
+    item.setMimeType(mimeType.toUtf8());
+    item.setBaseHash(baseHash);
+    item.setTargetLength(quint64(payload.size()));
+    item.setOps(ops);
+    delta.append(item);
+
+    deltaLength += utility::functions::deltaSize(ops);
+    fullLength  += payload.size();
+  }
+
+  // mostly new text saves little and a large delta would not be streamed
+  if (delta.isEmpty() || deltaLength * 2 > fullLength || deltaLength > constants::getAppStreamThreshold()) {
+    return std::nullopt;
+  }
+
+  return delta;
+}
+
+OfferSender::OfferSender(ContentStore* store, QObject* parent) : QObject(parent), store(store) {}
+
+OfferSender::~OfferSender() {
+  // Nothing to do here
+}
+
+bool OfferSender::isOfferable(const QVector<QPair<QString, QByteArray>>& items) {
+  qint64 length = 0;
+
+  for (const auto& [mimeType, payload] : items) {
+    length += payload.size();
+  }
+
+  return length > constants::getAppSyncOfferThreshold();
+}
+
+void OfferSender::setOffer(const QUuid& originId, quint64 sequence, const QVector<QPair<QString, QByteArray>>& items, const QVector<QByteArray>& hashes) {
+  this->originId  = originId;
+  this->sequence  = sequence;
+  this->items     = items;
+  this->hashes    = hashes;
+  this->deltaSent = false;
+}
+
+std::optional<OfferSender::Answer> OfferSender::handleNeedPacket(const packets::NeedPacket& packet) {
+  if (items.isEmpty() || packet.getOriginId() != originId || packet.getSequence() != sequence) {
+    return std::nullopt;
+  }
+
+  const auto needed = packet.getHashes();
+  QVector<QByteArray> neededHashes;
+  Answer answer;
+
+  for (qsizetype i = 0; i < items.size(); i++) {
+    if (needed.contains(hashes[i])) {
+      answer.items.append(items[i]);
+      neededHashes.append(hashes[i]);
+    }
+  }
+
+  // a second need for the offer means the peer lacks a base of the delta
+  if (!deltaSent && !answer.items.isEmpty()) {
+    answer.delta = this->createDelta(answer.items, neededHashes);
+  }
+
+  // the peer has the items it did not need and gets the rest now
+  for (qsizetype i = 0; i < items.size(); i++) {
+    bases.insert(items[i].first, hashes[i]);
+  }
+
+  if (answer.delta.has_value()) {
+    deltaSent = true;
+  } else {
+    // the offer is answered so the payloads can be released
+    items.clear();
+    hashes.clear();
+  }
+
+  return answer;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QObject>
+#include <QPair>
+#include <QString>
+#include <QUuid>
+#include <QVector>
+
+#include <optional>
+
+#include "packets/deltapacket/deltapacket.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
+#include "syncing/content_store/content_store.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Items offered to one peer by hash waiting for its NeedPacket,
+ * only the latest offer is kept since the peer keeps only the latest,
+ * needed text is answered with a delta against the version of the same
+ * mime type the peer was last sent when that saves enough
+ */
+class OfferSender : public QObject {
+  Q_OBJECT
+
+ private:
+  Q_DISABLE_COPY_MOVE(OfferSender)
+
+ public:
+  struct Answer {
+    QVector<QPair<QString, QByteArray>> items;
+    std::optional<QVector<packets::DeltaItem>> delta;
+  };
+
+ private:
+  ContentStore* store;
+  QUuid originId;
+  quint64 sequence = 0;
+  QVector<QPair<QString, QByteArray>> items;
+  QVector<QByteArray> hashes;
+  QHash<QString, QByteArray> bases;
+  bool deltaSent = false;
+
+ private:
+  std::optional<QVector<packets::DeltaItem>> createDelta(const QVector<QPair<QString, QByteArray>>& needed, const QVector<QByteArray>& neededHashes) const;
+
+ public:
+  explicit OfferSender(ContentStore* store, QObject* parent = nullptr);
+  virtual ~OfferSender();
+
+  /**
+   * @brief Check whether the items are large enough to be offered by
+   * hash instead of being sent right away
+   */
+  static bool isOfferable(const QVector<QPair<QString, QByteArray>>& items);
+
+  /**
+   * @brief Keep the items until the peer answers the offer
+   */
+  void setOffer(const QUuid& originId, quint64 sequence, const QVector<QPair<QString, QByteArray>>& items, const QVector<QByteArray>& hashes);
+
+  /**
+   * @brief Items of the offer whose hashes the peer needs in the order
+   * they were offered with their delta if one is worth sending, nullopt
+   * if the need does not answer the offer, the offer is kept after a
+   * delta so a second need for it gets the full items
+   */
+  std::optional<Answer> handleNeedPacket(const packets::NeedPacket& packet);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -1,10 +1,221 @@
 #include "session.hpp"
 
+#include <QThread>
+#include <QThreadStorage>
+
+#include "constants/constants.hpp"
+#include "packets/packet_dispatcher/packet_dispatcher.hpp"
+#include "packets/packet_type.hpp"
+#include "syncing/timer_wheel/timer_wheel.hpp"
+#include "utility/functions/compression/compression.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing::internal {
+/**
+ * @brief The wheel of the calling thread, sessions only ever touch
+ * the wheel of the thread they live in
+ */
+TimerWheel* heartbeatWheel() {
+  static QThreadStorage<TimerWheel*> wheels;
+
+  if (!wheels.hasLocalData()) {
+    wheels.setLocalData(new TimerWheel(constants::getAppHeartbeatTick()));
+  }
+
+  return wheels.localData();
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing::internal
+
 namespace srilakshmikanthanp::clipbirdesk::syncing {
+void Session::drain() {
+  // writing may emit bytesWritten synchronously
+  if (draining) return;
+
+  draining = true;
+
+  // control frames are small so they skip the high water mark
+  while (!controlQueue.isEmpty()) {
+    const auto frame = controlQueue.dequeue();
+    queuedBytes = queuedBytes - frame.size();
+    this->writeFrame(frame);
+  }
+
+  while (!bulkQueue.isEmpty() && this->socketBytesToWrite() < highWaterMark) {
+    const auto frame = bulkQueue.dequeue();
+    queuedBytes = queuedBytes - frame.size();
+    this->writeFrame(frame);
+  }
+
+  draining = false;
+}
+
+void Session::handleHeartbeat() {
+  using utility::functions::params::PingPacketParams;
+  using utility::functions::createPacket;
+
+  const auto now = TimerWheel::now();
+
+  if (!heartbeating) {
+    return;
+  }
+
+  if (now - lastReadAt >= constants::getAppMaxReadIdleTime()) {
+    this->disconnectFromHost();
+    return;
+  }
+
+  if (now - lastPingAt >= constants::getAppMaxWriteIdleTime()) {
+    this->sendPacket(createPacket(PingPacketParams{common::types::enums::PingType::Ping}));
+    lastPingAt = now;
+    pingSentAt = now;
+  }
+
+  // the ping may have failed and stopped the heartbeat
+  if (heartbeating) {
+    this->scheduleHeartbeat();
+  }
+}
+
+void Session::scheduleHeartbeat() {
+  const auto idleAt = lastReadAt + constants::getAppMaxReadIdleTime();
+  const auto pingAt = lastPingAt + constants::getAppMaxWriteIdleTime();
+  internal::heartbeatWheel()->schedule(this, qMin(idleAt, pingAt), [this] { this->handleHeartbeat(); });
+}
+
+Session::Session(const QString &name, QObject *parent)
+    : QObject(parent), name(name), highWaterMark(constants::getAppSessionHighWaterMark()) {
+  connect(this, &Session::onBytesWritten, this, &Session::drain);
+}
+
+void Session::sendFrame(const QByteArray &frame) {
+  // the socket lives in the syncing thread
+  if (QThread::currentThread() != this->thread()) {
+    QMetaObject::invokeMethod(this, [this, frame] { this->sendFrame(frame); }, Qt::QueuedConnection);
+    return;
+  }
+
+  const auto type = packets::peekPacketType(frame);
+
+  const auto isSyncing = [](quint32 type) {
+    return type == packets::PacketType::SYNCING_PACKET || type == packets::PacketType::STAMPED_SYNCING_PACKET;
+  };
+
+  const auto isBulk = isSyncing(type)
+                   || type == packets::PacketType::STREAM_BEGIN_PACKET
+                   || type == packets::PacketType::STREAM_CHUNK_PACKET
+                   || type == packets::PacketType::STREAM_END_PACKET
+                   || type == packets::PacketType::DELTA_PACKET;
+
+  // a newer snapshot makes the queued ones stale
+  if (isSyncing(type)) {
+    const auto isStale = [&](const QByteArray &queued) {
+      if (!isSyncing(packets::peekPacketType(queued))) return false;
+      queuedBytes = queuedBytes - queued.size();
+      droppedFrames = droppedFrames + 1;
+      return true;
+    };
+
+    bulkQueue.removeIf(isStale);
+  }
+
+  (isBulk ? bulkQueue : controlQueue).enqueue(frame);
+  queuedBytes = queuedBytes + frame.size();
+
+  this->drain();
+}
+
+void Session::sendPacket(const packets::NetworkPacket &packet) {
+  this->sendFrame(packet.toBytes());
+}
+
+qint64 Session::bytesToWrite() const {
+  return queuedBytes + this->socketBytesToWrite();
+}
+
+void Session::setHighWaterMark(qint64 bytes) {
+  highWaterMark = bytes;
+  this->drain();
+}
+
+qint64 Session::getHighWaterMark() const {
+  return highWaterMark;
+}
+
+qsizetype Session::getQueueDepth() const {
+  return controlQueue.size() + bulkQueue.size();
+}
+
+quint64 Session::getDroppedFrames() const {
+  return droppedFrames;
+}
+
+void Session::startHeartbeat() {
+  lastReadAt   = lastPingAt = TimerWheel::now();
+  pingSentAt   = -1;
+  heartbeating = true;
+  this->scheduleHeartbeat();
+}
+
+void Session::stopHeartbeat() {
+  heartbeating = false;
+  internal::heartbeatWheel()->cancel(this);
+}
+
+void Session::markRead() {
+  lastReadAt = TimerWheel::now();
+}
+
+void Session::markPong() {
+  if (pingSentAt < 0) {
+    return;
+  }
+
+  roundTripTime = TimerWheel::now() - pingSentAt;
+  pingSentAt    = -1;
+
+  emit onRoundTripTimeChanged(roundTripTime);
+}
+
+qint64 Session::getRoundTripTime() const {
+  return roundTripTime;
+}
+
+bool Session::isProtocolNegotiated() const {
+  return false;
+}
+
+void Session::announceCapabilities() {
+  using utility::functions::params::CapabilityPacketParams;
+  using utility::functions::createPacket;
+
+  // announced once per connection
+  if (selfAnnounced) return;
+
+  selfAnnounced = true;
+  this->sendPacket(createPacket(CapabilityPacketParams{utility::functions::getSupportedEncodings()}));
+}
+
+void Session::setPeerEncodings(quint32 encodings) {
+  peerEncodings = encodings;
+  peerAnnounced = true;
+}
+
+bool Session::hasPeerCapabilities() const {
+  return peerAnnounced;
+}
+
+quint32 Session::getPeerEncodings() const {
+  return peerEncodings;
+}
+
 QString Session::getName() const {
   return name;
 }
 
+SessionInfo Session::getInfo() {
+  return SessionInfo{this, this->getName(), this->getCertificate(), this->isTrusted()};
+}
+
 bool Session::operator==(const Session &other) const {
   return name == other.name;
 }
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <QByteArray>
 #include <QFuture>
 #include <QObject>
+#include <QPointer>
+#include <QQueue>
 #include <QString>
 
 #include "packets/network_packet.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::syncing {
+struct SessionInfo;
+
 class Session : public QObject {
   Q_OBJECT
 
@@ -17,24 +22,139 @@ class Session : public QObject {
  private:
 
   QString name;
+  QQueue<QByteArray> controlQueue;
+  QQueue<QByteArray> bulkQueue;
+  qint64 queuedBytes    = 0;
+  qint64 highWaterMark;
+  quint64 droppedFrames = 0;
+  bool draining         = false;
+
+  // heartbeat state, in milliseconds of the monotonic clock
+  qint64 lastReadAt     = 0;
+  qint64 lastPingAt     = 0;
+  qint64 pingSentAt     = -1;
+  qint64 roundTripTime  = -1;
+  bool heartbeating     = false;
+
+  // encodings the peer announced it can decode
+  quint32 peerEncodings = 0;
+  bool peerAnnounced    = false;
+  bool selfAnnounced    = false;
+
+ private:
+
+  void drain();
+  void handleHeartbeat();
+  void scheduleHeartbeat();
+
+ protected:
+
+  virtual void writeFrame(const QByteArray &frame) = 0;
+  virtual qint64 socketBytesToWrite() const        = 0;
 
  public:
 
-  explicit Session(const QString &name, QObject *parent = nullptr) : QObject(parent), name(name) {}
+  explicit Session(const QString &name, QObject *parent = nullptr);
   virtual ~Session()                                            = default;
 
-  virtual void sendPacket(const packets::NetworkPacket &packet) = 0;
-  virtual void disconnectFromHost()                                     = 0;
+  virtual void disconnectFromHost()                             = 0;
   virtual bool isTrusted() const                                = 0;
   virtual QByteArray getCertificate() const                     = 0;
 
+  /**
+   * @brief Whether the transport negotiated the clipbird protocol, only
+   * then the peer tolerates a CapabilityPacket it was not sent one first
+   */
+  virtual bool isProtocolNegotiated() const;
+
+  /**
+   * @brief Queue the frame, control frames are written at once ahead
+   * of bulk frames, bulk frames are handed to the socket only while it
+   * holds less than the high water mark and a queued SyncingPacket is
+   * dropped when a newer one is queued
+   */
+  void sendFrame(const QByteArray &frame);
+  void sendPacket(const packets::NetworkPacket &packet);
+
+  /**
+   * @brief Bytes queued in the session and in the socket
+   */
+  qint64 bytesToWrite() const;
+
+  void setHighWaterMark(qint64 bytes);
+  qint64 getHighWaterMark() const;
+  qsizetype getQueueDepth() const;
+  quint64 getDroppedFrames() const;
+
+  /**
+   * @brief Ping the peer every write idle interval and disconnect once
+   * nothing was read for the read idle time, every session of the
+   * thread is driven by one timer wheel
+   */
+  void startHeartbeat();
+  void stopHeartbeat();
+
+  /**
+   * @brief Note that the peer sent something, the idle deadline is
+   * only checked when it fires so this stays cheap
+   */
+  void markRead();
+
+  /**
+   * @brief Note the pong of the last ping
+   */
+  void markPong();
+
+  /**
+   * @brief Round trip time of the last ping in milliseconds or -1
+   */
+  qint64 getRoundTripTime() const;
+
+  /**
+   * @brief Announce the encodings this host can decode, sent once per
+   * connection when the protocol was negotiated or in reply to the
+   * peer's announcement, until the peer announces its own every item
+   * is sent in the legacy SyncingPacket
+   */
+  void announceCapabilities();
+
+  void setPeerEncodings(quint32 encodings);
+  quint32 getPeerEncodings() const;
+
+  /**
+   * @brief Whether the peer announced its capabilities, only then it is
+   * sent stamped, streamed and offered items, a peer that never does is
+   * sent the legacy SyncingPacket
+   */
+  bool hasPeerCapabilities() const;
+
   QString getName() const;
 
+  /**
+   * @brief Snapshot of the session for other threads, must be taken on
+   * the thread the session lives in
+   */
+  SessionInfo getInfo();
+
   bool operator==(const Session &other) const;
   bool operator!=(const Session &other) const;
 
  signals:
   void onTrustedStateChanged(bool isTrusted);
+  void onBytesWritten(qint64 bytes);
+  void onRoundTripTimeChanged(qint64 milliseconds);
+};
+
+/**
+ * @brief Values of a session handed to the GUI thread so it never calls
+ * into a session living in the syncing thread, the pointer is only a
+ * handle to pass back to the SyncingManager
+ */
+struct SessionInfo {
+  QPointer<Session> session;
+  QString name;
+  QByteArray certificate;
+  bool trusted = false;
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing
 
@@ -0,0 +1,173 @@
+#include "stream_receiver.hpp"
+
+#include <algorithm>
+
+#include "constants/constants.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+#include "utility/functions/compression/compression.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+using common::types::exceptions::MalformedPacket;
+using common::types::enums::ErrorCode;
+
+void StreamReceiver::reset() {
+  for (auto& item : items) {
+    delete item.spool;
+  }
+
+  transferId.reset();
+  items.clear();
+  totalLength    = 0;
+  receivedLength = 0;
+  memoryLength   = 0;
+}
+
+QByteArray StreamReceiver::readSpool(Item& item) {
+  // the spool holds decoded bytes so it is read straight into the result,
+  // the whole item is in memory from here on
+  QByteArray payload(qsizetype(item.totalLength), Qt::Uninitialized);
+  qsizetype offset = 0;
+
+  item.spool->seek(0);
+
+  while (offset < payload.size()) {
+    const auto length = std::min<qsizetype>(payload.size() - offset, constants::getAppStreamChunkSize());
+    const auto read   = item.spool->read(payload.data() + offset, length);
+
+    if (read <= 0) {
+      throw std::runtime_error("Unable to read the stream spool file");
+    }
+
+    offset += read;
+  }
+
+  return payload;
+}
+
+StreamReceiver::StreamReceiver(QObject* parent) : QObject(parent) {}
+
+StreamReceiver::~StreamReceiver() {
+  this->reset();
+}
+
+void StreamReceiver::handleBeginPacket(const packets::StreamBeginPacket& packet) {
+  // a new transfer replaces the one in progress
+  if (transferId != packet.getTransferId()) {
+    this->reset();
+    transferId = packet.getTransferId();
+  }
+
+  if (packet.getItemId() != quint32(items.size())) {
+    throw MalformedPacket(ErrorCode::InvalidPacket, "StreamBeginPacket");
+  }
+
+  if (!items.isEmpty() && items.last().receivedLength != items.last().totalLength) {
+    throw MalformedPacket(ErrorCode::InvalidPacket, "StreamBeginPacket");
+  }
+
+  Item item{QString::fromUtf8(packet.getMimeType()), packet.getEncoding(), packet.getTotalLength()};
+
+  if (memoryLength + item.totalLength > quint64(constants::getAppStreamSpoolThreshold())) {
+    item.spool = new QTemporaryFile(this);
+    if (!item.spool->open()) {
+      delete item.spool;
+      throw std::runtime_error("Unable to open the stream spool file");
+    }
+  } else {
+    item.memory.reserve(qsizetype(item.totalLength));
+    memoryLength += item.totalLength;
+  }
+
+  items.append(item);
+  totalLength += item.totalLength;
+
+  emit progress(transferId.value(), receivedLength, totalLength);
+}
+
+void StreamReceiver::handleChunkPacket(const packets::StreamChunkPacket& packet) {
+  // chunk of a transfer that was replaced
+  if (transferId != packet.getTransferId()) {
+    return;
+  }
+
+  if (items.isEmpty() || packet.getItemId() != quint32(items.size() - 1)) {
+    throw MalformedPacket(ErrorCode::InvalidPacket, "StreamChunkPacket");
+  }
+
+  auto& item = items.last();
+
+  if (packet.getOffset() != item.receivedLength) {
+    throw MalformedPacket(ErrorCode::InvalidPacket, "StreamChunkPacket");
+  }
+
+  // every chunk is encoded on its own and may not decode past the item
+  const auto remaining = qsizetype(std::min<quint64>(item.totalLength - item.receivedLength, constants::getAppMaxDecodedLength()));
+  const auto payload   = utility::functions::decodePayload(item.encoding, packet.getPayload(), remaining);
+  const auto length    = quint64(payload.size());
+
+  if (length > item.totalLength - item.receivedLength) {
+    throw MalformedPacket(ErrorCode::InvalidPacket, "StreamChunkPacket");
+  }
+
+  if (item.spool != nullptr) {
+    if (item.spool->write(payload) != payload.size()) {
+      throw std::runtime_error("Unable to write the stream spool file");
+    }
+  } else {
+    item.memory.append(payload);
+  }
+
+  item.receivedLength += length;
+  receivedLength      += length;
+
+  emit progress(transferId.value(), receivedLength, totalLength);
+}
+
+void StreamReceiver::handleEndPacket(const packets::StreamEndPacket& packet) {
+  // end of a transfer that was replaced
+  if (transferId != packet.getTransferId()) {
+    return;
+  }
+
+  const auto isComplete = [](const Item& item) {
+    return item.receivedLength == item.totalLength;
+  };
+
+  if (packet.getItemCount() != quint32(items.size()) || !std::all_of(items.cbegin(), items.cend(), isComplete)) {
+    this->reset();
+    throw MalformedPacket(ErrorCode::InvalidPacket, "StreamEndPacket");
+  }
+
+  QVector<QPair<QString, QByteArray>> result;
+  result.reserve(items.size());
+
+  try {
+    for (auto& item : items) {
+      if (item.spool != nullptr) {
+        result.append(qMakePair(item.mimeType, readSpool(item)));
+      } else {
+        result.append(qMakePair(item.mimeType, item.memory));
+      }
+    }
+  } catch (const std::exception&) {
+    this->reset();
+    throw;
+  }
+
+  const auto id = transferId.value();
+  this->reset();
+
+  emit completed(id, packet.getOriginId(), packet.getSequence(), result);
+}
+
+quint64 StreamReceiver::bufferedBytes() const noexcept {
+  quint64 bytes = 0;
+
+  for (const auto& item : items) {
+    bytes += quint64(item.memory.size());
+  }
+
+  return bytes;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <QByteArray>
+#include <QObject>
+#include <QPair>
+#include <QString>
+#include <QTemporaryFile>
+#include <QUuid>
+#include <QVector>
+
+#include <optional>
+
+#include "packets/streamingpacket/streamingpacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Assembles the streamed items from one peer, chunks must arrive
+ * in order and are decoded as they arrive, once the items in memory reach
+ * the spool threshold the rest are written to temporary files so memory
+ * stays bounded while the transfer is in progress, only the latest
+ * transfer is kept
+ *
+ * The spool does not bound memory at completion, the items are handed on
+ * as byte arrays since the history and the clipboard take them whole, so
+ * each spooled item is read back into one buffer of its full size
+ */
+class StreamReceiver : public QObject {
+  Q_OBJECT
+
+ private:
+  Q_DISABLE_COPY_MOVE(StreamReceiver)
+
+ private:
+  struct Item {
+    QString mimeType;
+    quint32 encoding;
+    quint64 totalLength;
+    quint64 receivedLength = 0;
+    QByteArray memory;
+    QTemporaryFile* spool = nullptr;
+  };
+
+ private:
+  std::optional<quint32> transferId;
+  QVector<Item> items;
+  quint64 totalLength    = 0;
+  quint64 receivedLength = 0;
+  quint64 memoryLength   = 0;
+
+ private:
+  void reset();
+  QByteArray readSpool(Item& item);
+
+ public:
+  explicit StreamReceiver(QObject* parent = nullptr);
+  virtual ~StreamReceiver();
+
+  void handleBeginPacket(const packets::StreamBeginPacket& packet);
+  void handleChunkPacket(const packets::StreamChunkPacket& packet);
+  void handleEndPacket(const packets::StreamEndPacket& packet);
+
+  /**
+   * @brief Bytes of the current transfer held in memory
+   */
+  quint64 bufferedBytes() const noexcept;
+
+ signals:
+  void progress(quint32 transferId, quint64 received, quint64 total);
+  void completed(quint32 transferId, QUuid originId, quint64 sequence, QVector<QPair<QString, QByteArray>> items);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
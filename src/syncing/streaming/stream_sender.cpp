@@ -0,0 +1,134 @@
+#include "stream_sender.hpp"
+
+#include "common/types/enums/enums.hpp"
+#include "constants/constants.hpp"
+#include "utility/functions/compression/compression.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+void StreamSender::sendNext() {
+  using namespace utility::functions::params;
+  using utility::functions::createPacket;
+
+  // every item is sent so close the transfer
+  if (current == items.size()) {
+    session->sendPacket(createPacket(StreamEndParams{transferId, quint32(items.size()), originId, sequence}));
+    done = true;
+    emit finished(transferId);
+    return;
+  }
+
+  const auto& item = items.at(current);
+
+  if (!begun) {
+    session->sendPacket(createPacket(StreamBeginParams{transferId, quint32(current), quint64(item.source->size()), item.mimeType, item.encoding}));
+    begun = true;
+  } else {
+    const auto offset  = quint64(item.source->pos());
+    const auto chunk   = item.source->read(constants::getAppStreamChunkSize());
+    const auto payload = item.encoding == common::types::enums::Encoding::Deflate ? qCompress(chunk, 1) : chunk;
+    session->sendPacket(createPacket(StreamChunkParams{transferId, quint32(current), offset, payload}));
+    sentLength += chunk.size();
+    emit progress(transferId, sentLength, totalLength);
+  }
+
+  // move to the next item once the source is drained
+  if (item.source->atEnd()) {
+    current = current + 1;
+    begun   = false;
+  }
+}
+
+void StreamSender::pump() {
+  const auto window = constants::getAppStreamWindowSize();
+
+  while (!done && session->bytesToWrite() < window) {
+    this->sendNext();
+  }
+}
+
+StreamSender::StreamSender(
+  Session* session,
+  quint32 transferId,
+  const QUuid& originId,
+  quint64 sequence,
+  const QVector<QPair<QString, QByteArray>>& items,
+  QObject* parent
+) : QObject(parent), session(session), transferId(transferId), originId(originId), sequence(sequence) {
+  this->items.reserve(items.size());
+
+  for (const auto& [mimeType, payload] : items) {
+    const auto encoding = utility::functions::chooseEncoding(mimeType, payload.size(), session->getPeerEncodings());
+
+    // the buffer shares the payload, chunks are compressed as they are sent
+    auto* source = new QBuffer(this);
+    source->setData(payload);
+    source->open(QIODevice::ReadOnly);
+    this->items.append(Item{mimeType, encoding, source});
+    this->totalLength += payload.size();
+  }
+
+  QObject::connect(
+    this->session,
+    &Session::onBytesWritten,
+    this,
+    &StreamSender::pump
+  );
+}
+
+StreamSender::~StreamSender() {
+  // Nothing to do here
+}
+
+bool StreamSender::isStreamable(const QVector<QPair<QString, QByteArray>>& items) {
+  qint64 length = 0;
+
+  for (const auto& [mimeType, payload] : items) {
+    length += payload.size();
+  }
+
+  return length > constants::getAppStreamThreshold();
+}
+
+StreamSender* StreamSender::send(Session* session, quint32 transferId, const QUuid& originId, quint64 sequence, const QVector<QPair<QString, QByteArray>>& items) {
+  for (auto* previous : session->findChildren<StreamSender*>(Qt::FindDirectChildrenOnly)) {
+    if (!previous->isFinished()) previous->cancel();
+  }
+
+  auto* sender = new StreamSender(session, transferId, originId, sequence, items, session);
+
+  QObject::connect(
+    sender,
+    &StreamSender::finished,
+    sender,
+    &QObject::deleteLater
+  );
+
+  // start on the next event loop turn so the caller can connect first
+  QMetaObject::invokeMethod(sender, &StreamSender::pump, Qt::QueuedConnection);
+
+  return sender;
+}
+
+void StreamSender::cancel() {
+  QObject::disconnect(this->session, nullptr, this, nullptr);
+  this->done = true;
+  this->deleteLater();
+}
+
+quint32 StreamSender::getTransferId() const noexcept {
+  return transferId;
+}
+
+quint64 StreamSender::getTotalLength() const noexcept {
+  return totalLength;
+}
+
+quint64 StreamSender::getSentLength() const noexcept {
+  return sentLength;
+}
+
+bool StreamSender::isFinished() const noexcept {
+  return done;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
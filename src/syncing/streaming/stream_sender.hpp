@@ -0,0 +1,86 @@
+#pragma once
+
+#include <QBuffer>
+#include <QObject>
+#include <QPair>
+#include <QString>
+#include <QUuid>
+#include <QVector>
+
+#include "syncing/session.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Sends clipboard items to a session as a stream of bounded
+ * chunks, the next chunk is read from the source only when the socket
+ * has drained below the window so no frame of the whole item is built,
+ * with deflate every chunk is compressed on its own as it is read so no
+ * compressed copy of the whole item is made
+ */
+class StreamSender : public QObject {
+  Q_OBJECT
+
+ private:
+  Q_DISABLE_COPY_MOVE(StreamSender)
+
+ private:
+  struct Item {
+    QString mimeType;
+    quint32 encoding;
+    QIODevice* source;
+  };
+
+ private:
+  Session* session;
+  quint32 transferId;
+  QUuid originId;
+  quint64 sequence;
+  QVector<Item> items;
+  qsizetype current   = 0;
+  bool begun          = false;
+  bool done           = false;
+  quint64 totalLength = 0;
+  quint64 sentLength  = 0;
+
+ private:
+  void sendNext();
+  void pump();
+
+ public:
+  StreamSender(
+    Session* session,
+    quint32 transferId,
+    const QUuid& originId,
+    quint64 sequence,
+    const QVector<QPair<QString, QByteArray>>& items,
+    QObject* parent = nullptr
+  );
+
+  virtual ~StreamSender();
+
+  /**
+   * @brief Check whether the items are large enough to be streamed
+   * instead of being sent as one SyncingPacket
+   */
+  static bool isStreamable(const QVector<QPair<QString, QByteArray>>& items);
+
+  /**
+   * @brief Start streaming the items to the session, any stream still
+   * running on the session is cancelled since the receiver keeps only
+   * the latest transfer, the sender deletes itself once finished, the
+   * origin and sequence of the items are sent with the end of the stream
+   */
+  static StreamSender* send(Session* session, quint32 transferId, const QUuid& originId, quint64 sequence, const QVector<QPair<QString, QByteArray>>& items);
+
+  void cancel();
+
+  quint32 getTransferId() const noexcept;
+  quint64 getTotalLength() const noexcept;
+  quint64 getSentLength() const noexcept;
+  bool isFinished() const noexcept;
+
+ signals:
+  void progress(quint32 transferId, quint64 sent, quint64 total);
+  void finished(quint32 transferId);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
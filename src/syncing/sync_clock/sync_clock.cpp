@@ -0,0 +1,48 @@
+#include "sync_clock.hpp"
+
+#include <QDateTime>
+
+#include <algorithm>
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+SyncClock::SyncClock(const QUuid& origin) : origin(origin) {}
+
+QUuid SyncClock::getOrigin() const noexcept {
+  return origin;
+}
+
+quint64 SyncClock::next() {
+  QMutexLocker locker(&lock);
+  clock   = std::max(clock + 1, physicalTime());
+  applied = qMakePair(clock, origin);
+  return clock;
+}
+
+bool SyncClock::accept(const QUuid& origin, quint64 sequence) {
+  QMutexLocker locker(&lock);
+
+  // own update coming back through a peer
+  if (origin == this->origin) {
+    return false;
+  }
+
+  // duplicate or older than what is already applied, the origin
+  // breaks the tie of equal sequences from different devices
+  if (!(applied < qMakePair(sequence, origin))) {
+    return false;
+  }
+
+  clock   = std::max(clock, sequence);
+  applied = qMakePair(sequence, origin);
+  return true;
+}
+
+bool SyncClock::isLatest(const QUuid& origin, quint64 sequence) const {
+  QMutexLocker locker(&lock);
+  return applied == qMakePair(sequence, origin);
+}
+
+quint64 SyncClock::physicalTime() {
+  return quint64(QDateTime::currentMSecsSinceEpoch()) << 16;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <QMutex>
+#include <QPair>
+#include <QUuid>
+#include <QtTypes>
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Hybrid logical clock that stamps every clipboard update with
+ * the id of the device it came from and a sequence, the sequence is the
+ * wall clock in milliseconds shifted left by 16 bits plus a counter so
+ * it keeps increasing on a device and orders updates across devices,
+ * an update is applied only if it is newer than the last one applied
+ * which drops echoes, duplicates and updates delivered out of order
+ */
+class SyncClock {
+ private:
+  Q_DISABLE_COPY_MOVE(SyncClock)
+
+ private:
+  mutable QMutex lock;
+  QUuid origin;
+  quint64 clock = 0;
+  QPair<quint64, QUuid> applied;
+
+ public:
+  explicit SyncClock(const QUuid& origin);
+  ~SyncClock() = default;
+
+  /**
+   * @brief Id of this device
+   */
+  QUuid getOrigin() const noexcept;
+
+  /**
+   * @brief Sequence for an update made on this device, the update
+   * becomes the latest one applied
+   */
+  quint64 next();
+
+  /**
+   * @brief Check whether an update from the origin should be applied,
+   * updates of this device and updates not newer than the last applied
+   * are rejected, an accepted update becomes the latest one applied
+   */
+  bool accept(const QUuid& origin, quint64 sequence);
+
+  /**
+   * @brief Check whether the update is still the latest one applied
+   */
+  bool isLatest(const QUuid& origin, quint64 sequence) const;
+
+  /**
+   * @brief Wall clock part of the sequence
+   */
+  static quint64 physicalTime();
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -0,0 +1,11 @@
+#include "sync_clock_factory.hpp"
+
+#include "application_factory.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+Q_GLOBAL_STATIC_WITH_ARGS(SyncClock, syncClockInstance, (ApplicationFactory::getApplicationState()->getDeviceId()))
+
+SyncClock* SyncClockFactory::getSyncClock() {
+  return syncClockInstance;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "syncing/sync_clock/sync_clock.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+struct SyncClockFactory {
+  static SyncClock* getSyncClock();
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
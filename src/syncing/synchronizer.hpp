@@ -41,8 +41,9 @@ class Synchronizer : public QObject {
  signals:
 
   /**
-   * @brief  On Sync Request
+   * @brief  On Sync Request, the fingerprint is taken once on receive
+   * and carried with the items
    */
-  void OnSyncRequest(QVector<QPair<QString, QByteArray>> items);
+  void OnSyncRequest(QVector<QPair<QString, QByteArray>> items, quint64 fingerprint);
 };
 }  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -0,0 +1,129 @@
+#include "timer_wheel.hpp"
+
+#include <QDeadlineTimer>
+#include <QVector>
+
+#include <utility>
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+void TimerWheel::place(QObject* owner, Entry& entry) {
+  const auto span = qint64(1) << (wheelBits * wheelLevels);
+  const auto tick = qMin(entry.tick, currentTick + span - 1);
+  const auto diff = tick - currentTick;
+
+  int level = 0;
+
+  while (level < wheelLevels - 1 && diff >= (qint64(1) << (wheelBits * (level + 1)))) {
+    level = level + 1;
+  }
+
+  entry.level = level;
+  entry.slot  = int((tick >> (wheelBits * level)) & (wheelSlots - 1));
+  wheel[entry.level][entry.slot].insert(owner);
+}
+
+void TimerWheel::cascade(int level) {
+  const auto slot   = int((currentTick >> (wheelBits * level)) & (wheelSlots - 1));
+  const auto owners = std::exchange(wheel[level][slot], {});
+
+  for (auto* owner : owners) {
+    this->place(owner, entries[owner]);
+  }
+}
+
+void TimerWheel::tick() {
+  currentTick = currentTick + 1;
+
+  // move the entries of the higher levels down as their turn comes
+  for (int level = wheelLevels - 1; level > 0; --level) {
+    if ((currentTick & ((qint64(1) << (wheelBits * level)) - 1)) == 0) {
+      this->cascade(level);
+    }
+  }
+
+  const auto slot   = int(currentTick & (wheelSlots - 1));
+  const auto owners = std::exchange(wheel[0][slot], {});
+
+  QVector<Callback> due;
+
+  for (auto* owner : owners) {
+    due.append(entries.take(owner).callback);
+  }
+
+  // callbacks may schedule again so run them after the wheel is updated
+  for (const auto& callback : due) {
+    callback();
+  }
+}
+
+TimerWheel::TimerWheel(qint64 tickLength, QObject* parent)
+    : QObject(parent), tickLength(tickLength), origin(now()) {
+  timer->setInterval(int(tickLength));
+  timer->setTimerType(Qt::CoarseTimer);
+  connect(timer, &QTimer::timeout, this, [this] { this->advance(now()); });
+}
+
+TimerWheel::~TimerWheel() {
+  // Nothing to do here
+}
+
+qint64 TimerWheel::now() {
+  return QDeadlineTimer::current().deadline();
+}
+
+void TimerWheel::schedule(QObject* owner, qint64 deadline, Callback callback) {
+  this->cancel(owner);
+
+  if (!watched.contains(owner)) {
+    watched.insert(owner);
+    connect(owner, &QObject::destroyed, this, [this, owner] {
+      this->watched.remove(owner);
+      this->cancel(owner);
+    });
+  }
+
+  // round up so an entry never fires before its deadline
+  const auto tick = (deadline - origin + tickLength - 1) / tickLength;
+
+  Entry entry{qMax(tick, currentTick + 1), 0, 0, std::move(callback)};
+  this->place(owner, entry);
+  entries.insert(owner, std::move(entry));
+
+  if (!timer->isActive()) {
+    timer->start();
+  }
+}
+
+void TimerWheel::cancel(QObject* owner) {
+  const auto itr = entries.constFind(owner);
+
+  if (itr == entries.cend()) {
+    return;
+  }
+
+  wheel[itr->level][itr->slot].remove(owner);
+  entries.erase(itr);
+}
+
+bool TimerWheel::isScheduled(QObject* owner) const {
+  return entries.contains(owner);
+}
+
+qsizetype TimerWheel::size() const {
+  return entries.size();
+}
+
+void TimerWheel::advance(qint64 now) {
+  const auto target = (now - origin) / tickLength;
+
+  while (currentTick < target && !entries.isEmpty()) {
+    this->tick();
+  }
+
+  // nothing is pending so skip the idle ticks at once
+  if (entries.isEmpty()) {
+    currentTick = qMax(currentTick, target);
+    timer->stop();
+  }
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
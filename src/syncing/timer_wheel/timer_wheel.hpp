@@ -0,0 +1,76 @@
+#pragma once
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QTimer>
+
+#include <functional>
+
+namespace srilakshmikanthanp::clipbirdesk::syncing {
+/**
+ * @brief Hierarchical timer wheel, one QTimer ticks for every scheduled
+ * owner, each owner has at most one deadline and scheduling again
+ * replaces it, level 0 resolves single ticks and each higher level
+ * covers 64 times the span of the level below, deadlines are in
+ * milliseconds of the monotonic clock returned by now()
+ */
+class TimerWheel : public QObject {
+ public:
+  using Callback = std::function<void()>;
+
+ private:
+  Q_DISABLE_COPY_MOVE(TimerWheel)
+
+ private:
+  static constexpr int wheelBits   = 6;
+  static constexpr int wheelSlots  = 1 << wheelBits;
+  static constexpr int wheelLevels = 3;
+
+  struct Entry {
+    qint64 tick;
+    int level;
+    int slot;
+    Callback callback;
+  };
+
+ private:
+  qint64 tickLength;
+  qint64 origin;
+  qint64 currentTick = 0;
+  QHash<QObject*, Entry> entries;
+  QSet<QObject*> watched;
+  QSet<QObject*> wheel[wheelLevels][wheelSlots];
+  QTimer* timer = new QTimer(this);
+
+ private:
+  void place(QObject* owner, Entry& entry);
+  void cascade(int level);
+  void tick();
+
+ public:
+  explicit TimerWheel(qint64 tickLength, QObject* parent = nullptr);
+  virtual ~TimerWheel();
+
+  /**
+   * @brief Milliseconds of the monotonic clock
+   */
+  static qint64 now();
+
+  /**
+   * @brief Run the callback once the deadline has passed, the entry
+   * is removed when the owner is destroyed
+   */
+  void schedule(QObject* owner, qint64 deadline, Callback callback);
+
+  void cancel(QObject* owner);
+  bool isScheduled(QObject* owner) const;
+  qsizetype size() const;
+
+  /**
+   * @brief Fire every entry due by the given time, driven by the timer
+   * with now() but can be called directly
+   */
+  void advance(qint64 now);
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing
@@ -32,7 +32,7 @@ void ClipbirdQmlApplicationClipboard::setClipboard(const QVariantList& items) {
     clipboardData.append(qMakePair(mimeType, data));
   }
 
-  m_applicationClipboard->set(clipboardData);
+  m_applicationClipboard->set(clipboardData, utility::functions::contentFingerprint(clipboardData));
 }
 
 QVariantList ClipbirdQmlApplicationClipboard::getClipboard() const {
@@ -1,34 +1,92 @@
 #include "clipbird_qml_history.hpp"
 
 #include "ui/gui/binding/clipboard/clipbird_qml_application_clipboard.hpp"
+#include "ui/gui/binding/image/clipbird_qml_image_provider.hpp"
 #include "history/clipboard_history_factory.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
-QVariantList ClipbirdQmlHistory::toQVariantList(const QVector<QVector<QPair<QString, QByteArray>>>& history) const {
-  QVariantList result;
-  for (const auto& items : history) {
-    QVariantList itemList;
-    for (const auto& [mimeType, data] : items) {
-      QVariantMap itemMap;
-      itemMap[ClipbirdQmlApplicationClipboard::MIME_DATA_KEY] = mimeType;
-      itemMap[ClipbirdQmlApplicationClipboard::DATA_KEY] = data;
-      itemList.append(itemMap);
+/**
+ * @brief Summaries kept for the rows that were shown last
+ */
+constexpr int maxSummaries = 256;
+
+/**
+ * @brief Bytes of text decoded for the preview
+ */
+constexpr qsizetype maxPreviewLength = 1024;
+
+ClipbirdQmlHistory::Summary* ClipbirdQmlHistory::summaryOf(const history::HistoryEntry& entry) const {
+  if (auto summary = m_summaries.object(entry.id)) {
+    return summary;
+  }
+
+  auto summary = new Summary();
+
+  // only the item headers and the start of the text are read
+  const auto items = m_clipboardHistory->getSummary(entry.id, maxPreviewLength);
+
+  for (const auto& item : items) {
+    summary->size += item.length;
+
+    if (item.mimeType.startsWith("image/") && summary->thumbnailUrl.isEmpty()) {
+      summary->mimeType     = item.mimeType;
+      summary->thumbnailUrl = ClipbirdQmlImageProvider::historyImageUrl(entry);
+    }
+
+    if (item.mimeType == "text/plain" && summary->previewText.isEmpty()) {
+      summary->previewText = QString::fromUtf8(item.head);
     }
-    result.append(QVariant::fromValue(itemList));
   }
-  return result;
+
+  if (summary->mimeType.isEmpty() && !summary->previewText.isEmpty()) {
+    summary->mimeType = "text/plain";
+  }
+
+  if (summary->mimeType.isEmpty() && !items.isEmpty()) {
+    summary->mimeType = items.first().mimeType;
+  }
+
+  m_summaries.insert(entry.id, summary);
+
+  return summary;
+}
+
+void ClipbirdQmlHistory::handleHistoryInserted(int index, history::HistoryEntry entry) {
+  beginInsertRows(QModelIndex(), index, index);
+  m_entries.insert(index, entry);
+  endInsertRows();
+  emit countChanged(rowCount());
 }
 
-void ClipbirdQmlHistory::handleHistoryChanged(QVector<QVector<QPair<QString, QByteArray>>> history) {
-  emit historyChanged(toQVariantList(history));
+void ClipbirdQmlHistory::handleHistoryRemoved(int index) {
+  if (index < 0 || index >= m_entries.size()) {
+    return;
+  }
+
+  // thumbnails of the removed entry are not shown again
+  ClipbirdQmlImageProvider::evict(m_entries[index].fingerprint);
+
+  beginRemoveRows(QModelIndex(), index, index);
+  m_summaries.remove(m_entries[index].id);
+  m_entries.remove(index);
+  endRemoveRows();
+  emit countChanged(rowCount());
 }
 
-ClipbirdQmlHistory::ClipbirdQmlHistory(history::ClipboardHistory* clipboardHistory, QObject* parent): QObject(parent), m_clipboardHistory(clipboardHistory) {
+ClipbirdQmlHistory::ClipbirdQmlHistory(history::ClipboardHistory* clipboardHistory, QObject* parent)
+    : QAbstractListModel(parent), m_clipboardHistory(clipboardHistory), m_entries(clipboardHistory->getEntries()), m_summaries(maxSummaries) {
   connect(
     m_clipboardHistory,
-    &history::ClipboardHistory::OnHistoryChanged,
+    &history::ClipboardHistory::OnHistoryInserted,
     this,
-    &ClipbirdQmlHistory::handleHistoryChanged
+    &ClipbirdQmlHistory::handleHistoryInserted
+  );
+
+  connect(
+    m_clipboardHistory,
+    &history::ClipboardHistory::OnHistoryRemoved,
+    this,
+    &ClipbirdQmlHistory::handleHistoryRemoved
   );
 }
 
@@ -41,8 +99,68 @@ ClipbirdQmlHistory* ClipbirdQmlHistory::create(QQmlEngine* engine, QJSEngine* sc
   return instance;
 }
 
-QVariantList ClipbirdQmlHistory::getHistory() const {
-  return toQVariantList(m_clipboardHistory->getHistory());
+int ClipbirdQmlHistory::rowCount(const QModelIndex& parent) const {
+  return parent.isValid() ? 0 : int(m_entries.size());
+}
+
+QVariant ClipbirdQmlHistory::data(const QModelIndex& index, int role) const {
+  if (!index.isValid() || index.row() >= m_entries.size()) {
+    return QVariant();
+  }
+
+  const auto& entry = m_entries[index.row()];
+
+  if (role == TimestampRole) {
+    return entry.timestamp;
+  }
+
+  if (role == EntryIdRole) {
+    return entry.id;
+  }
+
+  // summaries are read only for the rows a delegate asks for
+  const auto summary = summaryOf(entry);
+
+  switch (role) {
+    case MimeTypeRole:
+      return summary->mimeType;
+    case SizeRole:
+      return summary->size;
+    case PreviewTextRole:
+      return summary->previewText;
+    case ThumbnailUrlRole:
+      return summary->thumbnailUrl;
+    default:
+      return QVariant();
+  }
+}
+
+QHash<int, QByteArray> ClipbirdQmlHistory::roleNames() const {
+  return {
+    {MimeTypeRole, "mimeType"},
+    {SizeRole, "size"},
+    {PreviewTextRole, "previewText"},
+    {ThumbnailUrlRole, "thumbnailUrl"},
+    {TimestampRole, "timestamp"},
+    {EntryIdRole, "entryId"},
+  };
+}
+
+QVariantList ClipbirdQmlHistory::getHistoryAt(int index) const {
+  QVariantList result;
+
+  if (index < 0 || index >= m_entries.size()) {
+    return result;
+  }
+
+  for (const auto& [mimeType, data] : m_clipboardHistory->getItems(m_entries[index].id)) {
+    QVariantMap itemMap;
+    itemMap[ClipbirdQmlApplicationClipboard::MIME_DATA_KEY] = mimeType;
+    itemMap[ClipbirdQmlApplicationClipboard::DATA_KEY] = data;
+    result.append(itemMap);
+  }
+
+  return result;
 }
 
 void ClipbirdQmlHistory::deleteHistoryAt(int index) {
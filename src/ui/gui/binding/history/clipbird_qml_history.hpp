@@ -1,6 +1,9 @@
 #pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
 
 // Qt headers
+#include <QAbstractListModel>
+#include <QCache>
+#include <QHash>
 #include <QObject>
 #include <QString>
 #include <QVariantList>
@@ -15,26 +18,52 @@ namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
 
 /**
  * @brief QML binding for ClipboardHistory that exposes history functionality to QML
- * This wraps the ClipboardHistory and makes it accessible from QML as a singleton
+ * This wraps the ClipboardHistory as a list model, only the metadata of the entries
+ * is held, when a row is shown the item types and lengths and the start of the
+ * text are read from the history, full payloads only when an entry is copied
  */
-class ClipbirdQmlHistory : public QObject {
+class ClipbirdQmlHistory : public QAbstractListModel {
   Q_OBJECT
   QML_ELEMENT
   QML_SINGLETON
 
-  Q_PROPERTY(QVariantList history READ getHistory NOTIFY historyChanged)
+  Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+ public:
+  enum Roles {
+    MimeTypeRole = Qt::UserRole + 1,
+    SizeRole,
+    PreviewTextRole,
+    ThumbnailUrlRole,
+    TimestampRole,
+    EntryIdRole,
+  };
+
+ private:
+  /**
+   * @brief What a delegate shows of an entry, read once per entry
+   */
+  struct Summary {
+    QString mimeType;
+    qint64 size = 0;
+    QString previewText;
+    QString thumbnailUrl;
+  };
 
  private:
   history::ClipboardHistory* m_clipboardHistory = nullptr;
+  QVector<history::HistoryEntry> m_entries;
+  mutable QCache<quint64, Summary> m_summaries;
 
  private:
-  QVariantList toQVariantList(const QVector<QVector<QPair<QString, QByteArray>>>& history) const;
+  Summary* summaryOf(const history::HistoryEntry& entry) const;
 
  private:
-  void handleHistoryChanged(QVector<QVector<QPair<QString, QByteArray>>> history);
+  void handleHistoryInserted(int index, history::HistoryEntry entry);
+  void handleHistoryRemoved(int index);
 
  signals:
-  void historyChanged(QVariantList);
+  void countChanged(int);
 
  public:
   /**
@@ -50,11 +79,27 @@ class ClipbirdQmlHistory : public QObject {
   virtual ~ClipbirdQmlHistory();
 
   /**
-   * @brief Get clipboard history as QVariantList
-   * Each item is a QVariantList containing QVariantMaps with "mimeType" and "data" keys
-   * @return QVariantList History items
+   * @brief Number of history entries
+   */
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  /**
+   * @brief Role of the entry at the row
+   */
+  QVariant data(const QModelIndex& index, int role) const override;
+
+  /**
+   * @brief Names of the roles used by the delegates
+   */
+  QHash<int, QByteArray> roleNames() const override;
+
+  /**
+   * @brief Get the full payloads of the history entry at the row
+   * Each item is a QVariantMap with "mimeType" and "data" keys
+   * @param index Row of the entry
+   * @return QVariantList Items of the entry
    */
-  Q_INVOKABLE QVariantList getHistory() const;
+  Q_INVOKABLE QVariantList getHistoryAt(int index) const;
 
   /**
    * @brief Delete history item at specified index
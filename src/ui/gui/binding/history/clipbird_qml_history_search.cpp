@@ -0,0 +1,94 @@
+#include "clipbird_qml_history_search.hpp"
+
+#include "history/clipboard_history_factory.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
+void ClipbirdQmlHistorySearch::refresh() {
+  m_matches.clear();
+
+  if (!m_query.isEmpty()) {
+    const auto match = m_prefix ? history::SearchIndex::Match::Prefix : history::SearchIndex::Match::Substring;
+    const auto ids   = m_clipboardHistory->search(m_query, match);
+    m_matches        = QSet<quint64>(ids.cbegin(), ids.cend());
+  }
+
+  invalidateFilter();
+}
+
+bool ClipbirdQmlHistorySearch::filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const {
+  if (m_query.isEmpty()) {
+    return true;
+  }
+
+  const auto index = sourceModel()->index(sourceRow, 0, sourceParent);
+  return m_matches.contains(index.data(ClipbirdQmlHistory::EntryIdRole).toULongLong());
+}
+
+ClipbirdQmlHistorySearch::ClipbirdQmlHistorySearch(history::ClipboardHistory* clipboardHistory, ClipbirdQmlHistory* history, QObject* parent)
+    : QSortFilterProxyModel(parent), m_clipboardHistory(clipboardHistory), m_history(history) {
+  setSourceModel(m_history);
+
+  // a new entry is shown only if it matches the query
+  connect(m_history, &QAbstractItemModel::rowsInserted, this, [this] {
+    if (!m_query.isEmpty()) refresh();
+  });
+
+  const auto emitCount = [this] { emit countChanged(rowCount()); };
+
+  connect(this, &QAbstractItemModel::rowsInserted, this, emitCount);
+  connect(this, &QAbstractItemModel::rowsRemoved, this, emitCount);
+  connect(this, &QAbstractItemModel::modelReset, this, emitCount);
+  connect(this, &QAbstractItemModel::layoutChanged, this, emitCount);
+}
+
+ClipbirdQmlHistorySearch::~ClipbirdQmlHistorySearch() = default;
+
+void ClipbirdQmlHistorySearch::setQuery(const QString& query) {
+  if (query == m_query) {
+    return;
+  }
+
+  m_query = query;
+  refresh();
+  emit queryChanged(m_query);
+}
+
+QString ClipbirdQmlHistorySearch::getQuery() const {
+  return m_query;
+}
+
+void ClipbirdQmlHistorySearch::setPrefix(bool prefix) {
+  if (prefix == m_prefix) {
+    return;
+  }
+
+  m_prefix = prefix;
+  refresh();
+  emit prefixChanged(m_prefix);
+}
+
+bool ClipbirdQmlHistorySearch::isPrefix() const {
+  return m_prefix;
+}
+
+int ClipbirdQmlHistorySearch::getCount() const {
+  return rowCount();
+}
+
+QVariantList ClipbirdQmlHistorySearch::getHistoryAt(int index) const {
+  return m_history->getHistoryAt(mapToSource(this->index(index, 0)).row());
+}
+
+void ClipbirdQmlHistorySearch::deleteHistoryAt(int index) {
+  m_history->deleteHistoryAt(mapToSource(this->index(index, 0)).row());
+}
+
+ClipbirdQmlHistorySearch* ClipbirdQmlHistorySearch::create(QQmlEngine* engine, QJSEngine* scriptEngine) {
+  static ClipbirdQmlHistorySearch* instance = new ClipbirdQmlHistorySearch(
+    history::ClipboardHistoryFactory::getClipboardHistory(),
+    ClipbirdQmlHistory::create(engine, scriptEngine)
+  );
+  return instance;
+}
+
+}  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml
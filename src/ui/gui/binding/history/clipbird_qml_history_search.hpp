@@ -0,0 +1,117 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Qt headers
+#include <QObject>
+#include <QSet>
+#include <QSortFilterProxyModel>
+#include <QString>
+#include <QVariantList>
+#include <QtQml/qqmlregistration.h>
+#include <QQmlEngine>
+#include <QJSEngine>
+
+// project headers
+#include "history/clipboard_history.hpp"
+#include "clipbird_qml_history.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
+
+/**
+ * @brief QML binding that filters the history model by a search query
+ * The matching entries are found with the search index of ClipboardHistory,
+ * every entry is shown while the query is empty
+ */
+class ClipbirdQmlHistorySearch : public QSortFilterProxyModel {
+  Q_OBJECT
+  QML_ELEMENT
+  QML_SINGLETON
+
+  Q_PROPERTY(QString query READ getQuery WRITE setQuery NOTIFY queryChanged)
+  Q_PROPERTY(bool prefix READ isPrefix WRITE setPrefix NOTIFY prefixChanged)
+  Q_PROPERTY(int count READ getCount NOTIFY countChanged)
+
+ private:
+  history::ClipboardHistory* m_clipboardHistory = nullptr;
+  ClipbirdQmlHistory* m_history = nullptr;
+  QString m_query;
+  bool m_prefix = false;
+  QSet<quint64> m_matches;
+
+ private:
+  void refresh();
+
+ signals:
+  void queryChanged(QString);
+  void prefixChanged(bool);
+  void countChanged(int);
+
+ protected:
+  bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const override;
+
+ public:
+  /**
+   * @brief Construct a new ClipbirdQmlHistorySearch object
+   * @param clipboardHistory Pointer to ClipboardHistory implementation
+   * @param history History model that is filtered
+   * @param parent Parent QObject
+   */
+  explicit ClipbirdQmlHistorySearch(history::ClipboardHistory* clipboardHistory, ClipbirdQmlHistory* history, QObject* parent = nullptr);
+
+  /**
+   * @brief Destroy the ClipbirdQmlHistorySearch object
+   */
+  virtual ~ClipbirdQmlHistorySearch();
+
+  /**
+   * @brief Set the search query
+   * @param query Text to find in the entries
+   */
+  void setQuery(const QString& query);
+
+  /**
+   * @brief Get the search query
+   * @return QString Query
+   */
+  QString getQuery() const;
+
+  /**
+   * @brief Set whether the query has to start a word
+   * @param prefix Match at word starts only
+   */
+  void setPrefix(bool prefix);
+
+  /**
+   * @brief Get whether the query has to start a word
+   * @return bool Prefix match
+   */
+  bool isPrefix() const;
+
+  /**
+   * @brief Number of entries shown
+   * @return int Count
+   */
+  int getCount() const;
+
+  /**
+   * @brief Get the full payloads of the shown entry at the row
+   * @param index Row of the entry
+   * @return QVariantList Items of the entry
+   */
+  Q_INVOKABLE QVariantList getHistoryAt(int index) const;
+
+  /**
+   * @brief Delete the shown entry at the row
+   * @param index Row of the entry
+   */
+  Q_INVOKABLE void deleteHistoryAt(int index);
+
+  /**
+   * @brief QML singleton factory function
+   * @param engine QML engine
+   * @param scriptEngine JS engine
+   * @return ClipbirdQmlHistorySearch* Singleton instance
+   */
+  static ClipbirdQmlHistorySearch* create(QQmlEngine* engine, QJSEngine* scriptEngine);
+};
+
+}  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml
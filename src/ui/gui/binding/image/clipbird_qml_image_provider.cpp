@@ -2,41 +2,154 @@
 
 #include <QBuffer>
 #include <QImageReader>
+#include <QMutexLocker>
+
+#include <optional>
+
+#include "history/clipboard_history_factory.hpp"
+#include "utility/functions/fingerprint/fingerprint.hpp"
 
 namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
-// ClipbirdQmlImageProvider implementation
-ClipbirdQmlImageProvider::ClipbirdQmlImageProvider(): QQuickImageProvider(QQuickImageProvider::Pixmap) {
+/**
+ * @brief Prefix of the ids that name a history entry
+ */
+const QString historyImagePrefix = QStringLiteral("history/");
+
+/**
+ * @brief Prefix of the ids that name a stored image
+ */
+const QString contentImagePrefix = QStringLiteral("content/");
+
+/**
+ * @brief Bound of a thumbnail when QML gives no source size
+ */
+constexpr QSize defaultThumbnailSize(512, 512);
+
+/**
+ * @brief Key of a thumbnail, the content hash comes first so every size
+ * of an image can be evicted together
+ */
+QString thumbnailKey(quint64 fingerprint, const QSize& size) {
+  return QStringLiteral("%1/%2x%3").arg(fingerprint).arg(size.width()).arg(size.height());
 }
 
-QPixmap ClipbirdQmlImageProvider::requestPixmap(const QString& id, QSize* size, const QSize& requestedSize) {
-  QByteArray data = s_imageCache.value(id);
+// ClipbirdQmlImageResponse implementation
+ClipbirdQmlImageResponse::ClipbirdQmlImageResponse(const QString& id, const QSize& requestedSize)
+  : m_id(id), m_requestedSize(requestedSize) {
+  setAutoDelete(false);
+}
 
-  if (data.isEmpty()) {
-    return QPixmap();
+QQuickTextureFactory* ClipbirdQmlImageResponse::textureFactory() const {
+  return QQuickTextureFactory::textureFactoryForImage(m_image);
+}
+
+void ClipbirdQmlImageResponse::run() {
+  m_image = ClipbirdQmlImageProvider::thumbnail(m_id, m_requestedSize);
+  emit finished();
+}
+
+// ClipbirdQmlImageProvider implementation
+QImage ClipbirdQmlImageProvider::thumbnail(const QString& id, const QSize& requestedSize) {
+  const auto bound = requestedSize.width() > 0 && requestedSize.height() > 0 ? requestedSize : defaultThumbnailSize;
+  const auto parts = id.split('/');
+  std::optional<quint64> entry;
+  quint64 fingerprint = 0;
+
+  if (id.startsWith(historyImagePrefix) && parts.size() == 3) {
+    entry       = parts[1].toULongLong();
+    fingerprint = parts[2].toULongLong();
+  } else if (id.startsWith(contentImagePrefix) && parts.size() == 2) {
+    fingerprint = parts[1].toULongLong();
+  } else {
+    return QImage();
   }
 
-  QImage image;
-  image.loadFromData(data, "PNG");
+  QByteArray data;
 
-  if (image.isNull()) {
-    return QPixmap();
+  {
+    QMutexLocker locker(&s_lock);
+
+    if (auto image = s_thumbnailCache.object(thumbnailKey(fingerprint, bound))) {
+      return *image;
+    }
+
+    if (auto stored = s_imageCache.object(fingerprint)) {
+      data = *stored;
+    }
+  }
+
+  // history payloads are read from the store off the GUI thread
+  if (entry.has_value()) {
+    for (const auto& [mimeType, payload] : history::ClipboardHistoryFactory::getClipboardHistory()->getItems(entry.value())) {
+      if (mimeType.startsWith("image/")) {
+        data = payload;
+        break;
+      }
+    }
+  }
+
+  if (data.isEmpty()) {
+    return QImage();
   }
 
-  if (requestedSize.isValid() && requestedSize.width() > 0 && requestedSize.height() > 0) {
-    image = image.scaled(requestedSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+  QBuffer buffer(&data);
+  buffer.open(QIODevice::ReadOnly);
+
+  // the format is read from the header since images are synced as copied,
+  // decoding to the scaled size never holds the full resolution image
+  QImageReader reader(&buffer);
+  reader.setAutoTransform(true);
+
+  if (const auto size = reader.size(); size.isValid() && (size.width() > bound.width() || size.height() > bound.height())) {
+    reader.setScaledSize(size.scaled(bound, Qt::KeepAspectRatio));
   }
 
-  if (size) {
-    *size = image.size();
+  const auto image = reader.read();
+
+  if (image.isNull()) {
+    return QImage();
   }
 
-  return QPixmap::fromImage(image);
+  QMutexLocker locker(&s_lock);
+  s_thumbnailCache.insert(thumbnailKey(fingerprint, bound), new QImage(image), image.sizeInBytes());
+
+  return image;
+}
+
+ClipbirdQmlImageProvider::ClipbirdQmlImageProvider() {
+  m_pool.setMaxThreadCount(2);
+}
+
+ClipbirdQmlImageProvider::~ClipbirdQmlImageProvider() {
+  m_pool.waitForDone();
+}
+
+QQuickImageResponse* ClipbirdQmlImageProvider::requestImageResponse(const QString& id, const QSize& requestedSize) {
+  auto response = new ClipbirdQmlImageResponse(id, requestedSize);
+  m_pool.start(response);
+  return response;
+}
+
+QString ClipbirdQmlImageProvider::historyImageUrl(const history::HistoryEntry& entry) {
+  return QString("image://clipbird/%1%2/%3").arg(historyImagePrefix).arg(entry.id).arg(entry.fingerprint);
 }
 
 QString ClipbirdQmlImageProvider::storeImage(const QByteArray& data) {
-  QString id = QString::number(s_imageCounter++);
-  s_imageCache[id] = data;
-  return id;
+  const auto fingerprint = utility::functions::contentFingerprint(data);
+  QMutexLocker locker(&s_lock);
+  s_imageCache.insert(fingerprint, new QByteArray(data), data.size());
+  return contentImagePrefix + QString::number(fingerprint);
+}
+
+void ClipbirdQmlImageProvider::evict(quint64 fingerprint) {
+  const auto prefix = QString::number(fingerprint) + '/';
+  QMutexLocker locker(&s_lock);
+
+  s_imageCache.remove(fingerprint);
+
+  for (const auto& key : s_thumbnailCache.keys()) {
+    if (key.startsWith(prefix)) s_thumbnailCache.remove(key);
+  }
 }
 
 }  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml
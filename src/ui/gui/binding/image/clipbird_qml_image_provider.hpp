@@ -1,29 +1,66 @@
 #pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
 
 // Qt headers
-#include <QQuickImageProvider>
-#include <QPixmap>
+#include <QQuickAsyncImageProvider>
+#include <QQuickImageResponse>
+#include <QQuickTextureFactory>
+#include <QRunnable>
+#include <QThreadPool>
 #include <QImage>
 #include <QSize>
 #include <QString>
-#include <QHash>
+#include <QCache>
+#include <QMutex>
 #include <QByteArray>
 
+// project headers
+#include "constants/constants.hpp"
+#include "history/history_store.hpp"
+
 namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
 
 /**
- * @brief Image provider that converts byte arrays to QPixmap for QML
- * This allows QML to load images from byte arrays using image:// URL scheme
+ * @brief Decodes one image request on the provider's thread pool
+ */
+class ClipbirdQmlImageResponse : public QQuickImageResponse, public QRunnable {
+ private:
+  QString m_id;
+  QSize m_requestedSize;
+  QImage m_image;
+
+ public:
+  ClipbirdQmlImageResponse(const QString& id, const QSize& requestedSize);
+  QQuickTextureFactory* textureFactory() const override;
+  void run() override;
+};
+
+/**
+ * @brief Image provider that converts byte arrays to images for QML
+ * This allows QML to load images from byte arrays using image:// URL scheme,
+ * images of the history are read from it by the entry id when requested.
+ * Images are decoded off the GUI thread straight to the requested size and
+ * the thumbnails are kept in a cache bounded in bytes, keyed by content hash
  */
-class ClipbirdQmlImageProvider : public QQuickImageProvider {
+class ClipbirdQmlImageProvider : public QQuickAsyncImageProvider {
+ private:
+  static inline QMutex s_lock;
+  static inline QCache<quint64, QByteArray> s_imageCache{qsizetype(constants::getAppThumbnailCacheSize())};
+  static inline QCache<QString, QImage> s_thumbnailCache{qsizetype(constants::getAppThumbnailCacheSize())};
+
+ private:
+  QThreadPool m_pool;
+
  private:
-  static inline QHash<QString, QByteArray> s_imageCache;
-  static inline int s_imageCounter;
+  friend class ClipbirdQmlImageResponse;
+  static QImage thumbnail(const QString& id, const QSize& requestedSize);
 
  public:
   ClipbirdQmlImageProvider();
-  QPixmap requestPixmap(const QString& id, QSize* size, const QSize& requestedSize) override;
+  ~ClipbirdQmlImageProvider();
+  QQuickImageResponse* requestImageResponse(const QString& id, const QSize& requestedSize) override;
   static QString storeImage(const QByteArray& data);
+  static QString historyImageUrl(const history::HistoryEntry& entry);
+  static void evict(quint64 fingerprint);
 };
 
 }  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml
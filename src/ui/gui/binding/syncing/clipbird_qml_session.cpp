@@ -1,35 +1,32 @@
 #include "clipbird_qml_session.hpp"
 
-namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
+#include "syncing/manager/syncing_manager_factory.hpp"
 
-void ClipbirdQmlSession::handleTrustedStateChanged(bool isTrusted) {
-  emit trustedStateChanged(isTrusted);
-}
+namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
 
-ClipbirdQmlSession::ClipbirdQmlSession(syncing::Session* session, QObject* parent): QObject(parent), m_session(session) {
-  connect(m_session, &syncing::Session::onTrustedStateChanged, this, &ClipbirdQmlSession::handleTrustedStateChanged);
-}
+ClipbirdQmlSession::ClipbirdQmlSession(const syncing::SessionInfo& info, QObject* parent): QObject(parent), m_info(info) {}
 
 ClipbirdQmlSession::~ClipbirdQmlSession() = default;
 
 QString ClipbirdQmlSession::getName() const {
-  return m_session->getName();
+  return m_info.name;
 }
 
 QString ClipbirdQmlSession::getCertificate() const {
-  return m_session->getCertificate().toBase64();
+  return m_info.certificate.toBase64();
 }
 
 bool ClipbirdQmlSession::isTrusted() const {
-  return m_session->isTrusted();
+  return m_info.trusted;
 }
 
 void ClipbirdQmlSession::disconnectFromHost() {
-  m_session->disconnectFromHost();
+  // the session lives in the syncing thread
+  syncing::SyncingManagerFactory::getSyncingManager()->disconnectSession(m_info.session);
 }
 
-syncing::Session* ClipbirdQmlSession::getSession() const {
-  return m_session;
+syncing::SessionInfo ClipbirdQmlSession::getInfo() const {
+  return m_info;
 }
 
 }  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml
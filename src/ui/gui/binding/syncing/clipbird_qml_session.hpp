@@ -13,7 +13,8 @@ namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
 
 /**
  * @brief QML binding for Session that exposes session information to QML
- * This wraps the Session interface and makes it accessible from QML
+ * This wraps a snapshot of the Session taken on the syncing thread, the
+ * SyncingManager sends a new one when the trust of the session changes
  */
 class ClipbirdQmlSession : public QObject {
   Q_OBJECT
@@ -22,19 +23,13 @@ class ClipbirdQmlSession : public QObject {
 
   Q_PROPERTY(QString name READ getName CONSTANT)
   Q_PROPERTY(QString certificate READ getCertificate CONSTANT)
-  Q_PROPERTY(bool isTrusted READ isTrusted NOTIFY trustedStateChanged)
+  Q_PROPERTY(bool isTrusted READ isTrusted CONSTANT)
 
  private:
-  syncing::Session* m_session = nullptr;
-
- private:
-  void handleTrustedStateChanged(bool isTrusted);
-
- signals:
-  void trustedStateChanged(bool isTrusted);
+  syncing::SessionInfo m_info;
 
  public:
-  explicit ClipbirdQmlSession(syncing::Session* session, QObject* parent = nullptr);
+  explicit ClipbirdQmlSession(const syncing::SessionInfo& info, QObject* parent = nullptr);
   virtual ~ClipbirdQmlSession();
 
   /**
@@ -61,10 +56,10 @@ class ClipbirdQmlSession : public QObject {
   Q_INVOKABLE void disconnectFromHost();
 
   /**
-   * @brief Get the underlying session pointer
-   * @return syncing::Session* Session pointer
+   * @brief Get the snapshot of the session
+   * @return syncing::SessionInfo Session values and handle
    */
-  syncing::Session* getSession() const;
+  syncing::SessionInfo getInfo() const;
 };
 
 }  // namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml
@@ -5,24 +5,24 @@
 
 namespace srilakshmikanthanp::clipbirdesk::ui::gui::qml {
 
-void ClipbirdQmlSyncingManager::putConnectedClients(QVector<syncing::Session*> clients) {
+void ClipbirdQmlSyncingManager::putConnectedClients(QVector<syncing::SessionInfo> clients) {
   for (auto* client : m_connectedClients) {
     client->deleteLater();
   }
   m_connectedClients.clear();
-  for (auto* client : clients) {
+  for (const auto& client : clients) {
     m_connectedClients.append(new ClipbirdQmlSession(client, this));
   }
   emit connectedClientsChanged();
 }
 
-void ClipbirdQmlSyncingManager::putConnectedServer(syncing::Session* server) {
+void ClipbirdQmlSyncingManager::putConnectedServer(std::optional<syncing::SessionInfo> server) {
   if (m_connectedServer) {
     m_connectedServer->deleteLater();
     m_connectedServer = nullptr;
   }
-  if (server) {
-    m_connectedServer = new ClipbirdQmlSession(server, this);
+  if (server.has_value()) {
+    m_connectedServer = new ClipbirdQmlSession(server.value(), this);
   }
   emit connectedServerChanged();
 }
@@ -60,8 +60,8 @@ ClipbirdQmlSyncingManager::ClipbirdQmlSyncingManager(syncing::SyncingManager* sy
     &ClipbirdQmlSyncingManager::putAvailableServers
   );
 
-  putConnectedClients(m_syncingManager->getConnectedClients());
-  putConnectedServer(m_syncingManager->getConnectedServer());
+  putConnectedClients(m_syncingManager->getConnectedClientsInfo());
+  putConnectedServer(m_syncingManager->getConnectedServerInfo());
   putAvailableServers(m_syncingManager->getAvailableServers());
 }
 
@@ -99,15 +99,18 @@ void ClipbirdQmlSyncingManager::connectToServer(const QString& serverName) {
 }
 
 void ClipbirdQmlSyncingManager::disconnectFromServer() {
-  auto* server = m_syncingManager->getConnectedServer();
-  if (!server) throw std::runtime_error("No connected server to disconnect from");
-  server->disconnectFromHost();
+  if (!m_connectedServer) throw std::runtime_error("No connected server to disconnect from");
+  m_syncingManager->disconnectSession(m_connectedServer->getInfo().session);
 }
 
 void ClipbirdQmlSyncingManager::disconnectClient(const QString& clientName) {
-  auto client = m_syncingManager->getServerClientSessionByName(clientName);
-  if (!client.has_value()) throw std::runtime_error("Client with name " + clientName.toStdString() + " not found");
-  client.value()->disconnectFromHost();
+  for (auto* client : m_connectedClients) {
+    if (client->getName() == clientName) {
+      m_syncingManager->disconnectSession(client->getInfo().session);
+      return;
+    }
+  }
+  throw std::runtime_error("Client with name " + clientName.toStdString() + " not found");
 }
 
 void ClipbirdQmlSyncingManager::setHostAsServer(bool useBluetooth) {
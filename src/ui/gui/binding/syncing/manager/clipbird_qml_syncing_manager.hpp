@@ -37,8 +37,8 @@ class ClipbirdQmlSyncingManager : public QObject {
   QList<ClipbirdQmlClientServer*> m_availableServers;
 
  private:
-  void putConnectedClients(QVector<syncing::Session*> clients);
-  void putConnectedServer(syncing::Session* server);
+  void putConnectedClients(QVector<syncing::SessionInfo> clients);
+  void putConnectedServer(std::optional<syncing::SessionInfo> server);
   void putAvailableServers(QVector<syncing::ClientServer*> servers);
 
  signals:
@@ -9,8 +9,6 @@ Page {
     id: root
     title: qsTr("History")
 
-    property var history: ClipbirdQmlHistory.history
-
     ColumnLayout {
         anchors.fill: parent
         anchors.margins: 10
@@ -23,10 +21,17 @@ Page {
             }
         }
 
+        TextField {
+            Layout.fillWidth: true
+            placeholderText: qsTr("Search history")
+            visible: ClipbirdQmlHistory.count > 0
+            onTextChanged: ClipbirdQmlHistorySearch.query = text
+        }
+
         StackLayout {
             Layout.fillWidth: true
             Layout.fillHeight: true
-            currentIndex: root.history.length === 0 ? 0 : 1
+            currentIndex: ClipbirdQmlHistorySearch.count === 0 ? 0 : 1
 
             Item {
                 Layout.fillWidth: true
@@ -39,14 +44,14 @@ Page {
                     spacing: 10
 
                     Text {
-                        text: qsTr("No clipboard history yet")
+                        text: ClipbirdQmlHistorySearch.query === "" ? qsTr("No clipboard history yet") : qsTr("No matching history")
                         font.pixelSize: 16
                         color: Material.primaryTextColor
                         anchors.horizontalCenter: parent.horizontalCenter
                     }
 
                     Text {
-                        text: qsTr("Your clipboard history will appear here")
+                        text: ClipbirdQmlHistorySearch.query === "" ? qsTr("Your clipboard history will appear here") : qsTr("Try a different search")
                         font.pixelSize: 14
                         color: Material.secondaryTextColor
                         anchors.horizontalCenter: parent.horizontalCenter
@@ -61,21 +66,19 @@ Page {
 
                 ListView {
                     anchors.fill: parent
-                    model: root.history
+                    model: ClipbirdQmlHistorySearch
                     spacing: 10
 
                     delegate: HistoryItem {
                         required property int index
-                        required property var modelData
                         width: ListView.view.width
-                        historyData: modelData
 
                         onCopyClicked: {
-                            ClipbirdQmlApplicationClipboard.setClipboard(modelData)
+                            ClipbirdQmlApplicationClipboard.setClipboard(ClipbirdQmlHistorySearch.getHistoryAt(index))
                         }
 
                         onDeleteClicked: {
-                            ClipbirdQmlHistory.deleteHistoryAt(index)
+                            ClipbirdQmlHistorySearch.deleteHistoryAt(index)
                         }
                     }
                 }
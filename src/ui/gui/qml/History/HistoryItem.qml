@@ -11,7 +11,8 @@ Item {
     width: parent.width
     height: 150
 
-    required property var historyData
+    required property string previewText
+    required property string thumbnailUrl
     signal copyClicked
     signal deleteClicked
 
@@ -26,7 +27,8 @@ Item {
             HistoryItemContent {
                 width: parent.width
                 height: parent.height * 0.70
-                historyData: root.historyData
+                previewText: root.previewText
+                thumbnailUrl: root.thumbnailUrl
             }
 
             HistoryItemAction {
@@ -9,34 +9,12 @@ Item {
     id: root
     width: parent.width
 
-    required property var historyData
-
-    property var contentComponent: null
-    property var contentItem: null
-
-    Component.onCompleted: {
-        for (let i = 0; i < root.historyData.length; i++) {
-            const item = root.historyData[i];
-            if (item.mimeType === "image/png") {
-                contentItem = item;
-                contentComponent = imageComponent;
-                return;
-            }
-        }
-
-        for (let i = 0; i < root.historyData.length; i++) {
-            const item = root.historyData[i];
-            if (item.mimeType === "text/plain") {
-                contentItem = item;
-                contentComponent = textComponent;
-                return;
-            }
-        }
-    }
+    required property string previewText
+    required property string thumbnailUrl
 
     Loader {
         anchors.fill: parent
-        sourceComponent: root.contentComponent
+        sourceComponent: root.thumbnailUrl !== "" ? imageComponent : root.previewText !== "" ? textComponent : null
     }
 
     Component {
@@ -44,14 +22,16 @@ Item {
         Image {
             anchors.fill: parent
             fillMode: Image.PreserveAspectFit
-            source: ClipbirdQmlImageHelper.imageUrl(root.contentItem.data)
+            sourceSize.width: width
+            sourceSize.height: height
+            source: root.thumbnailUrl
         }
     }
 
     Component {
         id: textComponent
         Text {
-            text: root.contentItem.data.toString(Qt.CompatUtf8)
+            text: root.previewText
             color: Material.primaryTextColor
             wrapMode: Text.WordWrap
             clip: true
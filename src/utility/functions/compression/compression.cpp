@@ -0,0 +1,101 @@
+#include "compression.hpp"
+
+#include <QtEndian>
+
+#include "constants/constants.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+using common::types::enums::Encoding;
+using common::types::enums::ErrorCode;
+using common::types::exceptions::MalformedPacket;
+
+quint32 getSupportedEncodings() {
+  return encodingBit(Encoding::Identity) | encodingBit(Encoding::Deflate);
+}
+
+bool isDecodable(quint32 used, quint32 encodings) {
+  return (used & ~(encodings | encodingBit(Encoding::Identity))) == 0;
+}
+
+bool isCompressible(const QString& mimeType) {
+  const auto type = mimeType.section(';', 0, 0).trimmed().toLower();
+
+  if (type.startsWith(QStringLiteral("text/"))) {
+    return true;
+  }
+
+  if (type.endsWith(QStringLiteral("+xml")) || type.endsWith(QStringLiteral("+json"))) {
+    return true;
+  }
+
+  return type == QStringLiteral("application/json")
+      || type == QStringLiteral("application/xml")
+      || type == QStringLiteral("application/javascript")
+      || type == QStringLiteral("application/x-sh");
+}
+
+quint32 chooseEncoding(const QString& mimeType, qsizetype length, quint32 encodings) {
+  if (length < constants::getAppCompressionThreshold() || !isCompressible(mimeType)) {
+    return Encoding::Identity;
+  }
+
+  // the peer would refuse to inflate it
+  if (length > constants::getAppMaxDecodedLength()) {
+    return Encoding::Identity;
+  }
+
+  if ((encodings & encodingBit(Encoding::Deflate)) == 0) {
+    return Encoding::Identity;
+  }
+
+  return Encoding::Deflate;
+}
+
+QPair<quint32, QByteArray> encodePayload(const QString& mimeType, const QByteArray& payload, quint32 encodings) {
+  const auto identity = qMakePair(quint32(Encoding::Identity), payload);
+
+  if (chooseEncoding(mimeType, payload.size(), encodings) == Encoding::Identity) {
+    return identity;
+  }
+
+  // the fastest level, payloads sent in one frame are on the latency path
+  const auto deflated = qCompress(payload, 1);
+
+  // random looking text does not shrink
+  if (deflated.isEmpty() || deflated.size() >= payload.size()) {
+    return identity;
+  }
+
+  return qMakePair(quint32(Encoding::Deflate), deflated);
+}
+
+QByteArray decodePayload(quint32 encoding, const QByteArray& payload) {
+  return decodePayload(encoding, payload, constants::getAppMaxDecodedLength());
+}
+
+QByteArray decodePayload(quint32 encoding, const QByteArray& payload, qsizetype maxLength) {
+  if (encoding == Encoding::Identity) {
+    return payload;
+  }
+
+  if (encoding != Encoding::Deflate || payload.size() < qsizetype(sizeof(quint32))) {
+    throw MalformedPacket(ErrorCode::CodingError, "Unknown payload encoding");
+  }
+
+  // qCompress prefixes the length of the original payload
+  const auto length = qFromBigEndian<quint32>(payload.constData());
+
+  if (length > quint64(maxLength)) {
+    throw MalformedPacket(ErrorCode::CodingError, "Decoded payload is too large");
+  }
+
+  auto decoded = qUncompress(payload);
+
+  if (decoded.size() != qsizetype(length)) {
+    throw MalformedPacket(ErrorCode::CodingError, "Corrupt deflate payload");
+  }
+
+  return decoded;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
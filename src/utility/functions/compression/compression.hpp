@@ -0,0 +1,71 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+#include <QByteArray>
+#include <QPair>
+#include <QString>
+#include <QtTypes>
+
+#include "common/types/enums/enums.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+/**
+ * @brief Bit of the encoding in a capability bit set
+ */
+constexpr quint32 encodingBit(quint32 encoding) {
+  return quint32(1) << encoding;
+}
+
+/**
+ * @brief Bit set of the encodings this host can decode
+ */
+quint32 getSupportedEncodings();
+
+/**
+ * @brief Check whether a peer accepting the encodings can decode items
+ * using the encodings, identity is always accepted
+ */
+bool isDecodable(quint32 used, quint32 encodings);
+
+/**
+ * @brief Check whether payloads of the mime type are worth compressing,
+ * text and markup are while images, audio, video and archives are
+ * already compressed
+ */
+bool isCompressible(const QString& mimeType);
+
+/**
+ * @brief Choose the encoding for a payload without encoding it, items
+ * below the compression threshold and items larger than a peer decodes
+ * in one piece are left as they are
+ *
+ * @param mimeType mime type of the payload
+ * @param length length of the payload
+ * @param encodings bit set of the encodings the peer accepts
+ * @return quint32 encoding to use
+ */
+quint32 chooseEncoding(const QString& mimeType, qsizetype length, quint32 encodings);
+
+/**
+ * @brief Encode the payload with the best encoding the peer accepts,
+ * items below the compression threshold, items above the decoded length
+ * limit and items that do not shrink are left as they are
+ *
+ * @param mimeType mime type of the payload
+ * @param payload payload to encode
+ * @param encodings bit set of the encodings the peer accepts
+ * @return QPair<quint32, QByteArray> encoding used and encoded payload
+ */
+QPair<quint32, QByteArray> encodePayload(const QString& mimeType, const QByteArray& payload, quint32 encodings);
+
+/**
+ * @brief Decode the payload, throws MalformedPacket if the encoding is
+ * unknown or the payload is corrupt
+ */
+QByteArray decodePayload(quint32 encoding, const QByteArray& payload);
+
+/**
+ * @brief Decode the payload that may decode to at most maxLength bytes,
+ * the length is checked before anything is inflated
+ */
+QByteArray decodePayload(quint32 encoding, const QByteArray& payload, qsizetype maxLength);
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
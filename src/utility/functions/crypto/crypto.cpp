@@ -1,16 +1,19 @@
 #include "crypto.hpp"
 
 #include <openssl/evp.h>
+#include <openssl/kdf.h>
+#include <openssl/x509.h>
 #include <openssl/pem.h>
 #include <openssl/rand.h>
 #include <openssl/rsa.h>
 
+#include <QCryptographicHash>
 #include <QtEndian>
 #include <memory>
 #include <stdexcept>
 
 namespace srilakshmikanthanp::clipbirdesk::utility::functions::internal {
-QByteArray encryptAESKey(const QByteArray& aesKey, const QByteArray& rsaPublickKey) {
+QByteArray encryptRSAKey(const QByteArray& aesKey, const QByteArray& rsaPublickKey) {
   std::shared_ptr<BIO> bio(BIO_new_mem_buf(rsaPublickKey.data(), rsaPublickKey.size()), BIO_free_all);
 
   if (!bio) {
@@ -41,7 +44,7 @@ QByteArray encryptAESKey(const QByteArray& aesKey, const QByteArray& rsaPublickK
   return encryptedKey;
 }
 
-QByteArray decryptAESKey(const QByteArray& encryptedAesKey, const QByteArray& rsaPrivateKey) {
+QByteArray decryptRSAKey(const QByteArray& encryptedAesKey, const QByteArray& rsaPrivateKey) {
   std::shared_ptr<BIO> bio(BIO_new_mem_buf(rsaPrivateKey.data(), rsaPrivateKey.size()), BIO_free_all);
 
   if (!bio) {
@@ -72,6 +75,155 @@ QByteArray decryptAESKey(const QByteArray& encryptedAesKey, const QByteArray& rs
   return decryptedKey;
 }
 
+std::shared_ptr<EVP_PKEY> readPublicKey(const QByteArray& publicKey) {
+  std::shared_ptr<BIO> bio(BIO_new_mem_buf(publicKey.data(), publicKey.size()), BIO_free_all);
+
+  if (!bio) {
+    throw std::runtime_error("BIO_new_mem_buf failed: " + internal::getOpenSSLError());
+  }
+
+  std::shared_ptr<EVP_PKEY> pkey(PEM_read_bio_PUBKEY(bio.get(), nullptr, nullptr, nullptr), EVP_PKEY_free);
+
+  if (!pkey) {
+    throw std::runtime_error("PEM_read_bio_PUBKEY failed: " + internal::getOpenSSLError());
+  }
+
+  return pkey;
+}
+
+std::shared_ptr<EVP_PKEY> readPrivateKey(const QByteArray& privateKey) {
+  std::shared_ptr<BIO> bio(BIO_new_mem_buf(privateKey.data(), privateKey.size()), BIO_free_all);
+
+  if (!bio) {
+    throw std::runtime_error("BIO_new_mem_buf failed: " + internal::getOpenSSLError());
+  }
+
+  std::shared_ptr<EVP_PKEY> pkey(PEM_read_bio_PrivateKey(bio.get(), nullptr, nullptr, nullptr), EVP_PKEY_free);
+
+  if (!pkey) {
+    throw std::runtime_error("PEM_read_bio_PrivateKey failed: " + internal::getOpenSSLError());
+  }
+
+  return pkey;
+}
+
+/**
+ * @brief ECDH between the keys followed by HKDF-SHA256 salted with the
+ * ephemeral public key, gives the 256 bit AES key
+ */
+QByteArray deriveAESKey(EVP_PKEY* own, EVP_PKEY* peer, const QByteArray& ephemeral) {
+  std::shared_ptr<EVP_PKEY_CTX> ctx(EVP_PKEY_CTX_new(own, nullptr), EVP_PKEY_CTX_free);
+
+  if (!ctx || EVP_PKEY_derive_init(ctx.get()) <= 0 || EVP_PKEY_derive_set_peer(ctx.get(), peer) <= 0) {
+    throw std::runtime_error("ECDH init failed: " + internal::getOpenSSLError());
+  }
+
+  size_t secretLen = 0;
+
+  if (EVP_PKEY_derive(ctx.get(), nullptr, &secretLen) <= 0) {
+    throw std::runtime_error("ECDH (size) failed: " + internal::getOpenSSLError());
+  }
+
+  QByteArray secret;
+  secret.resize(static_cast<int>(secretLen));
+
+  if (EVP_PKEY_derive(ctx.get(), reinterpret_cast<unsigned char*>(secret.data()), &secretLen) <= 0) {
+    throw std::runtime_error("ECDH failed: " + internal::getOpenSSLError());
+  }
+
+  secret.resize(static_cast<int>(secretLen));
+
+  std::shared_ptr<EVP_PKEY_CTX> kdf(EVP_PKEY_CTX_new_id(EVP_PKEY_HKDF, nullptr), EVP_PKEY_CTX_free);
+  constexpr const char info[] = "clipbird ecies";
+
+  if (
+    !kdf ||
+    EVP_PKEY_derive_init(kdf.get()) <= 0 ||
+    EVP_PKEY_CTX_set_hkdf_md(kdf.get(), EVP_sha256()) <= 0 ||
+    EVP_PKEY_CTX_set1_hkdf_salt(kdf.get(), reinterpret_cast<const unsigned char*>(ephemeral.data()), ephemeral.size()) <= 0 ||
+    EVP_PKEY_CTX_set1_hkdf_key(kdf.get(), reinterpret_cast<const unsigned char*>(secret.data()), secret.size()) <= 0 ||
+    EVP_PKEY_CTX_add1_hkdf_info(kdf.get(), reinterpret_cast<const unsigned char*>(info), sizeof(info) - 1) <= 0
+  ) {
+    throw std::runtime_error("HKDF init failed: " + internal::getOpenSSLError());
+  }
+
+  QByteArray aesKey;
+  aesKey.resize(32);
+  size_t aesKeyLen = aesKey.size();
+
+  if (EVP_PKEY_derive(kdf.get(), reinterpret_cast<unsigned char*>(aesKey.data()), &aesKeyLen) <= 0) {
+    throw std::runtime_error("HKDF failed: " + internal::getOpenSSLError());
+  }
+
+  return aesKey;
+}
+
+/**
+ * @brief Create the AES key for the recipient, RSA keys get a random key
+ * wrapped with RSA-OAEP, EC keys get a key agreed with an ephemeral key
+ * on the same curve whose DER public key is sent in place of the wrapped
+ * key
+ * @return QPair<QByteArray, QByteArray> - first is the key block, second
+ * is the AES key
+ */
+QPair<QByteArray, QByteArray> sealAESKey(const QByteArray& publicKey) {
+  auto peer = readPublicKey(publicKey);
+
+  if (EVP_PKEY_base_id(peer.get()) == EVP_PKEY_RSA) {
+    auto aesKey = generateAESKey(256);
+    return qMakePair(encryptRSAKey(aesKey, publicKey), aesKey);
+  }
+
+  if (EVP_PKEY_base_id(peer.get()) != EVP_PKEY_EC) {
+    throw std::runtime_error("Unsupported public key type for encryption");
+  }
+
+  std::shared_ptr<EVP_PKEY_CTX> ctx(EVP_PKEY_CTX_new(peer.get(), nullptr), EVP_PKEY_CTX_free);
+  EVP_PKEY *key = nullptr;
+
+  if (!ctx || EVP_PKEY_keygen_init(ctx.get()) <= 0 || EVP_PKEY_keygen(ctx.get(), &key) <= 0) {
+    throw std::runtime_error("Ephemeral keygen failed: " + internal::getOpenSSLError());
+  }
+
+  std::shared_ptr<EVP_PKEY> ephemeralKey(key, EVP_PKEY_free);
+
+  unsigned char *der = nullptr;
+  int derLen = i2d_PUBKEY(ephemeralKey.get(), &der);
+
+  if (derLen <= 0) {
+    throw std::runtime_error("i2d_PUBKEY failed: " + internal::getOpenSSLError());
+  }
+
+  QByteArray ephemeral(reinterpret_cast<const char*>(der), derLen);
+  OPENSSL_free(der);
+
+  return qMakePair(ephemeral, deriveAESKey(ephemeralKey.get(), peer.get(), ephemeral));
+}
+
+/**
+ * @brief Recover the AES key from the key block made by sealAESKey
+ */
+QByteArray openAESKey(const QByteArray& block, const QByteArray& privateKey) {
+  auto own = readPrivateKey(privateKey);
+
+  if (EVP_PKEY_base_id(own.get()) == EVP_PKEY_RSA) {
+    return decryptRSAKey(block, privateKey);
+  }
+
+  if (EVP_PKEY_base_id(own.get()) != EVP_PKEY_EC) {
+    throw std::runtime_error("Unsupported private key type for decryption");
+  }
+
+  const auto *der = reinterpret_cast<const unsigned char*>(block.constData());
+  std::shared_ptr<EVP_PKEY> ephemeralKey(d2i_PUBKEY(nullptr, &der, block.size()), EVP_PKEY_free);
+
+  if (!ephemeralKey) {
+    throw std::runtime_error("d2i_PUBKEY failed: " + internal::getOpenSSLError());
+  }
+
+  return deriveAESKey(own.get(), ephemeralKey.get(), block);
+}
+
 class BlockReader {
 public:
   BlockReader(const QByteArray &src) : data(src), offset(0) {}
@@ -102,9 +254,12 @@ private:
 
 namespace srilakshmikanthanp::clipbirdesk::utility::functions {
 /**
- * @brief Encrypt data using AES-256-GCM and RSA-OAEP for key encryption
+ * @brief Encrypt data using AES-256-GCM, the AES key is wrapped with
+ * RSA-OAEP for RSA keys or agreed with ECDH and HKDF-SHA256 for EC keys
+ * in which case the encrypted AES key block holds the DER encoded
+ * ephemeral public key
  * @param data - Data to be encrypted
- * @param key - RSA Public Key in PEM format
+ * @param key - RSA or EC Public Key in PEM format
  * @return QByteArray - Encrypted data
  * |Size of encrypted AES key(4 bytes) in big-endian|
  * |Encrypted AES key|
@@ -116,7 +271,8 @@ namespace srilakshmikanthanp::clipbirdesk::utility::functions {
  * |Ciphertext|
  */
 QByteArray encrypt(const QByteArray& data, const QByteArray& key) {
-  QByteArray aesKey = generateAESKey(256), iv = generateIV(96);
+  auto [encryptedAesKey, aesKey] = internal::sealAESKey(key);
+  QByteArray iv = generateIV(96);
 
   std::shared_ptr<EVP_CIPHER_CTX> ctx(EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
 
@@ -160,8 +316,6 @@ QByteArray encrypt(const QByteArray& data, const QByteArray& key) {
     throw std::runtime_error("Get TAG failed: " + internal::getOpenSSLError());
   }
 
-  QByteArray encryptedAesKey = internal::encryptAESKey(aesKey, key);
-
   QByteArray result;
   QDataStream stream(&result, QIODevice::WriteOnly);
   stream.setByteOrder(QDataStream::BigEndian);
@@ -179,9 +333,9 @@ QByteArray encrypt(const QByteArray& data, const QByteArray& key) {
 }
 
 /**
- * @brief Sign data using RSA-PSS with SHA-256
+ * @brief Sign data with SHA-256, Ed25519 keys sign the data directly
  * @param data - Data to be signed
- * @param key - RSA Private Key in PEM format
+ * @param key - RSA, EC or Ed25519 Private Key in PEM format
  * @return QByteArray - Signature
  */
 QByteArray sign(const QByteArray& data, const QByteArray& key) {
@@ -203,6 +357,30 @@ QByteArray sign(const QByteArray& data, const QByteArray& key) {
     throw std::runtime_error("Failed to create EVP_MD_CTX: " + internal::getOpenSSLError());
   }
 
+  // Ed25519 hashes internally and only signs in one shot
+  if (EVP_PKEY_base_id(pkey.get()) == EVP_PKEY_ED25519) {
+    if (EVP_DigestSignInit(ctx.get(), nullptr, nullptr, nullptr, pkey.get()) <= 0) {
+      throw std::runtime_error("EVP_DigestSignInit failed: " + internal::getOpenSSLError());
+    }
+
+    size_t sigLen = 0;
+    const auto *tbs = reinterpret_cast<const unsigned char *>(data.data());
+
+    if (EVP_DigestSign(ctx.get(), nullptr, &sigLen, tbs, data.size()) <= 0) {
+      throw std::runtime_error("EVP_DigestSign (size) failed: " + internal::getOpenSSLError());
+    }
+
+    QByteArray signature;
+    signature.resize(static_cast<int>(sigLen));
+
+    if (EVP_DigestSign(ctx.get(), reinterpret_cast<unsigned char *>(signature.data()), &sigLen, tbs, data.size()) <= 0) {
+      throw std::runtime_error("EVP_DigestSign failed: " + internal::getOpenSSLError());
+    }
+
+    signature.resize(sigLen);
+    return signature;
+  }
+
   if (EVP_DigestSignInit(ctx.get(), nullptr, EVP_sha256(), nullptr, pkey.get()) <= 0) {
     throw std::runtime_error("EVP_DigestSignInit failed: " + internal::getOpenSSLError());
   }
@@ -229,9 +407,10 @@ QByteArray sign(const QByteArray& data, const QByteArray& key) {
 }
 
 /**
- * @brief Decrypt data using AES-256-GCM and RSA-OAEP for key decryption
+ * @brief Decrypt data using AES-256-GCM, the AES key is recovered with
+ * RSA-OAEP or ECDH depending on the private key type
  * @param data - Data to be decrypted
- * @param key - RSA Private Key in PEM format
+ * @param key - RSA or EC Private Key in PEM format
  * @return QByteArray - Decrypted data
  * |Size of encrypted AES key(4 bytes) in big-endian|
  * |Encrypted AES key|
@@ -257,7 +436,7 @@ QByteArray decrypt(const QByteArray& data, const QByteArray& key) {
     throw std::runtime_error("Invalid data format (extra data found)");
   }
 
-  QByteArray aesKey = internal::decryptAESKey(encryptedAesKey, key);
+  QByteArray aesKey = internal::openAESKey(encryptedAesKey, key);
 
   std::shared_ptr<EVP_CIPHER_CTX> ctx(EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
 
@@ -300,4 +479,13 @@ QByteArray decrypt(const QByteArray& data, const QByteArray& key) {
   plaintext.resize(total);
   return plaintext;
 }
+
+/**
+ * @brief SHA-256 fingerprint of the certificate bytes as exchanged
+ * @param certificate - Certificate in PEM format
+ * @return QByteArray - 32 byte digest
+ */
+QByteArray fingerprint(const QByteArray& certificate) {
+  return QCryptographicHash::hash(certificate, QCryptographicHash::Sha256);
+}
 }  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
@@ -1,11 +1,34 @@
 #include <QByteArray>
+#include <QPair>
 #include "utility/functions/ssl/ssl.hpp"
 
+namespace srilakshmikanthanp::clipbirdesk::utility::functions::internal {
+/**
+ * @brief Create the AES key for the recipient, wrapped with RSA-OAEP for
+ * RSA keys or agreed with an ephemeral ECDH key for EC keys
+ * @param publicKey - RSA or EC Public Key in PEM format
+ * @return QPair<QByteArray, QByteArray> - first is the key block, second
+ * is the AES key
+ */
+QPair<QByteArray, QByteArray> sealAESKey(const QByteArray& publicKey);
+
+/**
+ * @brief Recover the AES key from the key block made by sealAESKey
+ * @param block - Key block
+ * @param privateKey - RSA or EC Private Key in PEM format
+ * @return QByteArray - AES key
+ */
+QByteArray openAESKey(const QByteArray& block, const QByteArray& privateKey);
+}
+
 namespace srilakshmikanthanp::clipbirdesk::utility::functions {
 /**
- * @brief Encrypt data using AES-256-GCM and RSA-OAEP for key encryption
+ * @brief Encrypt data using AES-256-GCM, the AES key is wrapped with
+ * RSA-OAEP for RSA keys or agreed with ECDH and HKDF-SHA256 for EC keys
+ * in which case the encrypted AES key block holds the DER encoded
+ * ephemeral public key
  * @param data - Data to be encrypted
- * @param key - RSA Public Key in PEM format
+ * @param key - RSA or EC Public Key in PEM format
  * @return QByteArray - Encrypted data
  * |Size of encrypted AES key(4 bytes) in big-endian|
  * |Encrypted AES key|
@@ -19,17 +42,18 @@ namespace srilakshmikanthanp::clipbirdesk::utility::functions {
 QByteArray encrypt(const QByteArray& data, const QByteArray& key);
 
 /**
- * @brief Sign data using RSA-PSS with SHA-256
+ * @brief Sign data with SHA-256, Ed25519 keys sign the data directly
  * @param data - Data to be signed
- * @param key - RSA Private Key in PEM format
+ * @param key - RSA, EC or Ed25519 Private Key in PEM format
  * @return QByteArray - Signature
  */
 QByteArray sign(const QByteArray& data, const QByteArray& key);
 
 /**
- * @brief Decrypt data using AES-256-GCM and RSA-OAEP for key decryption
+ * @brief Decrypt data using AES-256-GCM, the AES key is recovered with
+ * RSA-OAEP or ECDH depending on the private key type
  * @param data - Data to be decrypted
- * @param key - RSA Private Key in PEM format
+ * @param key - RSA or EC Private Key in PEM format
  * @return QByteArray - Decrypted data
  * |Size of encrypted AES key(4 bytes) in big-endian|
  * |Encrypted AES key|
@@ -41,4 +65,11 @@ QByteArray sign(const QByteArray& data, const QByteArray& key);
  * |Ciphertext|
  */
 QByteArray decrypt(const QByteArray& data, const QByteArray& key);
+
+/**
+ * @brief SHA-256 fingerprint of the certificate bytes as exchanged
+ * @param certificate - Certificate in PEM format
+ * @return QByteArray - 32 byte digest
+ */
+QByteArray fingerprint(const QByteArray& certificate);
 }
@@ -0,0 +1,161 @@
+#include "delta.hpp"
+
+#include <QByteArrayView>
+#include <QMultiHash>
+
+#include <array>
+#include <optional>
+
+#include "constants/constants.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions::internal {
+/**
+ * @brief Chunks are at least this long so the ops stay few
+ */
+constexpr qsizetype minChunkLength = 2 * 1024;
+
+/**
+ * @brief Chunks are at most this long so a run without boundary is cut
+ */
+constexpr qsizetype maxChunkLength = 64 * 1024;
+
+/**
+ * @brief Top 13 bits of the hash are zero once every 8 KiB on average
+ */
+constexpr int chunkMaskShift = 64 - 13;
+
+/**
+ * @brief Random value of each byte for the gear hash, generated with
+ * splitmix64 so no table has to be kept in the source
+ */
+constexpr std::array<quint64, 256> gearTable() {
+  std::array<quint64, 256> table{};
+  quint64 state = 0x9E3779B97F4A7C15ULL;
+
+  for (auto& value : table) {
+    state += 0x9E3779B97F4A7C15ULL;
+    auto z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    value = z ^ (z >> 31);
+  }
+
+  return table;
+}
+
+constexpr auto gear = gearTable();
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions::internal
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+using common::types::exceptions::MalformedPacket;
+using common::types::enums::ErrorCode;
+
+bool isDeltaCompatible(const QString& mimeType) {
+  const auto type = mimeType.section(';', 0, 0).trimmed().toLower();
+  return type == QStringLiteral("text/plain") || type == QStringLiteral("text/html");
+}
+
+QVector<QPair<qsizetype, qsizetype>> chunkContent(const QByteArray& data) {
+  QVector<QPair<qsizetype, qsizetype>> chunks;
+  const auto* bytes = reinterpret_cast<const uchar*>(data.constData());
+  qsizetype start   = 0;
+  quint64 hash      = 0;
+
+  for (qsizetype i = 0; i < data.size(); i++) {
+    // the shift drops the bytes older than 64 from the top bits
+    hash = (hash << 1) + internal::gear[bytes[i]];
+
+    const auto length = i - start + 1;
+
+    if ((length >= internal::minChunkLength && (hash >> internal::chunkMaskShift) == 0) || length >= internal::maxChunkLength) {
+      chunks.append(qMakePair(start, length));
+      start = i + 1;
+      hash  = 0;
+    }
+  }
+
+  if (start < data.size()) {
+    chunks.append(qMakePair(start, data.size() - start));
+  }
+
+  return chunks;
+}
+
+QVector<packets::DeltaOp> createDelta(const QByteArray& base, const QByteArray& target) {
+  QMultiHash<size_t, QPair<qsizetype, qsizetype>> index;
+  QVector<packets::DeltaOp> ops;
+
+  for (const auto& chunk : chunkContent(base)) {
+    index.insert(qHash(QByteArrayView(base).sliced(chunk.first, chunk.second)), chunk);
+  }
+
+  for (const auto& [offset, length] : chunkContent(target)) {
+    const auto chunk = QByteArrayView(target).sliced(offset, length);
+    const auto key   = qHash(chunk);
+    std::optional<qsizetype> match;
+
+    // equal hashes are compared since qHash is not collision free
+    for (auto it = index.constFind(key); it != index.cend() && it.key() == key; ++it) {
+      if (QByteArrayView(base).sliced(it->first, it->second) == chunk) {
+        match = it->first;
+        break;
+      }
+    }
+
+    if (!match.has_value()) {
+      if (ops.isEmpty()) ops.append(packets::DeltaOp{});
+      ops.last().literal.append(chunk);
+      continue;
+    }
+
+    // extend the copy when the chunk follows it in the base
+    if (!ops.isEmpty() && ops.last().literal.isEmpty() && ops.last().copyOffset + ops.last().copyLength == quint64(match.value())) {
+      ops.last().copyLength += quint64(length);
+    } else {
+      ops.append(packets::DeltaOp{quint64(match.value()), quint64(length), QByteArray()});
+    }
+  }
+
+  return ops;
+}
+
+qsizetype deltaSize(const QVector<packets::DeltaOp>& ops) {
+  qsizetype size = 0;
+
+  for (const auto& op : ops) {
+    size += sizeof(op.copyOffset) + sizeof(op.copyLength) + sizeof(quint32) + op.literal.size();
+  }
+
+  return size;
+}
+
+QByteArray applyDelta(const QByteArray& base, const QVector<packets::DeltaOp>& ops, quint64 targetLength) {
+  if (targetLength > quint64(constants::getAppMaxDecodedLength())) {
+    throw MalformedPacket(ErrorCode::CodingError, "Delta target is too large");
+  }
+
+  QByteArray target;
+  target.reserve(qsizetype(targetLength));
+
+  for (const auto& op : ops) {
+    if (op.copyOffset > quint64(base.size()) || op.copyLength > quint64(base.size()) - op.copyOffset) {
+      throw MalformedPacket(ErrorCode::CodingError, "Delta copies past the base");
+    }
+
+    if (op.copyLength + quint64(op.literal.size()) > targetLength - quint64(target.size())) {
+      throw MalformedPacket(ErrorCode::CodingError, "Delta is longer than the target");
+    }
+
+    target.append(base.constData() + op.copyOffset, qsizetype(op.copyLength));
+    target.append(op.literal);
+  }
+
+  if (quint64(target.size()) != targetLength) {
+    throw MalformedPacket(ErrorCode::CodingError, "Delta is shorter than the target");
+  }
+
+  return target;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
@@ -0,0 +1,43 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+#include <QByteArray>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include <QtTypes>
+
+#include "packets/deltapacket/deltapacket.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+/**
+ * @brief Check whether payloads of the mime type are sent as deltas,
+ * only text is since an edit to it stays local in the bytes
+ */
+bool isDeltaCompatible(const QString& mimeType);
+
+/**
+ * @brief Split the data into content defined chunks with a gear rolling
+ * hash, a boundary depends only on the bytes before it so an edit moves
+ * the boundaries around it and leaves the rest of the chunks as they are
+ *
+ * @return QVector<QPair<qsizetype, qsizetype>> offset and length of each chunk
+ */
+QVector<QPair<qsizetype, qsizetype>> chunkContent(const QByteArray& data);
+
+/**
+ * @brief Delta that rebuilds the target from the base, chunks of the
+ * target found in the base are copied and the rest are sent as literals
+ */
+QVector<packets::DeltaOp> createDelta(const QByteArray& base, const QByteArray& target);
+
+/**
+ * @brief Bytes the ops take on the wire
+ */
+qsizetype deltaSize(const QVector<packets::DeltaOp>& ops);
+
+/**
+ * @brief Rebuild the target from the base, throws MalformedPacket if an
+ * op is out of the base or the target does not have the length given
+ */
+QByteArray applyDelta(const QByteArray& base, const QVector<packets::DeltaOp>& ops, quint64 targetLength);
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
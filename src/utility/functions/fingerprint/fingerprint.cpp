@@ -0,0 +1,91 @@
+#include "fingerprint.hpp"
+
+#include <QtEndian>
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+namespace {
+// XXH64 as specified at https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+constexpr quint64 PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr quint64 PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr quint64 PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr quint64 PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr quint64 PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+constexpr quint64 rotl(quint64 value, int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+constexpr quint64 round(quint64 acc, quint64 lane) {
+  return rotl(acc + lane * PRIME64_2, 31) * PRIME64_1;
+}
+
+constexpr quint64 merge(quint64 acc, quint64 value) {
+  return (acc ^ round(0, value)) * PRIME64_1 + PRIME64_4;
+}
+
+quint64 xxh64(const uchar* data, quint64 size, quint64 seed) {
+  const auto end = data + size;
+  quint64 acc;
+
+  if (size >= 32) {
+    quint64 v1 = seed + PRIME64_1 + PRIME64_2;
+    quint64 v2 = seed + PRIME64_2;
+    quint64 v3 = seed;
+    quint64 v4 = seed - PRIME64_1;
+
+    for (; data + 32 <= end; data += 32) {
+      v1 = round(v1, qFromLittleEndian<quint64>(data));
+      v2 = round(v2, qFromLittleEndian<quint64>(data + 8));
+      v3 = round(v3, qFromLittleEndian<quint64>(data + 16));
+      v4 = round(v4, qFromLittleEndian<quint64>(data + 24));
+    }
+
+    acc = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    acc = merge(acc, v1);
+    acc = merge(acc, v2);
+    acc = merge(acc, v3);
+    acc = merge(acc, v4);
+  } else {
+    acc = seed + PRIME64_5;
+  }
+
+  acc += size;
+
+  for (; data + 8 <= end; data += 8) {
+    acc = rotl(acc ^ round(0, qFromLittleEndian<quint64>(data)), 27) * PRIME64_1 + PRIME64_4;
+  }
+
+  if (data + 4 <= end) {
+    acc = rotl(acc ^ (quint64(qFromLittleEndian<quint32>(data)) * PRIME64_1), 23) * PRIME64_2 + PRIME64_3;
+    data += 4;
+  }
+
+  for (; data < end; data++) {
+    acc = rotl(acc ^ (quint64(*data) * PRIME64_5), 11) * PRIME64_1;
+  }
+
+  acc ^= acc >> 33;
+  acc *= PRIME64_2;
+  acc ^= acc >> 29;
+  acc *= PRIME64_3;
+  acc ^= acc >> 32;
+
+  return acc;
+}
+}  // namespace
+
+quint64 contentFingerprint(QByteArrayView data, quint64 seed) {
+  return xxh64(reinterpret_cast<const uchar*>(data.data()), quint64(data.size()), seed);
+}
+
+quint64 contentFingerprint(const QVector<QPair<QString, QByteArray>>& items, quint64 seed) {
+  auto hash = contentFingerprint(QByteArrayView(), seed ^ quint64(items.size()));
+
+  for (const auto& [mimeType, payload] : items) {
+    hash = contentFingerprint(mimeType.toUtf8(), hash);
+    hash = contentFingerprint(payload, hash ^ quint64(payload.size()));
+  }
+
+  return hash;
+}
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
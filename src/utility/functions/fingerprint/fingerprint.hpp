@@ -0,0 +1,23 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include <QtTypes>
+
+namespace srilakshmikanthanp::clipbirdesk::utility::functions {
+/**
+ * @brief Fast non cryptographic fingerprint of the data, chained from
+ * the seed so several parts can be fingerprinted as one, it is XXH64
+ * so the values kept in the history stay valid across Qt versions
+ */
+quint64 contentFingerprint(QByteArrayView data, quint64 seed = 0);
+
+/**
+ * @brief Fingerprint of the clipboard items, the mime types and the
+ * order of the items are part of it
+ */
+quint64 contentFingerprint(const QVector<QPair<QString, QByteArray>>& items, quint64 seed = 0);
+}  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
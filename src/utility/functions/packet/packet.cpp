@@ -1,5 +1,7 @@
 #include "packet.hpp"
 
+#include "utility/functions/compression/compression.hpp"
+
 namespace srilakshmikanthanp::clipbirdesk::utility::functions {
 /**
  * @brief Create the Authentication
@@ -50,12 +52,14 @@ packets::InvalidRequest createPacket(params::InvalidPacketParams params) {
  *
  * @param mime
  * @param payload
+ * @param encoding
  *
  * @return SyncingItem
  */
 packets::SyncingItem createPacket(params::SyncingItemParams params) {
   packets::SyncingItem syncItem;
   syncItem.setMimeType(params.mimeType.toUtf8());
+  syncItem.setEncoding(params.encoding);
   syncItem.setPayload(params.payload);
   return syncItem;
 }
@@ -65,6 +69,10 @@ packets::SyncingItem createPacket(params::SyncingItemParams params) {
  *
  *
  * @param items
+ * @param originId
+ * @param sequence
+ * @param encodings
+ * @param stamped
  *
  * @return SyncingPacket
  */
@@ -73,10 +81,20 @@ packets::SyncingPacket createPacket(params::SyncingPacketParams params) {
   QVector<packets::SyncingItem> items;
   items.reserve(params.items.size());
 
+  // the legacy layout has no encoding field
+  const auto encodings = params.stamped ? params.encodings : 0;
+
   for (const auto& [mime, payload] : params.items) {
-    items.push_back(createPacket({mime, payload}));
+    const auto [encoding, encoded] = encodePayload(mime, payload, encodings);
+    items.push_back(createPacket({mime, encoded, encoding}));
+  }
+
+  if (!params.stamped) {
+    packet.setPacketType(packets::PacketType::SYNCING_PACKET);
   }
 
+  packet.setOriginId(params.originId);
+  packet.setSequence(params.sequence);
   packet.setItems(items);
   return packet;
 }
@@ -94,4 +112,139 @@ packets::PingPongPacket createPacket(params::PingPacketParams params) {
   packet.setPingType(params.pingType);
   return packet;
 }
+
+/**
+ * @brief Create the StreamBeginPacket
+ *
+ * @param transferId
+ * @param itemId
+ * @param totalLength
+ * @param mimeType
+ * @param encoding
+ *
+ * @return StreamBeginPacket
+ */
+packets::StreamBeginPacket createPacket(params::StreamBeginParams params) {
+  packets::StreamBeginPacket packet;
+  packet.setTransferId(params.transferId);
+  packet.setItemId(params.itemId);
+  packet.setTotalLength(params.totalLength);
+  packet.setMimeType(params.mimeType.toUtf8());
+  packet.setEncoding(params.encoding);
+  return packet;
+}
+
+/**
+ * @brief Create the StreamChunkPacket
+ *
+ * @param transferId
+ * @param itemId
+ * @param offset
+ * @param payload
+ *
+ * @return StreamChunkPacket
+ */
+packets::StreamChunkPacket createPacket(params::StreamChunkParams params) {
+  packets::StreamChunkPacket packet;
+  packet.setTransferId(params.transferId);
+  packet.setItemId(params.itemId);
+  packet.setOffset(params.offset);
+  packet.setPayload(params.payload);
+  return packet;
+}
+
+/**
+ * @brief Create the StreamEndPacket
+ *
+ * @param transferId
+ * @param itemCount
+ * @param originId
+ * @param sequence
+ *
+ * @return StreamEndPacket
+ */
+packets::StreamEndPacket createPacket(params::StreamEndParams params) {
+  packets::StreamEndPacket packet;
+  packet.setTransferId(params.transferId);
+  packet.setItemCount(params.itemCount);
+  packet.setOriginId(params.originId);
+  packet.setSequence(params.sequence);
+  return packet;
+}
+
+/**
+ * @brief Create the OfferPacket
+ *
+ * @param items
+ * @param hashes
+ * @param originId
+ * @param sequence
+ *
+ * @return OfferPacket
+ */
+packets::OfferPacket createPacket(params::OfferPacketParams params) {
+  packets::OfferPacket packet;
+  QVector<packets::OfferItem> items;
+  items.reserve(params.items.size());
+
+  for (qsizetype i = 0; i < params.items.size(); i++) {
+    packets::OfferItem item;
+    item.setMimeType(params.items[i].first.toUtf8());
+    item.setPayloadLength(quint64(params.items[i].second.size()));
+    item.setHash(params.hashes[i]);
+    items.push_back(item);
+  }
+
+  packet.setOriginId(params.originId);
+  packet.setSequence(params.sequence);
+  packet.setItems(items);
+  return packet;
+}
+
+/**
+ * @brief Create the NeedPacket
+ *
+ * @param hashes
+ * @param originId
+ * @param sequence
+ *
+ * @return NeedPacket
+ */
+packets::NeedPacket createPacket(params::NeedPacketParams params) {
+  packets::NeedPacket packet;
+  packet.setOriginId(params.originId);
+  packet.setSequence(params.sequence);
+  packet.setHashes(params.hashes);
+  return packet;
+}
+
+/**
+ * @brief Create the CapabilityPacket
+ *
+ * @param encodings
+ *
+ * @return CapabilityPacket
+ */
+packets::CapabilityPacket createPacket(params::CapabilityPacketParams params) {
+  packets::CapabilityPacket packet;
+  packet.setEncodings(params.encodings);
+  return packet;
+}
+
+/**
+ * @brief Create the DeltaPacket
+ *
+ * @param items
+ * @param originId
+ * @param sequence
+ *
+ * @return DeltaPacket
+ */
+packets::DeltaPacket createPacket(params::DeltaPacketParams params) {
+  packets::DeltaPacket packet;
+  packet.setOriginId(params.originId);
+  packet.setSequence(params.sequence);
+  packet.setItems(params.items);
+  return packet;
+}
 }  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
@@ -5,14 +5,19 @@
 #include <QHostAddress>
 #include <QPair>
 #include <QString>
+#include <QUuid>
 #include <QVector>
 #include <QtTypes>
 
 // Local header files
 #include "packets/authentication/authentication.hpp"
+#include "packets/capabilitypacket/capabilitypacket.hpp"
 #include "packets/certificate_exchange_packet/certificate_exchange_packet.hpp"
+#include "packets/deltapacket/deltapacket.hpp"
 #include "packets/invalidrequest/invalidrequest.hpp"
+#include "packets/offerpacket/offerpacket.hpp"
 #include "packets/pingpongpacket/pingpongpacket.hpp"
+#include "packets/streamingpacket/streamingpacket.hpp"
 #include "packets/syncingpacket/syncingpacket.hpp"
 #include "common/types/enums/enums.hpp"
 #include "utility/functions/ipconv/ipconv.hpp"
@@ -46,13 +51,20 @@ struct InvalidPacketParams {
 struct SyncingItemParams {
   const QString& mimeType;
   const QByteArray& payload;
+  quint32 encoding = common::types::enums::Encoding::Identity;
 };
 
 /**
- * @brief parameters for the SyncingPacket
+ * @brief parameters for the SyncingPacket, items are compressed with
+ * the encodings the peer accepts, an unstamped packet has the legacy
+ * layout and sends every item as it is
  */
 struct SyncingPacketParams {
   QVector<QPair<QString, QByteArray>> items;
+  QUuid originId    = QUuid();
+  quint64 sequence  = 0;
+  quint32 encodings = 0;
+  bool stamped      = true;
 };
 
 /**
@@ -61,6 +73,72 @@ struct SyncingPacketParams {
 struct PingPacketParams {
   quint32 pingType;
 };
+
+/**
+ * @brief parameters for the StreamBeginPacket
+ */
+struct StreamBeginParams {
+  quint32 transferId;
+  quint32 itemId;
+  quint64 totalLength;
+  const QString& mimeType;
+  quint32 encoding = common::types::enums::Encoding::Identity;
+};
+
+/**
+ * @brief parameters for the StreamChunkPacket
+ */
+struct StreamChunkParams {
+  quint32 transferId;
+  quint32 itemId;
+  quint64 offset;
+  const QByteArray& payload;
+};
+
+/**
+ * @brief parameters for the StreamEndPacket
+ */
+struct StreamEndParams {
+  quint32 transferId;
+  quint32 itemCount;
+  QUuid originId   = QUuid();
+  quint64 sequence = 0;
+};
+
+/**
+ * @brief parameters for the OfferPacket, hashes are parallel to items
+ */
+struct OfferPacketParams {
+  QVector<QPair<QString, QByteArray>> items;
+  QVector<QByteArray> hashes;
+  QUuid originId;
+  quint64 sequence;
+};
+
+/**
+ * @brief parameters for the NeedPacket
+ */
+struct NeedPacketParams {
+  QVector<QByteArray> hashes;
+  QUuid originId;
+  quint64 sequence;
+};
+
+/**
+ * @brief parameters for the CapabilityPacket
+ */
+struct CapabilityPacketParams {
+  quint32 encodings;
+};
+
+/**
+ * @brief parameters for the DeltaPacket
+ */
+struct DeltaPacketParams {
+  QVector<packets::DeltaItem> items;
+  QUuid originId;
+  quint64 sequence;
+};
 }  // namespace srilakshmikanthanp::clipbirdesk::utility::functions::params
 
 namespace srilakshmikanthanp::clipbirdesk::utility::functions {
@@ -101,6 +179,7 @@ packets::InvalidRequest createPacket(params::InvalidPacketParams params);
  *
  * @param mime
  * @param payload
+ * @param encoding
  *
  * @return SyncingItem
  */
@@ -111,6 +190,10 @@ packets::SyncingItem createPacket(params::SyncingItemParams params);
  *
  * @param packetType
  * @param items
+ * @param originId
+ * @param sequence
+ * @param encodings
+ * @param stamped
  *
  * @return SyncingPacket
  */
@@ -125,4 +208,84 @@ packets::SyncingPacket createPacket(params::SyncingPacketParams params);
  * @return PingPongPacket
  */
 packets::PingPongPacket createPacket(params::PingPacketParams params);
+
+/**
+ * @brief Create the StreamBeginPacket
+ *
+ * @param transferId
+ * @param itemId
+ * @param totalLength
+ * @param mimeType
+ * @param encoding
+ *
+ * @return StreamBeginPacket
+ */
+packets::StreamBeginPacket createPacket(params::StreamBeginParams params);
+
+/**
+ * @brief Create the StreamChunkPacket
+ *
+ * @param transferId
+ * @param itemId
+ * @param offset
+ * @param payload
+ *
+ * @return StreamChunkPacket
+ */
+packets::StreamChunkPacket createPacket(params::StreamChunkParams params);
+
+/**
+ * @brief Create the StreamEndPacket
+ *
+ * @param transferId
+ * @param itemCount
+ * @param originId
+ * @param sequence
+ *
+ * @return StreamEndPacket
+ */
+packets::StreamEndPacket createPacket(params::StreamEndParams params);
+
+/**
+ * @brief Create the OfferPacket
+ *
+ * @param items
+ * @param hashes
+ * @param originId
+ * @param sequence
+ *
+ * @return OfferPacket
+ */
+packets::OfferPacket createPacket(params::OfferPacketParams params);
+
+/**
+ * @brief Create the NeedPacket
+ *
+ * @param hashes
+ * @param originId
+ * @param sequence
+ *
+ * @return NeedPacket
+ */
+packets::NeedPacket createPacket(params::NeedPacketParams params);
+
+/**
+ * @brief Create the CapabilityPacket
+ *
+ * @param encodings
+ *
+ * @return CapabilityPacket
+ */
+packets::CapabilityPacket createPacket(params::CapabilityPacketParams params);
+
+/**
+ * @brief Create the DeltaPacket
+ *
+ * @param items
+ * @param originId
+ * @param sequence
+ *
+ * @return DeltaPacket
+ */
+packets::DeltaPacket createPacket(params::DeltaPacketParams params);
 }  // namespace srilakshmikanthanp::clipbirdesk::utility::functions
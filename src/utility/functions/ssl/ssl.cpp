@@ -51,6 +51,55 @@ std::shared_ptr<EVP_PKEY> generateRSAKey(int bits) {
   return pkey;
 }
 
+/**
+ *  @brief generates a EVP_PKEY on the named curve
+ *  @returns EVP_PKEY* - shared pointer to the key
+ */
+std::shared_ptr<EVP_PKEY> generateECKey(int nid) {
+  // context for the key generation
+  std::shared_ptr<EVP_PKEY_CTX> ctx(EVP_PKEY_CTX_new_id(EVP_PKEY_EC, NULL), EVP_PKEY_CTX_free);
+
+  // if ctx is null then throw an error
+  if (ctx.get() == NULL) {
+    throw std::runtime_error("Can't Create EVP_PKEY_CTX");
+  }
+
+  // initialize the key generation
+  if (EVP_PKEY_keygen_init(ctx.get()) <= 0) {
+    throw std::runtime_error("Can't Init EC Keygen");
+  }
+
+  // set the curve
+  if (EVP_PKEY_CTX_set_ec_paramgen_curve_nid(ctx.get(), nid) <= 0) {
+    throw std::runtime_error("Can't Set EC Curve");
+  }
+
+  // Try to generate the key
+  EVP_PKEY *key = NULL;
+
+  if (EVP_PKEY_keygen(ctx.get(), &key) <= 0) {
+    throw std::runtime_error("Can't Generate EC Key");
+  }
+
+  // The key has been generated, return it
+  return std::shared_ptr<EVP_PKEY>(key, EVP_PKEY_free);
+}
+
+/**
+ *  @brief generates a key of the algorithm
+ *  @returns EVP_PKEY* - shared pointer to the key
+ */
+std::shared_ptr<EVP_PKEY> generateKey(QSsl::KeyAlgorithm algorithm, int bits) {
+  switch (algorithm) {
+    case QSsl::Rsa:
+      return generateRSAKey(bits);
+    case QSsl::Ec:
+      return generateECKey(NID_X9_62_prime256v1);
+    default:
+      throw std::invalid_argument("Unsupported key algorithm");
+  }
+}
+
 /**
  * @brief Generates a self-signed x509 certificate
  *
@@ -132,7 +181,7 @@ std::shared_ptr<X509> generateX509(std::shared_ptr<EVP_PKEY> pkey) {
   X509_set_pubkey(x509.get(), pkey.get());
 
   // Actually sign the certificate with our key.
-  if (!X509_sign(x509.get(), pkey.get(), EVP_sha1())) {
+  if (!X509_sign(x509.get(), pkey.get(), EVP_sha256())) {
     throw std::runtime_error("Can't Sign X509");
   }
 
@@ -166,12 +215,13 @@ std::string getOpenSSLError() {
 
 namespace srilakshmikanthanp::clipbirdesk::utility::functions {
 /**
- * @brief Get the Q Ssl Configuration object
+ * @brief Generate a Key Pair and return as QSslKey
+ * @param algorithm - Rsa or Ec (P-256)
  * @param bits - RSA key size
- * @return QSslConfiguration
+ * @return QPair<QSslKey, QSslKey> - first is private key, second is public key
  */
-QPair<QSslKey, QSslKey> generateQtKeyPair(int bits) {
-  std::shared_ptr<EVP_PKEY> pkey = internal::generateRSAKey(bits);
+QPair<QSslKey, QSslKey> generateQtKeyPair(QSsl::KeyAlgorithm algorithm, int bits) {
+  std::shared_ptr<EVP_PKEY> pkey = internal::generateKey(algorithm, bits);
   std::shared_ptr<BIO> privateBio(BIO_new(BIO_s_mem()), BIO_free_all);
 
   if (!privateBio) {
@@ -185,7 +235,7 @@ QPair<QSslKey, QSslKey> generateQtKeyPair(int bits) {
   BUF_MEM *privateBufffer = nullptr;
   BIO_get_mem_ptr(privateBio.get(), &privateBufffer);
   QByteArray privatePem(privateBufffer->data, static_cast<int>(privateBufffer->length));
-  QSslKey privateKey(privatePem, QSsl::Rsa, QSsl::Pem, QSsl::PrivateKey);
+  QSslKey privateKey(privatePem, algorithm, QSsl::Pem, QSsl::PrivateKey);
 
   std::shared_ptr<BIO> publicBio(BIO_new(BIO_s_mem()), BIO_free_all);
 
@@ -200,19 +250,20 @@ QPair<QSslKey, QSslKey> generateQtKeyPair(int bits) {
   BUF_MEM *publicBuffer = nullptr;
   BIO_get_mem_ptr(publicBio.get(), &publicBuffer);
   QByteArray publicPem(publicBuffer->data, static_cast<int>(publicBuffer->length));
-  QSslKey publicKey(publicPem, QSsl::Rsa, QSsl::Pem, QSsl::PublicKey);
+  QSslKey publicKey(publicPem, algorithm, QSsl::Pem, QSsl::PublicKey);
 
   return qMakePair(privateKey, publicKey);
 }
 
 /**
  * @brief Get the Q Ssl Configuration object
+ * @param algorithm - Rsa or Ec (P-256)
  * @param bits - RSA key size
  * @return QSslConfiguration
  */
-common::types::SslConfig getQSslConfiguration(int bits) {
-  // Generate the RSA key for the certificate
-  std::shared_ptr<EVP_PKEY> pkey = internal::generateRSAKey(bits);
+common::types::SslConfig getQSslConfiguration(QSsl::KeyAlgorithm algorithm, int bits) {
+  // Generate the key for the certificate
+  std::shared_ptr<EVP_PKEY> pkey = internal::generateKey(algorithm, bits);
 
   // Generate the certificate
   std::shared_ptr<X509> x509     = internal::generateX509(pkey);
@@ -238,9 +289,6 @@ common::types::SslConfig getQSslConfiguration(int bits) {
   // QByteArray for the Key
   QByteArray key(QByteArray(pkey_buffer_memory->data, pkey_buffer_memory->length));
 
-  // Create the QSslKey
-  QSslKey sslKey(key, QSsl::Rsa, QSsl::Pem, QSsl::PrivateKey);
-
   // Write the certificate to buffer
   BIO *x509_buffer = BIO_new(BIO_s_mem());
 
@@ -266,6 +314,46 @@ common::types::SslConfig getQSslConfiguration(int bits) {
   };
 }
 
+/**
+ * @brief Detect the algorithm of a private key
+ * @param key - Private Key in PEM format
+ * @return QSsl::KeyAlgorithm - Opaque if the key is unreadable or not
+ * supported by QSslKey
+ */
+QSsl::KeyAlgorithm getKeyAlgorithm(const QByteArray& key) {
+  std::shared_ptr<BIO> bio(BIO_new_mem_buf(key.data(), key.size()), BIO_free_all);
+
+  if (!bio) {
+    return QSsl::Opaque;
+  }
+
+  std::shared_ptr<EVP_PKEY> pkey(PEM_read_bio_PrivateKey(bio.get(), nullptr, nullptr, nullptr), EVP_PKEY_free);
+
+  if (!pkey) {
+    return QSsl::Opaque;
+  }
+
+  switch (EVP_PKEY_base_id(pkey.get())) {
+    case EVP_PKEY_RSA:
+      return QSsl::Rsa;
+    case EVP_PKEY_EC:
+      return QSsl::Ec;
+    case EVP_PKEY_DSA:
+      return QSsl::Dsa;
+    default:
+      return QSsl::Opaque;
+  }
+}
+
+/**
+ * @brief Load the private key with its detected algorithm
+ * @param key - Private Key in PEM format
+ * @return QSslKey - private key
+ */
+QSslKey getQSslPrivateKey(const QByteArray& key) {
+  return QSslKey(key, getKeyAlgorithm(key), QSsl::Pem, QSsl::PrivateKey);
+}
+
 /**
  * @brief Generate AES Key
  * @param bits - AES key size
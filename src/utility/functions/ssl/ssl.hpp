@@ -16,6 +16,8 @@
 #include <vector>
 
 // openssl headers
+#include <openssl/ec.h>
+#include <openssl/evp.h>
 #include <openssl/pem.h>
 #include <openssl/x509.h>
 #include <openssl/err.h>
@@ -34,18 +36,37 @@ namespace srilakshmikanthanp::clipbirdesk::utility::functions::internal {
 
 namespace srilakshmikanthanp::clipbirdesk::utility::functions {
 /**
- * @brief Generate a RSA Key Pair and return as QSslKey
+ * @brief Generate a Key Pair and return as QSslKey
+ * @param algorithm - Rsa or Ec (P-256)
  * @param bits - RSA key size
  * @return QPair<QSslKey, QSslKey> - first is private key, second is public key
  */
-QPair<QSslKey, QSslKey> generateQtKeyPair(int bits = 2048);
+QPair<QSslKey, QSslKey> generateQtKeyPair(QSsl::KeyAlgorithm algorithm = QSsl::Ec, int bits = 2048);
 
 /**
- * @brief Get the Q Ssl Configuration object
+ * @brief Get the Q Ssl Configuration object, P-256 keys are generated
+ * by default since they are much faster to create and handshake with
+ * @param algorithm - Rsa or Ec (P-256)
  * @param bits - RSA key size
  * @return QSslConfiguration
  */
-common::types::SslConfig getQSslConfiguration(int bits = 2048);
+common::types::SslConfig getQSslConfiguration(QSsl::KeyAlgorithm algorithm = QSsl::Ec, int bits = 2048);
+
+/**
+ * @brief Detect the algorithm of a private key
+ * @param key - Private Key in PEM format
+ * @return QSsl::KeyAlgorithm - Opaque if the key is unreadable or not
+ * supported by QSslKey
+ */
+QSsl::KeyAlgorithm getKeyAlgorithm(const QByteArray& key);
+
+/**
+ * @brief Load the private key with its detected algorithm so RSA and
+ * EC identities both work
+ * @param key - Private Key in PEM format
+ * @return QSslKey - private key
+ */
+QSslKey getQSslPrivateKey(const QByteArray& key);
 
 /**
  * @brief Generate AES Key
@@ -0,0 +1,73 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Local header files
+#include "clipboard/capturesequence.hpp"
+
+/**
+ * @brief testing that a capture superseded by a change is cancelled and
+ * its result discarded even when it finishes after the newer capture
+ */
+TEST(CaptureSequence, TestingSupersededCaptureIsDiscarded) {
+  // using the CaptureSequence
+  using srilakshmikanthanp::clipbirdesk::clipboard::CaptureSequence;
+
+  CaptureSequence sequence;
+
+  sequence.changed(false);
+  const auto first = sequence.begin();
+
+  // a change while the first capture runs
+  sequence.changed(false);
+  const auto second = sequence.begin();
+
+  EXPECT_TRUE(first.cancelled->load());
+  EXPECT_FALSE(second.cancelled->load());
+
+  // the newer capture finishes first
+  EXPECT_TRUE(sequence.finish(second));
+  EXPECT_FALSE(sequence.finish(first));
+
+  const auto stats = sequence.getStats();
+
+  EXPECT_EQ(stats.changes, 2u);
+  EXPECT_EQ(stats.captures, 2u);
+  EXPECT_EQ(stats.superseded, 1u);
+  EXPECT_EQ(stats.discarded, 1u);
+}
+
+/**
+ * @brief testing that a change after a capture finished neither cancels
+ * nor discards it and that coalesced and unchanged captures are counted
+ */
+TEST(CaptureSequence, TestingFinishedCaptureIsKept) {
+  // using the CaptureSequence
+  using srilakshmikanthanp::clipbirdesk::clipboard::CaptureSequence;
+
+  CaptureSequence sequence;
+
+  // a burst of three changes is captured once
+  sequence.changed(false);
+  sequence.changed(true);
+  sequence.changed(true);
+
+  const auto ticket = sequence.begin();
+  EXPECT_TRUE(sequence.finish(ticket));
+
+  sequence.changed(false);
+  EXPECT_FALSE(ticket.cancelled->load());
+
+  // the content was already synced
+  sequence.unchanged();
+
+  const auto stats = sequence.getStats();
+
+  EXPECT_EQ(stats.changes, 4u);
+  EXPECT_EQ(stats.captures, 1u);
+  EXPECT_EQ(stats.coalesced, 2u);
+  EXPECT_EQ(stats.superseded, 0u);
+  EXPECT_EQ(stats.discarded, 0u);
+  EXPECT_EQ(stats.unchanged, 1u);
+}
@@ -0,0 +1,117 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Standard header files
+#include <string>
+
+// Qt header files
+#include <QBuffer>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QMimeData>
+
+// Local header files
+#include "clipboard/lazymimedata.hpp"
+
+/**
+ * @brief Png of a screenshot sized image with gradients so it does not
+ * compress to almost nothing
+ */
+inline QByteArray lazyMimeDataTestPng(int width, int height) {
+  QImage image(width, height, QImage::Format_ARGB32);
+
+  for (int y = 0; y < height; y++) {
+    auto* line = reinterpret_cast<QRgb*>(image.scanLine(y));
+    for (int x = 0; x < width; x++) {
+      line[x] = qRgba((x * 7) & 0xFF, (y * 3) & 0xFF, (x ^ y) & 0xFF, 0xFF);
+    }
+  }
+
+  QByteArray png;
+  QBuffer buffer(&png);
+  buffer.open(QIODevice::WriteOnly);
+  image.save(&buffer, "PNG");
+  return png;
+}
+
+/**
+ * @brief testing that the payloads are given as they came and the image
+ * is decoded only when it is asked for
+ */
+TEST(LazyMimeData, TestingRetrieveData) {
+  // using the LazyMimeData
+  using srilakshmikanthanp::clipbirdesk::clipboard::LazyMimeData;
+
+  const auto png = lazyMimeDataTestPng(64, 32);
+
+  LazyMimeData mimeData({
+    {"text/html", "<b>Hello</b>"},
+    {"text/plain", "Hello"},
+    {"image/png", png},
+  });
+
+  EXPECT_TRUE(mimeData.hasHtml());
+  EXPECT_TRUE(mimeData.hasText());
+  EXPECT_EQ(mimeData.html(), QString("<b>Hello</b>"));
+  EXPECT_EQ(mimeData.text(), QString("Hello"));
+
+  // encoded bytes are handed out without decoding
+  EXPECT_EQ(mimeData.data("image/png"), png);
+  EXPECT_FALSE(mimeData.isImageDecoded());
+
+  // decoded on the first request
+  const auto image = qvariant_cast<QImage>(mimeData.imageData());
+  EXPECT_TRUE(mimeData.isImageDecoded());
+  EXPECT_EQ(image.size(), QSize(64, 32));
+
+  // unknown types are not offered
+  EXPECT_FALSE(mimeData.hasFormat("image/gif"));
+  EXPECT_TRUE(mimeData.data("image/gif").isEmpty());
+}
+
+/**
+ * @brief Measure the time the gui thread is blocked and the memory held
+ * while receiving a stream of large images, eager decoding as it was done
+ * before against lazy mime data, results are recorded as test properties
+ */
+TEST(LazyMimeData, TestingReceiveCost) {
+  // using the LazyMimeData
+  using srilakshmikanthanp::clipbirdesk::clipboard::LazyMimeData;
+
+  constexpr auto rounds = 10;
+
+  const auto png = lazyMimeDataTestPng(1920, 1080);
+
+  QElapsedTimer timer;
+  qint64 eagerBytes = 0;
+  qint64 lazyBytes  = 0;
+
+  // decode every image as it arrives
+  timer.start();
+  for (auto i = 0; i < rounds; i++) {
+    QMimeData eager;
+    eager.setImageData(QImage::fromData(png, "PNG"));
+    eagerBytes = qvariant_cast<QImage>(eager.imageData()).sizeInBytes();
+  }
+  const auto eagerTime = timer.nsecsElapsed() / rounds;
+
+  // keep the payload until it is pasted
+  timer.restart();
+  for (auto i = 0; i < rounds; i++) {
+    LazyMimeData lazy({{"image/png", png}});
+    lazyBytes = lazy.data("image/png").size();
+    EXPECT_FALSE(lazy.isImageDecoded());
+  }
+  const auto lazyTime = timer.nsecsElapsed() / rounds;
+
+  RecordProperty("eager blocking ns", std::to_string(eagerTime));
+  RecordProperty("lazy blocking ns", std::to_string(lazyTime));
+  RecordProperty("eager held bytes", std::to_string(eagerBytes));
+  RecordProperty("lazy held bytes", std::to_string(lazyBytes));
+
+  EXPECT_LT(lazyTime, eagerTime);
+  EXPECT_LT(lazyBytes, eagerBytes);
+}
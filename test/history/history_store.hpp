@@ -0,0 +1,282 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTemporaryDir>
+
+// Local header files
+#include "history/history_store.hpp"
+
+/**
+ * @brief testing that entries and their items are read back after the
+ * store is opened again, newest first
+ */
+TEST(HistoryStore, TestingEntriesSurviveReopen) {
+  // using the HistoryStore
+  using srilakshmikanthanp::clipbirdesk::history::HistoryStore;
+
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  const QVector<QPair<QString, QByteArray>> first  = {{"text/plain", "first"}};
+  const QVector<QPair<QString, QByteArray>> second = {{"text/plain", "second"}, {"image/png", QByteArray(4096, 'p')}};
+
+  {
+    HistoryStore store(dir.path(), 10);
+    store.append(first, 1, 100);
+    store.append(second, 2, 200);
+  }
+
+  HistoryStore store(dir.path(), 10);
+
+  ASSERT_EQ(store.size(), 2);
+  EXPECT_EQ(store.entryAt(0)->fingerprint, 2);
+  EXPECT_EQ(store.entryAt(0)->timestamp, 200);
+  EXPECT_EQ(store.items(store.entryAt(0)->id), second);
+  EXPECT_EQ(store.items(store.entryAt(1)->id), first);
+  EXPECT_EQ(store.findFingerprint(1)->id, store.entryAt(1)->id);
+
+  // ids keep growing after the reopen
+  const auto third = store.append(first, 3, 300);
+  EXPECT_GT(third.id, store.entryAt(1)->id);
+}
+
+/**
+ * @brief testing that a summary gives the type and full length of every
+ * item but only the start of the text payloads
+ */
+TEST(HistoryStore, TestingSummaryReadsHeadsOnly) {
+  // using the HistoryStore
+  using srilakshmikanthanp::clipbirdesk::history::HistoryStore;
+
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  HistoryStore store(dir.path(), 10);
+
+  const auto text  = QByteArray("Hello World ").repeated(512);
+  const auto image = QByteArray(64 * 1024, 'p');
+  const auto entry = store.append({{"text/plain", text}, {"image/png", image}, {"text/html", "<b>hi</b>"}}, 1, 1);
+
+  const auto summary = store.summary(entry.id, 16);
+
+  ASSERT_EQ(summary.size(), 3);
+  EXPECT_EQ(summary[0].mimeType, "text/plain");
+  EXPECT_EQ(summary[0].length, text.size());
+  EXPECT_EQ(summary[0].head, text.left(16));
+  EXPECT_EQ(summary[1].mimeType, "image/png");
+  EXPECT_EQ(summary[1].length, image.size());
+  EXPECT_TRUE(summary[1].head.isEmpty());
+  EXPECT_EQ(summary[2].head, "<b>hi</b>");
+
+  EXPECT_TRUE(store.summary(entry.id + 1, 16).isEmpty());
+}
+
+/**
+ * @brief testing that the oldest entries beyond the depth and removed
+ * entries stay gone after a reopen, and that an index lost or cut short
+ * by a crash is rebuilt from the segments
+ */
+TEST(HistoryStore, TestingDepthRemoveAndRecovery) {
+  // using the HistoryStore
+  using srilakshmikanthanp::clipbirdesk::history::HistoryStore;
+
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  {
+    HistoryStore store(dir.path(), 3);
+
+    for (quint64 i = 1; i <= 5; i++) {
+      store.append({{"text/plain", QByteArray::number(i)}}, i, qint64(i));
+    }
+
+    EXPECT_EQ(store.size(), 3);
+    EXPECT_EQ(store.entryAt(2)->fingerprint, 3);
+
+    store.remove(store.entryAt(1)->id);
+  }
+
+  {
+    HistoryStore store(dir.path(), 3);
+
+    ASSERT_EQ(store.size(), 2);
+    EXPECT_EQ(store.entryAt(0)->fingerprint, 5);
+    EXPECT_EQ(store.entryAt(1)->fingerprint, 3);
+
+    store.setDepth(1);
+    EXPECT_EQ(store.size(), 1);
+  }
+
+  // half an index record is dropped
+  {
+    QFile index(QDir(dir.path()).filePath("index.dat"));
+    ASSERT_TRUE(index.open(QIODevice::Append));
+    index.write(QByteArray(7, 'x'));
+  }
+
+  {
+    HistoryStore store(dir.path(), 3);
+    ASSERT_EQ(store.size(), 1);
+    EXPECT_EQ(store.items(store.entryAt(0)->id).first().second, "5");
+  }
+
+  // a lost index is rebuilt by scanning the segments, removed and
+  // trimmed records were overwritten so they do not come back
+  ASSERT_TRUE(QFile::remove(QDir(dir.path()).filePath("index.dat")));
+
+  HistoryStore store(dir.path(), 10);
+  ASSERT_EQ(store.size(), 1);
+  EXPECT_EQ(store.entryAt(0)->fingerprint, 5);
+}
+
+/**
+ * @brief testing that the payload of a removed or trimmed entry is no
+ * longer in any segment file
+ */
+TEST(HistoryStore, TestingRemovedPayloadIsOverwritten) {
+  // using the HistoryStore
+  using srilakshmikanthanp::clipbirdesk::history::HistoryStore;
+
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  const auto segmentsContain = [&](const QByteArray& needle) {
+    for (const auto& name : QDir(dir.path()).entryList({"segment-*.dat"}, QDir::Files)) {
+      QFile file(QDir(dir.path()).filePath(name));
+      if (file.open(QIODevice::ReadOnly) && file.readAll().contains(needle)) return true;
+    }
+
+    return false;
+  };
+
+  HistoryStore store(dir.path(), 2);
+
+  const auto removed = store.append({{"text/plain", "my secret password"}}, 1, 1);
+  store.append({{"text/plain", "an old note"}}, 2, 2);
+
+  ASSERT_TRUE(segmentsContain("my secret password"));
+
+  store.remove(removed.id);
+  EXPECT_FALSE(segmentsContain("my secret password"));
+
+  // the oldest entry beyond the depth is trimmed the same way
+  store.append({{"text/plain", "first new note"}}, 3, 3);
+  store.append({{"text/plain", "second new note"}}, 4, 4);
+  EXPECT_FALSE(segmentsContain("an old note"));
+
+  // live entries are untouched
+  EXPECT_TRUE(segmentsContain("second new note"));
+  EXPECT_EQ(store.items(store.entryAt(1)->id).first().second, "first new note");
+}
+
+/**
+ * @brief testing that a store without a directory keeps its entries in
+ * memory with the same behaviour
+ */
+TEST(HistoryStore, TestingMemoryOnlyStore) {
+  // using the HistoryStore
+  using srilakshmikanthanp::clipbirdesk::history::HistoryStore;
+
+  HistoryStore store(2);
+
+  const auto first = store.append({{"text/plain", "first"}}, 1, 1);
+  store.append({{"text/plain", "second"}}, 2, 2);
+  store.append({{"text/plain", "third"}, {"image/png", QByteArray(64, 'p')}}, 3, 3);
+
+  ASSERT_EQ(store.size(), 2);
+  EXPECT_TRUE(store.items(first.id).isEmpty());
+  EXPECT_EQ(store.items(store.entryAt(0)->id).size(), 2);
+  EXPECT_EQ(store.items(store.entryAt(1)->id).first().second, "second");
+
+  store.remove(store.entryAt(1)->id);
+  EXPECT_EQ(store.size(), 1);
+  EXPECT_EQ(store.segmentCount(), 0);
+}
+
+/**
+ * @brief testing that segments left mostly removed are compacted and
+ * the entries in them are still read after the compaction
+ */
+TEST(HistoryStore, TestingCompactionReclaimsSegments) {
+  // using the HistoryStore
+  using srilakshmikanthanp::clipbirdesk::history::HistoryStore;
+
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  const auto payload = QByteArray(1024, 'c');
+
+  {
+    // every segment takes two entries
+    HistoryStore store(dir.path(), 100, 2 * 1024);
+
+    for (quint64 i = 1; i <= 20; i++) {
+      store.append({{"text/plain", payload + QByteArray::number(i)}}, i, qint64(i));
+    }
+
+    store.waitForCompaction();
+    const auto before = store.segmentCount();
+
+    // drop all but every fourth entry
+    for (quint64 i = 1; i <= 20; i++) {
+      if (i % 4 != 0) store.remove(store.findFingerprint(i)->id);
+    }
+
+    store.compact();
+
+    EXPECT_LT(store.segmentCount(), before);
+    ASSERT_EQ(store.size(), 5);
+  }
+
+  HistoryStore store(dir.path(), 100, 2 * 1024);
+
+  ASSERT_EQ(store.size(), 5);
+
+  for (qsizetype i = 0; i < store.size(); i++) {
+    const auto entry = store.entryAt(i).value();
+    EXPECT_EQ(store.items(entry.id).first().second, payload + QByteArray::number(entry.fingerprint));
+  }
+}
+
+/**
+ * @brief testing that opening a deep history reads only the index, the
+ * time to open ten thousand entries is recorded as a property
+ */
+TEST(HistoryStore, TestingOpenLoadsMetadataOnly) {
+  // using the HistoryStore
+  using srilakshmikanthanp::clipbirdesk::history::HistoryStore;
+
+  QTemporaryDir dir;
+  ASSERT_TRUE(dir.isValid());
+
+  constexpr quint64 count = 10000;
+  const auto payload      = QByteArray(512, 'm');
+
+  {
+    HistoryStore store(dir.path(), count);
+
+    for (quint64 i = 1; i <= count; i++) {
+      store.append({{"text/plain", payload}}, i, qint64(i));
+    }
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+
+  HistoryStore store(dir.path(), count);
+
+  const auto openTime = timer.elapsed();
+
+  RecordProperty("open ms", std::to_string(openTime));
+
+  ASSERT_EQ(store.size(), qsizetype(count));
+  EXPECT_EQ(store.entryAt(0)->fingerprint, count);
+  EXPECT_EQ(store.items(store.entryAt(qsizetype(count) - 1)->id).first().second, payload);
+}
@@ -0,0 +1,173 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+
+// Local header files
+#include "history/search_index.hpp"
+
+/**
+ * @brief testing substring and prefix queries over plain text and html,
+ * newest entries first, and that removed entries are not found
+ */
+TEST(SearchIndex, TestingSubstringAndPrefixQueries) {
+  // using the SearchIndex
+  using srilakshmikanthanp::clipbirdesk::history::SearchIndex;
+
+  SearchIndex index;
+
+  index.add(1, {{"text/plain", "Meeting notes for Monday"}});
+  index.add(2, {{"text/html", "<p>The <b>monthly</b> report &amp; summary</p>"}});
+  index.add(3, {{"image/png", QByteArray(16, 'x')}});
+  index.add(4, {{"text/plain", "Mon"}});
+
+  EXPECT_EQ(index.size(), 3);
+
+  // case is folded and the html tags are not text
+  EXPECT_EQ(index.search("mon"), QVector<quint64>({4, 2, 1}));
+  EXPECT_EQ(index.search("MONTHLY REPORT"), QVector<quint64>({2}));
+  EXPECT_EQ(index.search("report & sum"), QVector<quint64>({2}));
+  EXPECT_TRUE(index.search("<b>").isEmpty());
+
+  // only matches at the start of a word
+  EXPECT_EQ(index.search("day", SearchIndex::Match::Substring), QVector<quint64>({1}));
+  EXPECT_TRUE(index.search("day", SearchIndex::Match::Prefix).isEmpty());
+  EXPECT_EQ(index.search("note", SearchIndex::Match::Prefix), QVector<quint64>({1}));
+
+  // queries shorter than a trigram
+  EXPECT_EQ(index.search("mo", SearchIndex::Match::Prefix), QVector<quint64>({4, 2, 1}));
+  EXPECT_EQ(index.search("").size(), 3);
+
+  index.remove(2);
+  EXPECT_EQ(index.search("mon"), QVector<quint64>({4, 1}));
+
+  index.removeOlderThan(4);
+  EXPECT_EQ(index.search("mon"), QVector<quint64>({4}));
+  EXPECT_EQ(index.size(), 1);
+}
+
+/**
+ * @brief testing that removed entries stay out of the results while the
+ * lists still hold them and after the lists are rebuilt, and that an
+ * entry added again is found once
+ */
+TEST(SearchIndex, TestingRemovalsAndReadding) {
+  // using the SearchIndex
+  using srilakshmikanthanp::clipbirdesk::history::SearchIndex;
+
+  SearchIndex index;
+
+  for (quint64 id = 1; id <= 300; id++) {
+    index.add(id, {{"text/plain", "entry number " + QByteArray::number(id)}});
+  }
+
+  // a few removals leave the lists as they are
+  index.remove(150);
+  EXPECT_TRUE(index.search("number 150").isEmpty());
+  EXPECT_EQ(index.search("number 15").size(), 10);
+
+  // back with other text, older than the newest entry
+  index.add(150, {{"text/plain", "entry moved"}});
+  EXPECT_EQ(index.search("moved"), QVector<quint64>({150}));
+  EXPECT_EQ(index.search("entry").size(), 300);
+
+  // most of the entries go so the lists are rebuilt
+  index.removeOlderThan(291);
+  EXPECT_EQ(index.size(), 10);
+  EXPECT_TRUE(index.search("moved").isEmpty());
+  EXPECT_EQ(index.search("number").first(), 300);
+  EXPECT_EQ(index.search("number").size(), 10);
+}
+
+/**
+ * @brief testing that text past the indexed start of a long entry is
+ * found through the loader, and of a partially added entry as well
+ */
+TEST(SearchIndex, TestingLongEntries) {
+  // using the SearchIndex
+  using srilakshmikanthanp::clipbirdesk::history::SearchIndex;
+
+  // using the constants
+  using srilakshmikanthanp::clipbirdesk::constants::getAppSearchTextLength;
+
+  // clipboard items
+  using Items = QVector<QPair<QString, QByteArray>>;
+
+  const auto length = qsizetype(getAppSearchTextLength());
+  const Items longItems = {{"text/plain", QByteArray(length, 'a') + " tail word"}};
+  const Items partItems = {{"text/plain", QByteArray(length, 'b') + " tail end"}};
+
+  SearchIndex index;
+  index.add(1, longItems);
+  index.add(2, {{"text/plain", "short tail"}});
+  index.add(3, {{"text/plain", partItems[0].second.left(length)}}, true);
+
+  const auto loader = [&](quint64 id) {
+    return id == 1 ? longItems : id == 3 ? partItems : Items();
+  };
+
+  // only the start is searched without the loader
+  EXPECT_EQ(index.search("tail"), QVector<quint64>({2}));
+
+  EXPECT_EQ(index.search("tail", SearchIndex::Match::Substring, loader), QVector<quint64>({3, 2, 1}));
+  EXPECT_EQ(index.search("word", SearchIndex::Match::Prefix, loader), QVector<quint64>({1}));
+  EXPECT_EQ(index.search("nd", SearchIndex::Match::Substring, loader), QVector<quint64>({3}));
+  EXPECT_TRUE(index.search("missing", SearchIndex::Match::Substring, loader).isEmpty());
+
+  // removed entries are not read again
+  index.remove(1);
+  EXPECT_EQ(index.search("tail", SearchIndex::Match::Substring, loader), QVector<quint64>({3, 2}));
+}
+
+/**
+ * @brief testing the time of a query and the memory of the index over
+ * fifty thousand entries, both are recorded as properties
+ */
+TEST(SearchIndex, TestingQueryTimeOverLargeHistory) {
+  // using the SearchIndex
+  using srilakshmikanthanp::clipbirdesk::history::SearchIndex;
+
+  SearchIndex index;
+  QRandomGenerator random(42);
+
+  const QVector<QByteArray> words = {
+    "clipboard", "history", "server", "client", "device", "network", "packet",
+    "sync", "image", "text", "search", "index", "window", "tray", "setting",
+  };
+
+  constexpr quint64 count = 50000;
+
+  for (quint64 id = 1; id <= count; id++) {
+    QByteArray text;
+
+    for (int i = 0; i < 24; i++) {
+      text += words[random.bounded(words.size())] + ' ';
+    }
+
+    // one entry in a thousand has the needle
+    if (id % 1000 == 0) text += "needle";
+
+    index.add(id, {{"text/plain", text}});
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+
+  const auto results = index.search("needle");
+
+  const auto queryTime = timer.nsecsElapsed() / 1000;
+
+  RecordProperty("query us", std::to_string(queryTime));
+  RecordProperty("memory bytes", std::to_string(index.memoryUsage()));
+
+  // text is about 200 bytes an entry, postings take a byte or two each
+  EXPECT_LT(index.memoryUsage(), 32 * 1024 * 1024);
+
+  EXPECT_EQ(results.size(), qsizetype(count / 1000));
+  EXPECT_EQ(results.first(), count);
+}
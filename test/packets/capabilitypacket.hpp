@@ -0,0 +1,39 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+
+// Local header files
+#include "packets/capabilitypacket/capabilitypacket.hpp"
+#include "utility/functions/compression/compression.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the CapabilityPacket
+ */
+TEST(CapabilityPacket, TestingCapabilityPacket) {
+  // using the CapabilityPacket
+  using srilakshmikanthanp::clipbirdesk::packets::CapabilityPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // creating the packet
+  CapabilityPacket packet_send, packet_recv;
+
+  // create packet
+  packet_send = createPacket(params::CapabilityPacketParams{getSupportedEncodings()});
+
+  // to network byte order
+  packet_recv = fromQByteArray<CapabilityPacket>(toQByteArray(packet_send));
+
+  // check the packet length
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.getPacketLength());
+
+  // check the encodings
+  EXPECT_EQ(packet_recv.getEncodings(), getSupportedEncodings());
+}
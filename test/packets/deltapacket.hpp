@@ -0,0 +1,74 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QUuid>
+
+// Local header files
+#include "common/types/exceptions/exceptions.hpp"
+#include "packets/deltapacket/deltapacket.hpp"
+#include "syncing/content_store/content_store.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the DeltaPacket
+ */
+TEST(DeltaPacket, TestingDeltaPacket) {
+  // using the DeltaPacket
+  using srilakshmikanthanp::clipbirdesk::packets::DeltaPacket;
+
+  // using the DeltaItem
+  using srilakshmikanthanp::clipbirdesk::packets::DeltaItem;
+
+  // using the DeltaOp
+  using srilakshmikanthanp::clipbirdesk::packets::DeltaOp;
+
+  // using the ContentStore
+  using srilakshmikanthanp::clipbirdesk::syncing::ContentStore;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // creating the packet
+  DeltaPacket packet_send, packet_recv;
+
+  // item rebuilt from a base
+  DeltaItem item;
+  item.setMimeType("text/plain");
+  item.setBaseHash(ContentStore::hash("Hello World"));
+  item.setTargetLength(16);
+  item.setOps({DeltaOp{0, 11, QByteArray(" Bird")}});
+
+  // create packet
+  const auto originId = QUuid::createUuid();
+  packet_send = createPacket(params::DeltaPacketParams{{item}, originId, 7});
+
+  // to network byte order
+  packet_recv = fromQByteArray<DeltaPacket>(toQByteArray(packet_send));
+
+  // check the packet length
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.getPacketLength());
+
+  // check the origin and sequence
+  EXPECT_EQ(packet_recv.getOriginId(), originId);
+  EXPECT_EQ(packet_recv.getSequence(), 7);
+
+  // check the item
+  ASSERT_EQ(packet_recv.getItemCount(), 1);
+  const auto recv = packet_recv.getItems().first();
+  EXPECT_EQ(recv.getMimeType(), item.getMimeType());
+  EXPECT_EQ(recv.getBaseHash(), item.getBaseHash());
+  EXPECT_EQ(recv.getTargetLength(), item.getTargetLength());
+  ASSERT_EQ(recv.getOps().size(), 1);
+  EXPECT_EQ(recv.getOps().first().copyOffset, 0);
+  EXPECT_EQ(recv.getOps().first().copyLength, 11);
+  EXPECT_EQ(recv.getOps().first().literal, QByteArray(" Bird"));
+
+  // trailing bytes are rejected
+  auto bytes = toQByteArray(packet_send) + QByteArray(1, '\0');
+  EXPECT_ANY_THROW(fromQByteArray<DeltaPacket>(bytes));
+}
@@ -0,0 +1,92 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QBuffer>
+#include <QByteArray>
+
+// Local header files
+#include "packets/frame_decoder/frame_decoder.hpp"
+#include "packets/pingpongpacket/pingpongpacket.hpp"
+#include "packets/syncingpacket/syncingpacket.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the FrameDecoder with frames in one write
+ */
+TEST(FrameDecoder, TestingConcatenatedFrames) {
+  // using the packets
+  using srilakshmikanthanp::clipbirdesk::packets::FrameDecoder;
+  using srilakshmikanthanp::clipbirdesk::packets::PingPongPacket;
+  using srilakshmikanthanp::clipbirdesk::packets::SyncingPacket;
+
+  // using the PingType
+  using srilakshmikanthanp::clipbirdesk::common::types::enums::PingType;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // constant values
+  const auto frameCount = 1000;
+  const auto ping       = toQByteArray(createPacket(params::PingPacketParams{PingType::Ping}));
+  const auto sync       = toQByteArray(createPacket(params::SyncingPacketParams{{{"text/plain", "Hello World"}}}));
+
+  // write all the frames at once
+  QBuffer device;
+  device.open(QIODevice::ReadWrite);
+
+  for (auto i = 0; i < frameCount; i++) {
+    device.write(i % 2 ? sync : ping);
+  }
+
+  device.seek(0);
+
+  // decode in a single read
+  FrameDecoder decoder;
+  decoder.append(device.readAll());
+
+  auto count = 0;
+
+  while (auto frame = decoder.next()) {
+    EXPECT_EQ(frame.value(), count % 2 ? sync : ping);
+    count++;
+  }
+
+  // check all frames are delivered
+  EXPECT_EQ(count, frameCount);
+  EXPECT_EQ(decoder.bufferedBytes(), 0);
+}
+
+/**
+ * @brief testing the FrameDecoder with a frame split across reads
+ */
+TEST(FrameDecoder, TestingPartialFrames) {
+  // using the packets
+  using srilakshmikanthanp::clipbirdesk::packets::FrameDecoder;
+  using srilakshmikanthanp::clipbirdesk::common::types::exceptions::MalformedPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // constant values
+  const auto sync = toQByteArray(createPacket(params::SyncingPacketParams{{{"text/plain", "Hello World"}}}));
+
+  FrameDecoder decoder;
+
+  // first half of the frame is not enough
+  decoder.append(sync.left(sync.size() / 2));
+  EXPECT_FALSE(decoder.next().has_value());
+
+  // second half completes the frame
+  decoder.append(sync.mid(sync.size() / 2));
+  EXPECT_EQ(decoder.next().value(), sync);
+  EXPECT_FALSE(decoder.next().has_value());
+
+  // length smaller than the header is malformed
+  decoder.append(QByteArray::fromHex("00000002"));
+  EXPECT_THROW(decoder.next(), MalformedPacket);
+}
@@ -0,0 +1,92 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QUuid>
+
+// Local header files
+#include "packets/offerpacket/offerpacket.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the OfferPacket
+ */
+TEST(OfferPacket, TestingOfferPacket) {
+  // using the OfferPacket
+  using srilakshmikanthanp::clipbirdesk::packets::OfferPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // constant values
+  const auto payload  = QByteArray(64 * 1024, 'x');
+  const auto hash     = QCryptographicHash::hash(payload, QCryptographicHash::Sha256);
+  const auto originId = QUuid::createUuid();
+
+  // create packet
+  auto packet_send = createPacket(params::OfferPacketParams{{{"image/png", payload}}, {hash}, originId, 42});
+
+  // to network byte order
+  auto frame       = toQByteArray(packet_send);
+  auto packet_recv = fromQByteArray<OfferPacket>(frame);
+
+  // the offer is a few dozen bytes whatever the payload size
+  EXPECT_LT(frame.size(), 100);
+
+  // check the fields
+  EXPECT_EQ(packet_recv.getPacketLength(), frame.size());
+  EXPECT_EQ(packet_recv.getOriginId(), originId);
+  EXPECT_EQ(packet_recv.getSequence(), 42u);
+  EXPECT_EQ(packet_recv.getItemCount(), 1u);
+
+  // check the item
+  const auto item = packet_recv.getItems().first();
+
+  EXPECT_EQ(item.getMimeType(), "image/png");
+  EXPECT_EQ(item.getPayloadLength(), quint64(payload.size()));
+  EXPECT_EQ(item.getHash(), hash);
+}
+
+/**
+ * @brief testing the NeedPacket
+ */
+TEST(OfferPacket, TestingNeedPacket) {
+  // using the NeedPacket
+  using srilakshmikanthanp::clipbirdesk::packets::NeedPacket;
+
+  // using the MalformedPacket
+  using srilakshmikanthanp::clipbirdesk::common::types::exceptions::MalformedPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // constant values
+  const auto first    = QCryptographicHash::hash("first", QCryptographicHash::Sha256);
+  const auto second   = QCryptographicHash::hash("second", QCryptographicHash::Sha256);
+  const auto originId = QUuid::createUuid();
+
+  // create packet
+  auto packet_send = createPacket(params::NeedPacketParams{{first, second}, originId, 42});
+
+  // to network byte order
+  auto frame       = toQByteArray(packet_send);
+  auto packet_recv = fromQByteArray<NeedPacket>(frame);
+
+  // check the fields
+  EXPECT_EQ(packet_recv.getPacketLength(), frame.size());
+  EXPECT_EQ(packet_recv.getOriginId(), originId);
+  EXPECT_EQ(packet_recv.getSequence(), 42u);
+  EXPECT_EQ(packet_recv.getHashes(), QVector<QByteArray>({first, second}));
+
+  // truncated hash is malformed
+  frame.chop(1);
+  frame[3] = char(frame.size());
+
+  EXPECT_THROW(NeedPacket::fromBytes(frame), MalformedPacket);
+}
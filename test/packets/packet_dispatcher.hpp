@@ -0,0 +1,66 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+
+// Local header files
+#include "packets/packet_dispatcher/packet_dispatcher.hpp"
+#include "packets/pingpongpacket/pingpongpacket.hpp"
+#include "packets/syncingpacket/syncingpacket.hpp"
+#include "common/types/enums/enums.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the PacketDispatcher
+ */
+TEST(PacketDispatcher, TestingPacketDispatcher) {
+  // using the packets
+  using srilakshmikanthanp::clipbirdesk::packets::PacketDispatcher;
+  using srilakshmikanthanp::clipbirdesk::packets::PacketType;
+  using srilakshmikanthanp::clipbirdesk::packets::PingPongPacket;
+  using srilakshmikanthanp::clipbirdesk::packets::SyncingPacket;
+
+  // using the PingType
+  using srilakshmikanthanp::clipbirdesk::common::types::enums::PingType;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // create the dispatcher
+  PacketDispatcher<> dispatcher;
+
+  // count of decoded packets
+  int pings = 0, syncs = 0;
+
+  // register the packets
+  dispatcher.registerPacket<PingPongPacket>(PacketType::PING_PONG_PACKET, [&](const PingPongPacket &packet) {
+    EXPECT_EQ(packet.getPingType(), PingType::Ping);
+    pings++;
+  });
+
+  dispatcher.registerPacket<SyncingPacket>(PacketType::SYNCING_PACKET, [&](const SyncingPacket &) {
+    syncs++;
+  });
+
+  // create the ping frame
+  const auto frame = toQByteArray(createPacket(params::PingPacketParams{PingType::Ping}));
+
+  // dispatch a second worth of pings
+  for (auto i = 0; i < 10000; i++) {
+    EXPECT_TRUE(dispatcher.dispatch(frame));
+  }
+
+  // check only the ping decoder was called
+  EXPECT_EQ(pings, 10000);
+  EXPECT_EQ(syncs, 0);
+
+  // unregistered type is not dispatched
+  const auto invalid = toQByteArray(createPacket(params::InvalidPacketParams{0x01, "Coding Error"}));
+  EXPECT_FALSE(dispatcher.dispatch(invalid));
+
+  // frame shorter than the header is not dispatched
+  EXPECT_FALSE(dispatcher.dispatch(frame.left(6)));
+}
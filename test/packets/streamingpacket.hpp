@@ -0,0 +1,124 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QString>
+#include <QUuid>
+
+// Local header files
+#include "packets/streamingpacket/streamingpacket.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+#include "utility/functions/nbytes/nbytes.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the StreamBeginPacket
+ */
+TEST(StreamingPacket, TestingStreamBeginPacket) {
+  // using the StreamBeginPacket
+  using srilakshmikanthanp::clipbirdesk::packets::StreamBeginPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // using the Encoding
+  using srilakshmikanthanp::clipbirdesk::common::types::enums::Encoding;
+
+  // constant values, larger than the quint32 length of a SyncingPacket
+  const auto mimeType    = QString("text/plain");
+  const auto totalLength = quint64(5) * 1024 * 1024 * 1024;
+
+  // create packet
+  auto packet_send = createPacket(params::StreamBeginParams{7, 1, totalLength, mimeType, Encoding::Deflate});
+
+  // to network byte order
+  auto packet_recv = fromQByteArray<StreamBeginPacket>(toQByteArray(packet_send));
+
+  // check the fields
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.getPacketLength());
+  EXPECT_EQ(packet_recv.getTransferId(), 7u);
+  EXPECT_EQ(packet_recv.getItemId(), 1u);
+  EXPECT_EQ(packet_recv.getTotalLength(), totalLength);
+  EXPECT_EQ(packet_recv.getMimeType(), mimeType.toUtf8());
+  EXPECT_EQ(packet_recv.getEncoding(), Encoding::Deflate);
+}
+
+/**
+ * @brief testing the StreamChunkPacket
+ */
+TEST(StreamingPacket, TestingStreamChunkPacket) {
+  // using the StreamChunkPacket
+  using srilakshmikanthanp::clipbirdesk::packets::StreamChunkPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // constant values
+  const auto payload = QByteArray(64 * 1024, 'x');
+  const auto offset  = quint64(3) * 64 * 1024;
+
+  // create packet
+  auto packet_send = createPacket(params::StreamChunkParams{7, 0, offset, payload});
+
+  // to network byte order
+  auto packet_recv = fromQByteArray<StreamChunkPacket>(toQByteArray(packet_send));
+
+  // check the fields
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.getPacketLength());
+  EXPECT_EQ(packet_recv.getTransferId(), 7u);
+  EXPECT_EQ(packet_recv.getItemId(), 0u);
+  EXPECT_EQ(packet_recv.getOffset(), offset);
+  EXPECT_EQ(packet_recv.getPayload(), payload);
+}
+
+/**
+ * @brief testing the StreamChunkPacket with a truncated payload
+ */
+TEST(StreamingPacket, TestingTruncatedStreamChunkPacket) {
+  // using the StreamChunkPacket
+  using srilakshmikanthanp::clipbirdesk::packets::StreamChunkPacket;
+
+  // using the MalformedPacket
+  using srilakshmikanthanp::clipbirdesk::common::types::exceptions::MalformedPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // create packet and drop the last byte
+  auto frame = toQByteArray(createPacket(params::StreamChunkParams{7, 0, 0, QByteArray(128, 'x')}));
+  frame.chop(1);
+
+  // should throw
+  EXPECT_THROW(StreamChunkPacket::fromBytes(frame), MalformedPacket);
+}
+
+/**
+ * @brief testing the StreamEndPacket
+ */
+TEST(StreamingPacket, TestingStreamEndPacket) {
+  // using the StreamEndPacket
+  using srilakshmikanthanp::clipbirdesk::packets::StreamEndPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // origin of the streamed items
+  const auto originId = QUuid::createUuid();
+
+  // create packet
+  auto packet_send = createPacket(params::StreamEndParams{7, 2, originId, 42});
+
+  // to network byte order
+  auto packet_recv = fromQByteArray<StreamEndPacket>(toQByteArray(packet_send));
+
+  // check the fields
+  EXPECT_EQ(packet_recv.getPacketLength(), packet_send.getPacketLength());
+  EXPECT_EQ(packet_recv.getTransferId(), 7u);
+  EXPECT_EQ(packet_recv.getItemCount(), 2u);
+  EXPECT_EQ(packet_recv.getOriginId(), originId);
+  EXPECT_EQ(packet_recv.getSequence(), 42u);
+}
@@ -5,6 +5,7 @@
 
 // Qt header files
 #include <QByteArray>
+#include <QUuid>
 
 // Local header files
 #include "packets/syncingpacket/syncingpacket.hpp"
@@ -39,8 +40,11 @@ TEST(SyncingPacket, TestingSyncingPacket) {
     items.push_back({mimeType, payload});
   }
 
+  // origin of the items
+  const auto originId = QUuid::createUuid();
+
   // setting the packet type
-  packet_send = createPacket({items});
+  packet_send = createPacket({items, originId, 42});
 
   // load the packet from network byte order
   packet_recv = fromQByteArray<SyncingPacket>(toQByteArray(packet_send));
@@ -48,6 +52,10 @@ TEST(SyncingPacket, TestingSyncingPacket) {
   // check the packet length
   EXPECT_EQ(packet_recv.getPacketLength(), packet_send.getPacketLength());
 
+  // check the origin and sequence
+  EXPECT_EQ(packet_recv.getOriginId(), originId);
+  EXPECT_EQ(packet_recv.getSequence(), 42u);
+
   // check the item count
   EXPECT_EQ(packet_recv.getItemCount(), itemCount);
 
@@ -66,3 +74,42 @@ TEST(SyncingPacket, TestingSyncingPacket) {
     EXPECT_EQ(item.getPayload(), payload);
   }
 }
+
+/**
+ * @brief testing the SyncingPacket with the legacy layout
+ */
+TEST(SyncingPacket, TestingLegacySyncingPacket) {
+  // using the ClipboardSyncPacket
+  using srilakshmikanthanp::clipbirdesk::packets::SyncingPacket;
+
+  // using the PacketType
+  using srilakshmikanthanp::clipbirdesk::packets::PacketType;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // creating the packet
+  SyncingPacket packet_send, packet_recv;
+
+  // constant values
+  const auto mimeType   = QByteArray("text/plain", 10);
+  const auto payload    = QByteArray("Hello World", 11);
+
+  // legacy packet for a peer that did not announce
+  packet_send = createPacket(params::SyncingPacketParams{.items = {{mimeType, payload}}, .originId = QUuid::createUuid(), .sequence = 42, .stamped = false});
+
+  // load the packet from network byte order
+  const auto bytes = toQByteArray(packet_send);
+  packet_recv = fromQByteArray<SyncingPacket>(bytes);
+
+  // check the packet
+  EXPECT_EQ(bytes.size(), packet_send.getPacketLength());
+  EXPECT_EQ(packet_recv.getPacketType(), PacketType::SYNCING_PACKET);
+  EXPECT_FALSE(packet_recv.isStamped());
+  EXPECT_TRUE(packet_recv.getOriginId().isNull());
+  EXPECT_EQ(packet_recv.getSequence(), 0u);
+
+  // check the items
+  EXPECT_EQ(packet_recv.getItemCount(), 1);
+  EXPECT_EQ(packet_recv.getItems()[0].getPayload(), payload);
+}
@@ -0,0 +1,158 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QUuid>
+
+// Local header files
+#include "packets/syncingpacket/syncingpacket.hpp"
+#include "packets/syncingpacket/syncingpacketview.hpp"
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+#include "utility/functions/compression/compression.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+/**
+ * @brief testing the SyncingPacketView
+ */
+TEST(SyncingPacketView, TestingSyncingPacketView) {
+  // using the SyncingPacketView
+  using srilakshmikanthanp::clipbirdesk::packets::SyncingPacketView;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // constant values
+  const auto html  = QByteArray("<b>Hello World</b>");
+  const auto text  = QByteArray("Hello World");
+
+  // origin of the items
+  const auto originId = QUuid::createUuid();
+
+  // create the frame
+  const auto frame = toQByteArray(createPacket(params::SyncingPacketParams{{{"text/html", html}, {"text/plain", text}}, originId, 42}));
+
+  // load the view
+  const auto view  = fromQByteArray<SyncingPacketView>(frame);
+
+  // check the packet
+  EXPECT_EQ(view.getPacketLength(), frame.size());
+  EXPECT_EQ(view.getOriginId(), originId);
+  EXPECT_EQ(view.getSequence(), 42u);
+  EXPECT_EQ(view.getItemCount(), 2);
+  EXPECT_EQ(view.toBytes(), frame);
+
+  // check the items
+  const auto items = view.getItems();
+
+  EXPECT_EQ(items[0].first, "text/html");
+  EXPECT_EQ(items[0].second, html);
+  EXPECT_EQ(items[1].first, "text/plain");
+  EXPECT_EQ(items[1].second, text);
+
+  // the view points into the frame buffer
+  EXPECT_EQ(view.getPayloadView(1).constData(), frame.constData() + frame.size() - text.size());
+
+  // the payload owns its bytes and is terminated
+  EXPECT_NE(items[1].second.constData(), view.getPayloadView(1).constData());
+  EXPECT_EQ(items[1].second.constData()[text.size()], '\0');
+}
+
+/**
+ * @brief testing the SyncingPacketView with compressed items
+ */
+TEST(SyncingPacketView, TestingCompressedSyncingPacketView) {
+  // using the SyncingPacketView
+  using srilakshmikanthanp::clipbirdesk::packets::SyncingPacketView;
+
+  // using the Encoding
+  using srilakshmikanthanp::clipbirdesk::common::types::enums::Encoding;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // html is compressed while png is sent as it is
+  const auto html = QByteArray("<p>Hello World</p>").repeated(256);
+  const auto png  = QByteArray("\x89PNG\r\n\x1a\n").repeated(256);
+
+  // create the frame for a peer accepting deflate
+  const auto frame = toQByteArray(createPacket(params::SyncingPacketParams{{{"text/html", html}, {"image/png", png}}, QUuid::createUuid(), 1, getSupportedEncodings()}));
+
+  // load the view
+  const auto view  = fromQByteArray<SyncingPacketView>(frame);
+
+  // check the encodings
+  EXPECT_EQ(view.getEncoding(0), Encoding::Deflate);
+  EXPECT_EQ(view.getEncoding(1), Encoding::Identity);
+  EXPECT_EQ(view.getEncodings(), getSupportedEncodings());
+  EXPECT_LT(frame.size(), html.size() + png.size());
+
+  // check the decoded items
+  const auto items = view.getItems();
+
+  EXPECT_EQ(items[0].second, html);
+  EXPECT_EQ(items[1].second, png);
+}
+
+/**
+ * @brief testing the SyncingPacketView with the legacy layout
+ */
+TEST(SyncingPacketView, TestingLegacySyncingPacketView) {
+  // using the SyncingPacketView
+  using srilakshmikanthanp::clipbirdesk::packets::SyncingPacketView;
+
+  // using the PacketType
+  using srilakshmikanthanp::clipbirdesk::packets::PacketType;
+
+  // using the Encoding
+  using srilakshmikanthanp::clipbirdesk::common::types::enums::Encoding;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // large enough to be compressed for a peer accepting deflate
+  const auto html = QByteArray("<p>Hello World</p>").repeated(256);
+
+  // create the frame for a peer that did not announce
+  const auto frame = toQByteArray(createPacket(params::SyncingPacketParams{.items = {{"text/html", html}}, .originId = QUuid::createUuid(), .sequence = 1, .encodings = getSupportedEncodings(), .stamped = false}));
+
+  // no origin, sequence and encoding on the wire
+  EXPECT_EQ(frame.size(), 4 + 4 + 4 + 4 + 9 + 4 + html.size());
+
+  // load the view
+  const auto view  = fromQByteArray<SyncingPacketView>(frame);
+
+  // check the packet
+  EXPECT_EQ(view.getPacketType(), PacketType::SYNCING_PACKET);
+  EXPECT_FALSE(view.isStamped());
+  EXPECT_TRUE(view.getOriginId().isNull());
+  EXPECT_EQ(view.getSequence(), 0u);
+  EXPECT_EQ(view.getEncoding(0), Encoding::Identity);
+  EXPECT_EQ(view.toBytes(), frame);
+
+  // check the items
+  EXPECT_EQ(view.getItems()[0].second, html);
+}
+
+/**
+ * @brief testing the SyncingPacketView with truncated frame
+ */
+TEST(SyncingPacketView, TestingMalformedSyncingPacketView) {
+  // using the SyncingPacketView
+  using srilakshmikanthanp::clipbirdesk::packets::SyncingPacketView;
+
+  // using the MalformedPacket
+  using srilakshmikanthanp::clipbirdesk::common::types::exceptions::MalformedPacket;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // create the frame
+  const auto frame = toQByteArray(createPacket(params::SyncingPacketParams{{{"text/plain", "Hello World"}}}));
+
+  // truncated frame is malformed
+  EXPECT_THROW(fromQByteArray<SyncingPacketView>(frame.left(frame.size() - 1)), MalformedPacket);
+}
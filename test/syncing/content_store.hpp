@@ -0,0 +1,45 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+
+// Local header files
+#include "syncing/content_store/content_store.hpp"
+
+/**
+ * @brief testing that payloads are found by hash and the least
+ * recently used are evicted once the store is full
+ */
+TEST(ContentStore, TestingLeastRecentlyUsedEviction) {
+  // using the ContentStore
+  using srilakshmikanthanp::clipbirdesk::syncing::ContentStore;
+
+  ContentStore store(3 * 1024);
+
+  const auto first  = QByteArray(1024, 'a');
+  const auto second = QByteArray(1024, 'b');
+  const auto third  = QByteArray(1024, 'c');
+
+  const auto hashes = store.putItems({{"text/plain", first}, {"text/plain", second}});
+
+  EXPECT_EQ(hashes.size(), 2);
+  EXPECT_EQ(hashes[0], ContentStore::hash(first));
+  EXPECT_EQ(store.get(hashes[0]), first);
+
+  // second is now the least recently used
+  store.put(ContentStore::hash(third), third);
+  store.put(ContentStore::hash("d"), QByteArray(1024, 'd'));
+
+  EXPECT_TRUE(store.contains(hashes[0]));
+  EXPECT_FALSE(store.contains(hashes[1]));
+  EXPECT_TRUE(store.get(hashes[1]).isNull());
+
+  // payloads larger than the store are not kept
+  const auto large = QByteArray(4 * 1024, 'e');
+  store.put(ContentStore::hash(large), large);
+
+  EXPECT_FALSE(store.contains(ContentStore::hash(large)));
+}
@@ -0,0 +1,181 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Standard header files
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Qt header files
+#include <QHostAddress>
+#include <QMetaObject>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QThread>
+#include <QTimer>
+
+// Local header files
+#include "common/types/enums/enums.hpp"
+#include "packets/frame_decoder/frame_decoder.hpp"
+#include "packets/packet_dispatcher/packet_dispatcher.hpp"
+#include "packets/packet_type.hpp"
+#include "packets/pingpongpacket/pingpongpacket.hpp"
+#include "packets/syncingpacket/syncingpacketview.hpp"
+#include "syncing/session.hpp"
+#include "utility/functions/packet/packet.hpp"
+
+namespace srilakshmikanthanp::clipbirdesk::syncing::testing {
+/**
+ * @brief Session over a plain tcp socket, pings are answered the way
+ * the managers answer them and the pongs and items are counted
+ */
+class LoopbackSession : public Session {
+ private:
+  QTcpSocket* socket;
+  packets::FrameDecoder decoder;
+  packets::PacketDispatcher<> dispatcher;
+
+ protected:
+  void writeFrame(const QByteArray& frame) override {
+    socket->write(frame);
+  }
+
+  qint64 socketBytesToWrite() const override {
+    return socket->bytesToWrite();
+  }
+
+ public:
+  LoopbackSession(const QString& name, QTcpSocket* socket, std::atomic<int>& pongs, std::atomic<int>& items, QObject* parent)
+      : Session(name, parent), socket(socket) {
+    using common::types::enums::PingType;
+    using utility::functions::params::PingPacketParams;
+    using utility::functions::createPacket;
+
+    socket->setParent(this);
+
+    dispatcher.registerPacket<packets::PingPongPacket>(
+      packets::PacketType::PING_PONG_PACKET,
+      [this, &pongs](const packets::PingPongPacket& packet) {
+        if (packet.getPingType() == PingType::Ping) {
+          this->sendPacket(createPacket(PingPacketParams{PingType::Pong}));
+        } else {
+          this->markPong();
+          pongs++;
+        }
+      }
+    );
+
+    dispatcher.registerPacket<packets::SyncingPacketView>(
+      packets::PacketType::SYNCING_PACKET,
+      [&items](const packets::SyncingPacketView& packet) { items += int(packet.getItemCount()); }
+    );
+
+    dispatcher.registerPacket<packets::SyncingPacketView>(
+      packets::PacketType::STAMPED_SYNCING_PACKET,
+      [&items](const packets::SyncingPacketView& packet) { items += int(packet.getItemCount()); }
+    );
+
+    QObject::connect(socket, &QTcpSocket::readyRead, this, [this] {
+      this->markRead();
+      decoder.append(this->socket->readAll());
+      while (auto frame = decoder.next()) dispatcher.dispatch(frame.value());
+    });
+
+    QObject::connect(socket, &QTcpSocket::bytesWritten, this, &Session::onBytesWritten);
+  }
+
+  void disconnectFromHost() override {
+    socket->disconnectFromHost();
+  }
+
+  bool isTrusted() const override {
+    return true;
+  }
+
+  QByteArray getCertificate() const override {
+    return QByteArray();
+  }
+};
+}  // namespace srilakshmikanthanp::clipbirdesk::syncing::testing
+
+/**
+ * @brief testing that two sessions living on the syncing thread keep
+ * answering pings and receiving items while the GUI thread is blocked
+ */
+TEST(IoThread, TestingSessionsWhileGuiThreadBlocked) {
+  // using the LoopbackSession
+  using srilakshmikanthanp::clipbirdesk::syncing::testing::LoopbackSession;
+
+  // using the PingType
+  using srilakshmikanthanp::clipbirdesk::common::types::enums::PingType;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // interval of the pings and items and time the GUI thread is blocked
+  constexpr int interval   = 100;
+  constexpr auto blockTime = std::chrono::seconds(2);
+
+  std::atomic<int> pongs{0};
+  std::atomic<int> items{0};
+
+  QThread syncingThread;
+  QObject* context = new QObject();
+  context->moveToThread(&syncingThread);
+  syncingThread.start();
+
+  // sessions, sockets and timers are all created on the syncing thread
+  QMetaObject::invokeMethod(context, [context, &pongs, &items] {
+    auto* server = new QTcpServer(context);
+    auto* socket = new QTcpSocket();
+    auto* client = new LoopbackSession("client", socket, pongs, items, context);
+
+    server->listen(QHostAddress::LocalHost);
+
+    QObject::connect(server, &QTcpServer::newConnection, context, [server, context, &pongs, &items] {
+      auto* peer = new LoopbackSession("server", server->nextPendingConnection(), pongs, items, context);
+      auto* sync = new QTimer(peer);
+
+      // the server side pushes an item every interval
+      QObject::connect(sync, &QTimer::timeout, peer, [peer] {
+        peer->sendPacket(createPacket(params::SyncingPacketParams{{{"text/plain", "Hello World"}}}));
+      });
+
+      peer->startHeartbeat();
+      sync->start(interval);
+    });
+
+    QObject::connect(socket, &QTcpSocket::connected, client, [client] {
+      auto* ping = new QTimer(client);
+
+      // the client side pings every interval
+      QObject::connect(ping, &QTimer::timeout, client, [client] {
+        client->sendPacket(createPacket(params::PingPacketParams{PingType::Ping}));
+      });
+
+      client->startHeartbeat();
+      ping->start(interval);
+    });
+
+    socket->connectToHost(QHostAddress::LocalHost, server->serverPort());
+  }, Qt::BlockingQueuedConnection);
+
+  // block the calling (GUI) thread
+  std::this_thread::sleep_for(blockTime);
+
+  const int pongCount = pongs.load();
+  const int itemCount = items.load();
+
+  // tear down on the syncing thread, sessions leave the wheel on delete
+  QMetaObject::invokeMethod(context, [context] { delete context; }, Qt::BlockingQueuedConnection);
+  syncingThread.quit();
+  syncingThread.wait();
+
+  // most of what was sent during the block should have been handled
+  const int expected = int(blockTime / std::chrono::milliseconds(interval)) / 2;
+
+  EXPECT_GE(pongCount, expected);
+  EXPECT_GE(itemCount, expected);
+}
@@ -0,0 +1,182 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QList>
+#include <QUuid>
+
+// Standard header files
+#include <memory>
+#include <vector>
+
+// Local header files
+#include "syncing/sync_clock/sync_clock.hpp"
+
+namespace sync_clock_test {
+// using the SyncClock
+using srilakshmikanthanp::clipbirdesk::syncing::SyncClock;
+
+/**
+ * @brief Update as it is carried by a SyncingPacket
+ */
+struct Update {
+  QUuid originId;
+  quint64 sequence;
+  QByteArray text;
+};
+
+/**
+ * @brief Update on its way from one peer to another
+ */
+struct Message {
+  int from;
+  int to;
+  Update update;
+};
+
+/**
+ * @brief Three peers in the hub and spoke layout of the managers, peer
+ * zero is the server that relays what it applies to the other clients
+ */
+class Network {
+ private:
+  struct Peer {
+    std::unique_ptr<SyncClock> clock;
+    QByteArray clipboard;
+  };
+
+ public:
+  std::vector<Peer> peers;
+  QList<Message> inFlight;
+  int transmissions = 0;
+
+  Network() {
+    for (int i = 0; i < 3; i++) {
+      peers.push_back(Peer{std::make_unique<SyncClock>(QUuid::createUuid()), QByteArray()});
+    }
+  }
+
+  void send(int from, int to, const Update& update) {
+    inFlight.append(Message{from, to, update});
+    transmissions++;
+  }
+
+  // ServerManager::synchronize and ClientManager::synchronize
+  void copy(int peer, const QByteArray& text) {
+    auto& clock = *peers[peer].clock;
+    const Update update{clock.getOrigin(), clock.next(), text};
+    peers[peer].clipboard = text;
+
+    if (peer != 0) {
+      this->send(peer, 0, update);
+      return;
+    }
+
+    for (int to = 1; to < int(peers.size()); to++) {
+      this->send(0, to, update);
+    }
+  }
+
+  // ServerManager::onSyncingPacket and ClientManager::handleSyncingPacket
+  void deliver(const Message& message) {
+    auto& peer = peers[message.to];
+
+    if (!peer.clock->accept(message.update.originId, message.update.sequence)) {
+      return;
+    }
+
+    peer.clipboard = message.update.text;
+
+    if (message.to != 0) {
+      return;
+    }
+
+    for (int to = 1; to < int(peers.size()); to++) {
+      if (to != message.from) this->send(0, to, message.update);
+    }
+  }
+
+  void deliverAll() {
+    while (!inFlight.isEmpty()) {
+      this->deliver(inFlight.takeFirst());
+    }
+  }
+
+  bool isConsistent(const QByteArray& text) const {
+    for (const auto& peer : peers) {
+      if (peer.clipboard != text) return false;
+    }
+
+    return true;
+  }
+};
+}  // namespace sync_clock_test
+
+/**
+ * @brief testing that an update reaches every peer with one
+ * transmission per peer and echoes are not retransmitted
+ */
+TEST(SyncClock, TestingNoRedundantRetransmissions) {
+  sync_clock_test::Network network;
+
+  // a client copies, it goes to the server and is relayed once
+  network.copy(1, "from client");
+  network.deliverAll();
+
+  EXPECT_EQ(network.transmissions, 2);
+  EXPECT_TRUE(network.isConsistent("from client"));
+
+  // the server copies, it goes to both clients
+  network.copy(0, "from server");
+  const auto relayed = network.inFlight.first();
+  network.deliverAll();
+
+  EXPECT_EQ(network.transmissions, 4);
+  EXPECT_TRUE(network.isConsistent("from server"));
+
+  // a client echoing the update back is not relayed again
+  network.send(2, 0, relayed.update);
+  network.deliverAll();
+
+  EXPECT_EQ(network.transmissions, 5);
+  EXPECT_TRUE(network.isConsistent("from server"));
+
+  // the origin drops its own update coming back
+  EXPECT_FALSE(network.peers[0].clock->accept(relayed.update.originId, relayed.update.sequence));
+}
+
+/**
+ * @brief testing that duplicates and updates delivered out of order
+ * never overwrite a newer clip
+ */
+TEST(SyncClock, TestingStaleUpdatesAreDropped) {
+  sync_clock_test::Network network;
+
+  // two copies on a client arrive at the server in reverse
+  network.copy(1, "older");
+  network.copy(1, "newer");
+
+  const auto newer = network.inFlight.takeLast();
+  network.deliver(newer);
+  network.deliverAll();
+
+  // only the newer one was relayed
+  EXPECT_EQ(network.transmissions, 3);
+  EXPECT_TRUE(network.isConsistent("newer"));
+
+  // a duplicate delivered again is neither applied nor relayed
+  network.deliver(newer);
+
+  EXPECT_TRUE(network.inFlight.isEmpty());
+  EXPECT_EQ(network.transmissions, 3);
+
+  // a copy after observing an update orders after it on every peer
+  network.copy(2, "latest");
+  network.deliverAll();
+
+  EXPECT_EQ(network.transmissions, 5);
+  EXPECT_TRUE(network.isConsistent("latest"));
+}
@@ -0,0 +1,84 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Standard header files
+#include <atomic>
+#include <optional>
+
+// Qt header files
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+#include <QMetaObject>
+#include <QPointer>
+#include <QTcpSocket>
+#include <QThread>
+
+// Local header files
+#include "syncing/manager/syncing_thread.hpp"
+#include "syncing/session.hpp"
+#include "syncing/io_thread.hpp"
+
+/**
+ * @brief testing that the GUI thread gets sessions of the syncing thread
+ * as queued values and that quitting the application joins the thread
+ * and deletes what lives on it
+ */
+TEST(SyncingThread, TestingQueuedSessionInfoAndQuit) {
+  // using the SyncingThread
+  using srilakshmikanthanp::clipbirdesk::syncing::SyncingThread;
+
+  // using the SessionInfo
+  using srilakshmikanthanp::clipbirdesk::syncing::SessionInfo;
+
+  // using the LoopbackSession
+  using srilakshmikanthanp::clipbirdesk::syncing::testing::LoopbackSession;
+
+  std::atomic<int> pongs{0};
+  std::atomic<int> items{0};
+
+  // stands in for the SyncingManager the factory adopts
+  SyncingThread thread;
+  QObject* manager = new QObject();
+  QPointer<QObject> managerRef = manager;
+  thread.adopt(manager);
+  thread.start();
+
+  // stands in for the GUI objects the manager signals
+  QObject gui;
+  std::optional<SessionInfo> received;
+  QThread* receivedOn = nullptr;
+
+  // the session is made and read on the syncing thread
+  QMetaObject::invokeMethod(manager, [manager, &gui, &received, &receivedOn, &pongs, &items] {
+    auto* session = new LoopbackSession("client", new QTcpSocket(), pongs, items, manager);
+
+    QMetaObject::invokeMethod(&gui, [info = session->getInfo(), &received, &receivedOn] {
+      received   = info;
+      receivedOn = QThread::currentThread();
+    }, Qt::QueuedConnection);
+  }, Qt::QueuedConnection);
+
+  // wait on the GUI thread for the queued values
+  QDeadlineTimer deadline(5000);
+
+  while (!received.has_value() && !deadline.hasExpired()) {
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 50);
+  }
+
+  // check the values arrived on the GUI thread
+  ASSERT_TRUE(received.has_value());
+  EXPECT_EQ(receivedOn, QThread::currentThread());
+  EXPECT_EQ(received->name, "client");
+  EXPECT_TRUE(received->trusted);
+  EXPECT_FALSE(received->session.isNull());
+
+  // the application quitting stops the thread
+  QMetaObject::invokeMethod(QCoreApplication::instance(), "aboutToQuit", Qt::DirectConnection);
+
+  // check the thread is joined and its objects are gone
+  EXPECT_TRUE(thread.getThread()->isFinished());
+  EXPECT_TRUE(managerRef.isNull());
+  EXPECT_TRUE(received->session.isNull());
+}
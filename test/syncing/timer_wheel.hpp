@@ -0,0 +1,104 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QObject>
+#include <QVector>
+
+// Local header files
+#include "syncing/timer_wheel/timer_wheel.hpp"
+
+/**
+ * @brief testing that entries fire on the first tick past their
+ * deadline and never before it
+ */
+TEST(TimerWheel, TestingEntriesFireAtDeadline) {
+  // using the TimerWheel
+  using srilakshmikanthanp::clipbirdesk::syncing::TimerWheel;
+
+  // tick length of the wheel
+  constexpr qint64 tick = 100;
+
+  TimerWheel wheel(tick);
+  QObject first, second;
+  const auto start = TimerWheel::now();
+  QVector<int> fired;
+
+  wheel.schedule(&first, start + 250, [&] { fired.append(1); });
+  wheel.schedule(&second, start + 520, [&] { fired.append(2); });
+
+  wheel.advance(start + 200);
+  EXPECT_TRUE(fired.isEmpty());
+
+  wheel.advance(start + 300);
+  EXPECT_EQ(fired, QVector<int>({1}));
+
+  wheel.advance(start + 600);
+  EXPECT_EQ(fired, QVector<int>({1, 2}));
+  EXPECT_EQ(wheel.size(), 0);
+}
+
+/**
+ * @brief testing that deadlines beyond the first level cascade down
+ * and fire on time
+ */
+TEST(TimerWheel, TestingFarDeadlinesCascade) {
+  // using the TimerWheel
+  using srilakshmikanthanp::clipbirdesk::syncing::TimerWheel;
+
+  // tick length of the wheel
+  constexpr qint64 tick = 10;
+
+  TimerWheel wheel(tick);
+  QObject owner;
+  const auto start    = TimerWheel::now();
+  const auto deadline = start + 64 * 64 * tick + 35 * tick;
+  bool fired          = false;
+
+  wheel.schedule(&owner, deadline, [&] { fired = true; });
+
+  wheel.advance(deadline - tick);
+  EXPECT_FALSE(fired);
+
+  wheel.advance(deadline + tick);
+  EXPECT_TRUE(fired);
+}
+
+/**
+ * @brief testing that scheduling again replaces the entry and that a
+ * destroyed owner is removed
+ */
+TEST(TimerWheel, TestingRescheduleAndCancel) {
+  // using the TimerWheel
+  using srilakshmikanthanp::clipbirdesk::syncing::TimerWheel;
+
+  // tick length of the wheel
+  constexpr qint64 tick = 100;
+
+  TimerWheel wheel(tick);
+  const auto start = TimerWheel::now();
+  int count        = 0;
+
+  QObject owner;
+  wheel.schedule(&owner, start + 200, [&] { count += 1; });
+  wheel.schedule(&owner, start + 800, [&] { count += 10; });
+  EXPECT_EQ(wheel.size(), 1);
+
+  wheel.advance(start + 500);
+  EXPECT_EQ(count, 0);
+
+  wheel.advance(start + 900);
+  EXPECT_EQ(count, 10);
+
+  {
+    QObject temporary;
+    wheel.schedule(&temporary, start + 1500, [&] { count += 100; });
+    EXPECT_TRUE(wheel.isScheduled(&temporary));
+  }
+
+  EXPECT_EQ(wheel.size(), 0);
+  wheel.advance(start + 2000);
+  EXPECT_EQ(count, 10);
+}
@@ -1,17 +1,42 @@
 // Google test header files
 #include <gtest/gtest.h>
 
+// Qt header files
+#include <QCoreApplication>
+
 // Local header files
+#include "clipboard/capture_sequence.hpp"
+#include "clipboard/lazy_mime_data.hpp"
+#include "history/history_store.hpp"
+#include "history/search_index.hpp"
 #include "packets/authentication.hpp"
+#include "packets/capabilitypacket.hpp"
 #include "packets/certificate_exchange_packet.hpp"
+#include "packets/deltapacket.hpp"
+#include "packets/frame_decoder.hpp"
 #include "packets/invalidrequest.hpp"
+#include "packets/offerpacket.hpp"
+#include "packets/packet_dispatcher.hpp"
 #include "packets/pingpongpacket.hpp"
+#include "packets/streamingpacket.hpp"
 #include "packets/syncingpacket.hpp"
+#include "packets/syncingpacketview.hpp"
+#include "syncing/content_store.hpp"
+#include "syncing/io_thread.hpp"
+#include "syncing/sync_clock.hpp"
+#include "syncing/syncing_thread.hpp"
+#include "syncing/timer_wheel.hpp"
+#include "utility/compression.hpp"
+#include "utility/crypto.hpp"
+#include "utility/delta.hpp"
+#include "utility/fingerprint.hpp"
 
 /**
  * @brief Testing the clipbirdesk Application
  */
 auto main(int argc, char **argv) -> int {
+  // event loops of worker threads need an application instance
+  QCoreApplication app(argc, argv);
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
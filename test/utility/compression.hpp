@@ -0,0 +1,154 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Standard header files
+#include <string>
+
+// Qt header files
+#include <QByteArray>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QString>
+#include <QtEndian>
+
+// Local header files
+#include "common/types/enums/enums.hpp"
+#include "common/types/exceptions/exceptions.hpp"
+#include "constants/constants.hpp"
+#include "utility/functions/compression/compression.hpp"
+
+/**
+ * @brief testing that only compressible items above the threshold are
+ * compressed and only for peers accepting deflate
+ */
+TEST(Compression, TestingEncodingChoice) {
+  // using the Encoding
+  using srilakshmikanthanp::clipbirdesk::common::types::enums::Encoding;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  const auto text     = QByteArray("Hello World ").repeated(1024);
+  const auto accepted = getSupportedEncodings();
+
+  // text is compressed and decodes back
+  const auto [encoding, encoded] = encodePayload("text/plain", text, accepted);
+  EXPECT_EQ(encoding, Encoding::Deflate);
+  EXPECT_LT(encoded.size(), text.size());
+  EXPECT_EQ(decodePayload(encoding, encoded), text);
+
+  // already compressed formats are sent as they are
+  EXPECT_EQ(encodePayload("image/png", text, accepted).first, Encoding::Identity);
+
+  // small items are not worth it
+  EXPECT_EQ(encodePayload("text/plain", "Hello World", accepted).first, Encoding::Identity);
+
+  // peers that did not announce deflate get the payload as it is
+  EXPECT_EQ(encodePayload("text/plain", text, 0).first, Encoding::Identity);
+  EXPECT_TRUE(isDecodable(encodingBit(Encoding::Identity), 0));
+  EXPECT_FALSE(isDecodable(encodingBit(Encoding::Deflate), 0));
+
+  // payloads the peer would refuse to inflate are not compressed
+  const auto maxLength = qsizetype(srilakshmikanthanp::clipbirdesk::constants::getAppMaxDecodedLength());
+  EXPECT_EQ(chooseEncoding("text/plain", maxLength, accepted), Encoding::Deflate);
+  EXPECT_EQ(chooseEncoding("text/plain", maxLength + 1, accepted), Encoding::Identity);
+}
+
+/**
+ * @brief testing that corrupt and oversized payloads are rejected
+ */
+TEST(Compression, TestingMalformedPayload) {
+  // using the MalformedPacket
+  using srilakshmikanthanp::clipbirdesk::common::types::exceptions::MalformedPacket;
+
+  // using the Encoding
+  using srilakshmikanthanp::clipbirdesk::common::types::enums::Encoding;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  auto deflated = qCompress(QByteArray("Hello World ").repeated(1024));
+
+  // unknown encoding
+  EXPECT_THROW(decodePayload(0x7F, deflated), MalformedPacket);
+
+  // truncated stream
+  EXPECT_THROW(decodePayload(Encoding::Deflate, deflated.left(deflated.size() / 2)), MalformedPacket);
+
+  // claims to decode to more than allowed
+  const auto length = quint32(srilakshmikanthanp::clipbirdesk::constants::getAppMaxDecodedLength() + 1);
+  qToBigEndian(length, deflated.data());
+  EXPECT_THROW(decodePayload(Encoding::Deflate, deflated), MalformedPacket);
+
+  // a chunk may not decode past what is left of its item
+  const auto chunk = qCompress(QByteArray("Hello World ").repeated(1024));
+  EXPECT_EQ(decodePayload(Encoding::Deflate, chunk, 12 * 1024).size(), 12 * 1024);
+  EXPECT_THROW(decodePayload(Encoding::Deflate, chunk, 12 * 1024 - 1), MalformedPacket);
+}
+
+/**
+ * @brief Measure the ratio and latency of the encoding on clipboard like
+ * content, html as a browser puts it on the clipboard and source code
+ * of this repository, results are recorded as test properties
+ */
+TEST(Compression, TestingRatioAndLatency) {
+  // using the Encoding
+  using srilakshmikanthanp::clipbirdesk::common::types::enums::Encoding;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // html of a copied table with inline styles
+  QByteArray html("<meta charset='utf-8'><table style=\"border-collapse: collapse; font-family: Arial;\">");
+
+  for (auto row = 0; row < 200; row++) {
+    html += "<tr><td style=\"padding: 4px; border: 1px solid #dddddd; color: #202124;\">";
+    html += QByteArray::number(row * 7919 % 10007);
+    html += "</td><td style=\"padding: 4px; border: 1px solid #dddddd; color: #202124;\"><span style=\"font-weight: 700;\">Item ";
+    html += QByteArray::number(row);
+    html += "</span></td></tr>";
+  }
+
+  html += "</table>";
+
+  // source code of the repository
+  const auto root = QDir(QFileInfo(QString::fromUtf8(__FILE__)).absolutePath() + "/../..");
+  QFile file(root.filePath("src/syncing/session.cpp"));
+
+  if (!file.open(QIODevice::ReadOnly)) {
+    GTEST_SKIP() << "source corpus not found";
+  }
+
+  const QVector<QPair<QString, QByteArray>> corpus = {{"text/html", html}, {"text/plain", file.readAll()}};
+
+  for (const auto& [mimeType, payload] : corpus) {
+    constexpr auto rounds = 50;
+
+    QElapsedTimer timer;
+    QPair<quint32, QByteArray> encoded;
+
+    timer.start();
+    for (auto i = 0; i < rounds; i++) encoded = encodePayload(mimeType, payload, getSupportedEncodings());
+    const auto encodeTime = timer.nsecsElapsed() / rounds;
+
+    QByteArray decoded;
+
+    timer.restart();
+    for (auto i = 0; i < rounds; i++) decoded = decodePayload(encoded.first, encoded.second);
+    const auto decodeTime = timer.nsecsElapsed() / rounds;
+
+    const auto ratio = double(encoded.second.size()) / double(payload.size());
+
+    RecordProperty((mimeType + " ratio").toStdString(), std::to_string(ratio));
+    RecordProperty((mimeType + " encode ns").toStdString(), std::to_string(encodeTime));
+    RecordProperty((mimeType + " decode ns").toStdString(), std::to_string(decodeTime));
+
+    EXPECT_EQ(encoded.first, Encoding::Deflate);
+    EXPECT_EQ(decoded, payload);
+    EXPECT_LT(ratio, 0.5);
+  }
+}
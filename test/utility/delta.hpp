@@ -0,0 +1,74 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QRandomGenerator>
+
+// Local header files
+#include "common/types/exceptions/exceptions.hpp"
+#include "utility/functions/delta/delta.hpp"
+
+/**
+ * @brief testing that an edit in the middle of a large text gives a
+ * small delta that rebuilds the edited text exactly
+ */
+TEST(Delta, TestingEditedText) {
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // a log of 2 MiB with lines that do not repeat
+  QByteArray base;
+  QRandomGenerator random(42);
+
+  while (base.size() < 2 * 1024 * 1024) {
+    base += "[info] request " + QByteArray::number(random.generate()) + " served in " + QByteArray::number(random.bounded(1000)) + " ms\n";
+  }
+
+  // insert a line near the middle and drop a few bytes near the end
+  auto target = base;
+  target.insert(base.size() / 2, "[warn] cache miss\n");
+  target.remove(target.size() - 4096, 100);
+
+  const auto ops = createDelta(base, target);
+
+  EXPECT_EQ(applyDelta(base, ops, quint64(target.size())), target);
+  EXPECT_LT(deltaSize(ops), target.size() / 20);
+
+  // nothing in common is all literal
+  const auto other = QByteArray("Hello World ").repeated(1024);
+  EXPECT_EQ(applyDelta(base, createDelta(base, other), quint64(other.size())), other);
+
+  // only text is sent as delta
+  EXPECT_TRUE(isDeltaCompatible("text/plain"));
+  EXPECT_TRUE(isDeltaCompatible("text/html"));
+  EXPECT_FALSE(isDeltaCompatible("image/png"));
+}
+
+/**
+ * @brief testing that ops out of the base or the target are rejected
+ */
+TEST(Delta, TestingMalformedDelta) {
+  // using the MalformedPacket
+  using srilakshmikanthanp::clipbirdesk::common::types::exceptions::MalformedPacket;
+
+  // using the DeltaOp
+  using srilakshmikanthanp::clipbirdesk::packets::DeltaOp;
+
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  const QByteArray base("Hello World");
+
+  // copies past the base
+  EXPECT_THROW(applyDelta(base, {DeltaOp{6, 10, QByteArray()}}, 10), MalformedPacket);
+
+  // offset wraps around
+  EXPECT_THROW(applyDelta(base, {DeltaOp{~quint64(0), 2, QByteArray()}}, 2), MalformedPacket);
+
+  // longer and shorter than the target
+  EXPECT_THROW(applyDelta(base, {DeltaOp{0, 11, QByteArray("!")}}, 11), MalformedPacket);
+  EXPECT_THROW(applyDelta(base, {DeltaOp{0, 5, QByteArray()}}, 11), MalformedPacket);
+}
@@ -0,0 +1,64 @@
+#pragma once  // Header guard see https://en.wikipedia.org/wiki/Include_guard
+
+// Google test header files
+#include <gtest/gtest.h>
+
+// Qt header files
+#include <QByteArray>
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+// Local header files
+#include "utility/functions/fingerprint/fingerprint.hpp"
+
+/**
+ * @brief testing that equal items have equal fingerprints and that the
+ * mime types, payloads and order of the items change it
+ */
+TEST(Fingerprint, TestingContentFingerprint) {
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  // clipboard items
+  using Items = QVector<QPair<QString, QByteArray>>;
+
+  const Items items = {
+    {"text/html", "<b>Hello World</b>"},
+    {"text/plain", "Hello World"},
+  };
+
+  // a deep copy has the same fingerprint
+  auto copy = items;
+  copy[1].second.detach();
+  EXPECT_EQ(contentFingerprint(items), contentFingerprint(copy));
+
+  // payload
+  copy[1].second = "Hello World!";
+  EXPECT_NE(contentFingerprint(items), contentFingerprint(copy));
+
+  // mime type
+  EXPECT_NE(contentFingerprint(Items{{"text/plain", "Hello"}}), contentFingerprint(Items{{"text/html", "Hello"}}));
+
+  // order
+  EXPECT_NE(contentFingerprint(items), contentFingerprint(Items{items[1], items[0]}));
+
+  // bytes moved between the mime type and the payload
+  EXPECT_NE(contentFingerprint(Items{{"text/plain", "ab"}}), contentFingerprint(Items{{"text/plai", "nab"}}));
+
+  // an empty payload still counts as an item
+  EXPECT_NE(contentFingerprint(Items{}), contentFingerprint(Items{{"text/plain", ""}}));
+}
+
+/**
+ * @brief testing that the fingerprint is XXH64, it is kept on disk
+ * and must not change between builds
+ */
+TEST(Fingerprint, TestingStableFingerprint) {
+  // using functions namespace
+  using namespace srilakshmikanthanp::clipbirdesk::utility::functions;
+
+  EXPECT_EQ(contentFingerprint(QByteArrayView("")), 0xEF46DB3751D8E999ULL);
+  EXPECT_EQ(contentFingerprint(QByteArrayView("abc")), 0x44BC2CF5AD770999ULL);
+  EXPECT_EQ(contentFingerprint(QByteArrayView("Nobody inspects the spammish repetition")), 0xFBCEA83C8A378BF1ULL);
+}